@@ -3,6 +3,7 @@ set(CMAKE_UNITY_BUILD ON)
 
 option(BUILD_EDITOR "Build Explosion editor" ON)
 option(CI "Build in CI" OFF)
+set(MIRROR_ANY_INLINE_CAPACITY 64 CACHE STRING "Inline capacity in bytes of Mirror::Any")
 
 get_cmake_property(GENERATOR_IS_MULTI_CONFIG GENERATOR_IS_MULTI_CONFIG)
 if (${GENERATOR_IS_MULTI_CONFIG})
@@ -30,6 +31,8 @@ add_definitions(-DCOMPILER_GCC=$<IF:$<CXX_COMPILER_ID:GNU>,1,0>)
 
 add_definitions(-DBUILD_EDITOR=$<BOOL:BUILD_EDITOR>)
 
+add_definitions(-DMIRROR_ANY_INLINE_CAPACITY=${MIRROR_ANY_INLINE_CAPACITY})
+
 if (${CMAKE_SYSTEM_NAME} STREQUAL "Darwin")
     string(REGEX REPLACE ".*MacOSX([0-9]+\\.[0-9]+).*" "\\1" MACOS_SDK_VERSION ${CMAKE_OSX_SYSROOT})
     add_definitions(-DMACOS_SDK_VERSION=${MACOS_SDK_VERSION})
@@ -1,9 +1,11 @@
 option(BUILD_TEST "Build unit tests" ON)
 option(BUILD_SAMPLE "Build sample" ON)
+option(BUILD_BENCHMARK "Build benchmarks" OFF)
 
 set(API_HEADER_DIR ${CMAKE_BINARY_DIR}/Generated/Api CACHE PATH "" FORCE)
 set(BASIC_LIBS Common CACHE STRING "" FORCE)
 set(BASIC_TEST_LIBS Test CACHE STRING "" FORCE)
+set(BASIC_BENCHMARK_LIBS Benchmark CACHE STRING "" FORCE)
 
 if (${BUILD_TEST})
     enable_testing()
@@ -474,3 +476,61 @@ function(AddTest)
         WORKING_DIRECTORY $<TARGET_FILE_DIR:${PARAMS_NAME}>
     )
 endfunction()
+
+function(AddBenchmark)
+    if (NOT ${BUILD_BENCHMARK})
+        return()
+    endif()
+
+    cmake_parse_arguments(PARAMS "" "NAME" "SRC;INC;LINK;LIB;DEP_TARGET;RES;REFLECT" ${ARGN})
+
+    if (DEFINED PARAMS_REFLECT)
+        AddMirrorInfoSourceGenerationTarget(
+            NAME ${PARAMS_NAME}
+            OUTPUT_SRC GENERATED_SRC
+            OUTPUT_TARGET_NAME GENERATED_TARGET
+            SEARCH_DIR ${PARAMS_REFLECT}
+            PRIVATE_INC ${PARAMS_INC}
+            LIB ${PARAMS_LIB} ${BASIC_LIBS} ${BASIC_BENCHMARK_LIBS}
+        )
+    endif()
+
+    add_executable(${PARAMS_NAME})
+    target_sources(
+        ${PARAMS_NAME}
+        PRIVATE ${PARAMS_SRC} ${GENERATED_SRC}
+    )
+    target_include_directories(
+        ${PARAMS_NAME}
+        PRIVATE ${PARAMS_INC}
+    )
+    target_link_directories(
+        ${PARAMS_NAME}
+        PRIVATE ${PARAMS_LINK}
+    )
+    LinkBasicLibs(
+        NAME ${PARAMS_NAME}
+        LIB ${BASIC_LIBS} ${BASIC_BENCHMARK_LIBS}
+    )
+    LinkLibraries(
+        NAME ${PARAMS_NAME}
+        LIB ${PARAMS_LIB}
+    )
+    AddRuntimeDependenciesCopyCommand(
+        NAME ${PARAMS_NAME}
+    )
+    AddResourcesCopyCommand(
+        NAME ${PARAMS_NAME}
+        RES ${PARAMS_RES}
+    )
+    if (DEFINED PARAMS_DEP_TARGET)
+        add_dependencies(${PARAMS_NAME} ${PARAMS_DEP_TARGET})
+    endif()
+    if (DEFINED PARAMS_REFLECT)
+        add_dependencies(${PARAMS_NAME} ${GENERATED_TARGET})
+    endif()
+
+    if (${MSVC})
+        set_target_properties(${PARAMS_NAME} PROPERTIES VS_DEBUGGER_WORKING_DIRECTORY ${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/$<CONFIG>)
+    endif()
+endfunction()
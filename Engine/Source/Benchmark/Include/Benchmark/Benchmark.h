@@ -0,0 +1,85 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <string>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+
+#if COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+namespace Benchmark {
+    // allocations made through global operator new since program start, counted by benchmark library
+    struct AllocationStats {
+        uint64_t count;
+        uint64_t bytes;
+    };
+
+    AllocationStats GetAllocationStats();
+
+    class State {
+    public:
+        explicit State(uint64_t inIterations);
+
+        // loop condition of benchmark body, timing starts at the first call and stops when it returns false
+        bool Next();
+        // exclude work inside the loop, e.g. per iteration setup, from time and allocation stats
+        void PauseTiming();
+        void ResumeTiming();
+        // bytes read or written by one iteration, reported as throughput
+        void SetBytesPerIteration(uint64_t inBytes);
+
+        uint64_t Iterations() const;
+        uint64_t BytesPerIteration() const;
+        double ElapsedSeconds() const;
+        const AllocationStats& Allocations() const;
+
+    private:
+        uint64_t iterations;
+        uint64_t remaining;
+        uint64_t bytesPerIteration;
+        bool started;
+        bool paused;
+        std::chrono::steady_clock::time_point begin;
+        std::chrono::steady_clock::duration elapsed;
+        AllocationStats beginAllocations;
+        AllocationStats allocations;
+    };
+
+    using Func = std::function<void(State&)>;
+
+    struct Registration {
+        Registration(std::string inName, Func inFunc);
+    };
+
+    // keep inValue alive so that computing it can not be optimized away
+    template <typename T> void DoNotOptimize(const T& inValue);
+
+    // options: --filter <substring> --min-time <seconds> --json <file>
+    // results are printed as a table, and written as json when --json is given
+    int RunAll(int argc, char* argv[]);
+}
+
+#define BENCHMARK(name) \
+    static void Benchmark##name(Benchmark::State& state); \
+    static Benchmark::Registration benchmarkRegistration##name(#name, &Benchmark##name); \
+    static void Benchmark##name(Benchmark::State& state)
+
+namespace Benchmark {
+    template <typename T>
+    void DoNotOptimize(const T& inValue)
+    {
+#if COMPILER_MSVC
+        const volatile auto* pointer = &reinterpret_cast<const volatile char&>(inValue);
+        (void) *pointer;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(inValue) : "memory");
+#endif
+    }
+}
@@ -0,0 +1,281 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <new>
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <format>
+#include <algorithm>
+
+#include <Benchmark/Benchmark.h>
+#include <Common/Debug.h>
+#include <Common/Serialization.h>
+
+namespace Benchmark::Internal {
+    static std::atomic<uint64_t> allocationCount = 0;
+    static std::atomic<uint64_t> allocationBytes = 0;
+
+    // upper bound of iterations of one run, for bodies too fast to reach min time
+    static constexpr uint64_t maxIterations = 1000000000;
+
+    struct Entry {
+        std::string name;
+        Func func;
+    };
+
+    struct Options {
+        std::string filter;
+        double minTime = 0.5;
+        std::string jsonFile;
+    };
+
+    struct Result {
+        std::string name;
+        uint64_t iterations;
+        double nsPerIteration;
+        double bytesPerSecond;
+        double allocationsPerIteration;
+        double allocatedBytesPerIteration;
+    };
+
+    static std::vector<Entry>& GetEntries()
+    {
+        static std::vector<Entry> entries;
+        return entries;
+    }
+
+    static void* Allocate(size_t inSize)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocationBytes.fetch_add(inSize, std::memory_order_relaxed);
+        if (void* result = std::malloc(std::max(inSize, static_cast<size_t>(1)))) {
+            return result;
+        }
+        throw std::bad_alloc();
+    }
+
+    static Options ParseOptions(int argc, char* argv[])
+    {
+        Options options;
+        for (auto i = 1; i + 1 < argc; i += 2) {
+            const std::string key = argv[i];
+            const std::string value = argv[i + 1];
+            if (key == "--filter") {
+                options.filter = value;
+            } else if (key == "--min-time") {
+                options.minTime = std::stod(value);
+            } else if (key == "--json") {
+                options.jsonFile = value;
+            } else {
+                QuickFailWithReason(std::format("unknown benchmark option {}", key));
+            }
+        }
+        return options;
+    }
+
+    static Result Measure(const Entry& inEntry, double inMinTime)
+    {
+        uint64_t iterations = 1;
+        while (true) {
+            State state(iterations);
+            inEntry.func(state);
+            AssertWithReason(!state.Next(), "benchmark body must loop on state.Next() until it returns false");
+
+            const auto seconds = state.ElapsedSeconds();
+            if (seconds >= inMinTime || iterations >= maxIterations) {
+                const auto count = static_cast<double>(iterations);
+                return {
+                    inEntry.name,
+                    iterations,
+                    seconds * 1e9 / count,
+                    seconds > 0 ? static_cast<double>(state.BytesPerIteration()) * count / seconds : 0,
+                    static_cast<double>(state.Allocations().count) / count,
+                    static_cast<double>(state.Allocations().bytes) / count
+                };
+            }
+
+            // grow towards min time with some margin, at most 10x per round so that a noisy first run does not explode
+            const auto multiplier = seconds > 0 ? std::clamp(inMinTime * 1.4 / seconds, 1.5, 10.0) : 10.0;
+            iterations = std::min(std::max(iterations + 1, static_cast<uint64_t>(static_cast<double>(iterations) * multiplier)), maxIterations);
+        }
+    }
+
+    static void WriteJson(const std::string& inFile, const std::vector<Result>& inResults)
+    {
+        std::ofstream file(inFile, std::ios::binary | std::ios::trunc);
+        Assert(file.is_open());
+
+        Common::JsonWriter writer(file);
+        writer.StartObject();
+        writer.Key("buildConfig");
+        writer.String(BUILD_CONFIG_DEBUG ? "debug" : "release");
+        writer.Key("benchmarks");
+        writer.StartArray();
+        for (const auto& result : inResults) {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(result.name);
+            writer.Key("iterations");
+            writer.Uint64(result.iterations);
+            writer.Key("nsPerIteration");
+            writer.Double(result.nsPerIteration);
+            writer.Key("bytesPerSecond");
+            writer.Double(result.bytesPerSecond);
+            writer.Key("allocationsPerIteration");
+            writer.Double(result.allocationsPerIteration);
+            writer.Key("allocatedBytesPerIteration");
+            writer.Double(result.allocatedBytesPerIteration);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+        writer.Flush();
+    }
+}
+
+void* operator new(size_t inSize)
+{
+    return Benchmark::Internal::Allocate(inSize);
+}
+
+void* operator new[](size_t inSize)
+{
+    return Benchmark::Internal::Allocate(inSize);
+}
+
+void operator delete(void* inPointer) noexcept
+{
+    std::free(inPointer);
+}
+
+void operator delete[](void* inPointer) noexcept
+{
+    std::free(inPointer);
+}
+
+void operator delete(void* inPointer, size_t) noexcept
+{
+    std::free(inPointer);
+}
+
+void operator delete[](void* inPointer, size_t) noexcept
+{
+    std::free(inPointer);
+}
+
+namespace Benchmark {
+    AllocationStats GetAllocationStats()
+    {
+        return {
+            Internal::allocationCount.load(std::memory_order_relaxed),
+            Internal::allocationBytes.load(std::memory_order_relaxed)
+        };
+    }
+
+    State::State(uint64_t inIterations)
+        : iterations(inIterations)
+        , remaining(inIterations)
+        , bytesPerIteration(0)
+        , started(false)
+        , paused(false)
+        , elapsed(0)
+        , beginAllocations()
+        , allocations()
+    {
+    }
+
+    bool State::Next()
+    {
+        if (!started) {
+            started = true;
+            ResumeTiming();
+        }
+        if (remaining == 0) {
+            if (!paused) {
+                PauseTiming();
+            }
+            return false;
+        }
+        remaining--;
+        return true;
+    }
+
+    void State::PauseTiming()
+    {
+        Assert(!paused);
+        elapsed += std::chrono::steady_clock::now() - begin;
+        const auto current = GetAllocationStats();
+        allocations.count += current.count - beginAllocations.count;
+        allocations.bytes += current.bytes - beginAllocations.bytes;
+        paused = true;
+    }
+
+    void State::ResumeTiming()
+    {
+        beginAllocations = GetAllocationStats();
+        begin = std::chrono::steady_clock::now();
+        paused = false;
+    }
+
+    void State::SetBytesPerIteration(uint64_t inBytes)
+    {
+        bytesPerIteration = inBytes;
+    }
+
+    uint64_t State::Iterations() const
+    {
+        return iterations;
+    }
+
+    uint64_t State::BytesPerIteration() const
+    {
+        return bytesPerIteration;
+    }
+
+    double State::ElapsedSeconds() const
+    {
+        return std::chrono::duration<double>(elapsed).count();
+    }
+
+    const AllocationStats& State::Allocations() const
+    {
+        return allocations;
+    }
+
+    Registration::Registration(std::string inName, Func inFunc)
+    {
+        Internal::GetEntries().emplace_back(std::move(inName), std::move(inFunc));
+    }
+
+    int RunAll(int argc, char* argv[])
+    {
+        const auto options = Internal::ParseOptions(argc, argv);
+
+        std::vector<Internal::Result> results;
+        std::cout << std::format("{:<48}{:>14}{:>16}{:>14}{:>12}{:>16}", "name", "iterations", "ns/iter", "MB/s", "allocs/iter", "alloc B/iter") << std::endl;
+        for (const auto& entry : Internal::GetEntries()) {
+            if (!options.filter.empty() && entry.name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+
+            const auto& result = results.emplace_back(Internal::Measure(entry, options.minTime));
+            std::cout << std::format(
+                "{:<48}{:>14}{:>16.1f}{:>14.1f}{:>12.1f}{:>16.1f}",
+                result.name,
+                result.iterations,
+                result.nsPerIteration,
+                result.bytesPerSecond / (1024.0 * 1024.0),
+                result.allocationsPerIteration,
+                result.allocatedBytesPerIteration) << std::endl;
+        }
+
+        if (!options.jsonFile.empty()) {
+            Internal::WriteJson(options.jsonFile, results);
+        }
+        return 0;
+    }
+}
@@ -0,0 +1,10 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <Benchmark/Benchmark.h>
+
+int main(int argc, char* argv[])
+{
+    return Benchmark::RunAll(argc, argv);
+}
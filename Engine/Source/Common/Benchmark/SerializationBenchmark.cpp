@@ -0,0 +1,211 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <filesystem>
+#include <format>
+
+#include <rapidjson/stringbuffer.h>
+
+#include <Benchmark/Benchmark.h>
+#include <Common/Serialization.h>
+using namespace Common;
+
+using Primitives = std::vector<std::tuple<bool, int8_t, int32_t, uint64_t, float, double>>;
+using NestedMap = std::map<std::string, std::unordered_map<int32_t, std::vector<int32_t>>>;
+
+static const std::filesystem::path fileName = "../Benchmark/Generated/Common/SerializationBenchmark.bin";
+
+static const Primitives& GetPrimitives()
+{
+    static const Primitives primitives = []() -> Primitives {
+        Primitives result(4096);
+        for (auto i = 0; i < result.size(); i++) {
+            result[i] = { i % 2 == 0, static_cast<int8_t>(i), i * 37 - 50000, static_cast<uint64_t>(i) << 20, static_cast<float>(i) * 0.5f, static_cast<double>(i) * 0.25 };
+        }
+        return result;
+    }();
+    return primitives;
+}
+
+static const std::vector<float>& GetFloats()
+{
+    static const std::vector<float> floats = []() -> std::vector<float> {
+        std::vector<float> result(10000000);
+        for (auto i = 0; i < result.size(); i++) {
+            result[i] = static_cast<float>(i) * 0.5f;
+        }
+        return result;
+    }();
+    return floats;
+}
+
+static const NestedMap& GetNestedMap()
+{
+    static const NestedMap nestedMap = []() -> NestedMap {
+        NestedMap result;
+        for (auto i = 0; i < 100; i++) {
+            auto& inner = result[std::format("key{}", i)];
+            for (auto j = 0; j < 100; j++) {
+                inner[j * 7] = std::vector<int32_t>(8, i * j);
+            }
+        }
+        return result;
+    }();
+    return nestedMap;
+}
+
+template <typename T>
+static void BinaryMemoryWrite(Benchmark::State& state, const T& inValue, SerializeIntEncoding inEncoding)
+{
+    std::vector<uint8_t> buffer;
+    while (state.Next()) {
+        buffer.clear();
+        MemorySerializeStream stream(buffer);
+        WriteSerializeHeader(stream, inEncoding);
+        Serialize(stream, inValue);
+    }
+    state.SetBytesPerIteration(buffer.size());
+}
+
+template <typename T>
+static void BinaryMemoryRead(Benchmark::State& state, const T& inValue, SerializeIntEncoding inEncoding)
+{
+    std::vector<uint8_t> buffer;
+    {
+        MemorySerializeStream stream(buffer);
+        WriteSerializeHeader(stream, inEncoding);
+        Serialize(stream, inValue);
+    }
+
+    T value;
+    while (state.Next()) {
+        MemoryDeserializeStream stream(buffer);
+        ReadSerializeHeader(stream);
+        Deserialize(stream, value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(buffer.size());
+}
+
+template <typename T>
+static void BinaryFileWrite(Benchmark::State& state, const T& inValue)
+{
+    std::filesystem::create_directories(fileName.parent_path());
+    while (state.Next()) {
+        BinaryFileSerializeStream stream(fileName.string());
+        Serialize(stream, inValue);
+    }
+    state.SetBytesPerIteration(std::filesystem::file_size(fileName));
+}
+
+template <typename T, typename Stream>
+static void BinaryFileRead(Benchmark::State& state, const T& inValue)
+{
+    std::filesystem::create_directories(fileName.parent_path());
+    {
+        BinaryFileSerializeStream stream(fileName.string());
+        Serialize(stream, inValue);
+    }
+
+    T value;
+    while (state.Next()) {
+        Stream stream(fileName.string());
+        Deserialize(stream, value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(std::filesystem::file_size(fileName));
+}
+
+template <typename T>
+static void JsonDomWrite(Benchmark::State& state, const T& inValue)
+{
+    size_t size = 0;
+    while (state.Next()) {
+        rapidjson::Document document;
+        rapidjson::Value jsonValue;
+        JsonSerialize(jsonValue, document.GetAllocator(), inValue);
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer writer(buffer);
+        jsonValue.Accept(writer);
+        size = buffer.GetSize();
+    }
+    state.SetBytesPerIteration(size);
+}
+
+template <typename T>
+static void JsonDomRead(Benchmark::State& state, const T& inValue)
+{
+    JsonWriter writer;
+    JsonWrite(writer, inValue);
+    const std::string json(writer.Str());
+
+    T value;
+    while (state.Next()) {
+        rapidjson::Document document;
+        document.Parse(json.c_str());
+        JsonDeserialize(document, value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(json.size());
+}
+
+template <typename T>
+static void JsonStreamWrite(Benchmark::State& state, const T& inValue)
+{
+    size_t size = 0;
+    while (state.Next()) {
+        JsonWriter writer;
+        JsonWrite(writer, inValue);
+        size = writer.Str().size();
+    }
+    state.SetBytesPerIteration(size);
+}
+
+template <typename T>
+static void JsonStreamRead(Benchmark::State& state, const T& inValue)
+{
+    JsonWriter writer;
+    JsonWrite(writer, inValue);
+    const std::string json(writer.Str());
+
+    T value;
+    while (state.Next()) {
+        JsonReader reader(json);
+        JsonRead(reader, value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(json.size());
+}
+
+BENCHMARK(BinaryMemoryWritePrimitivesFixed) { BinaryMemoryWrite(state, GetPrimitives(), SerializeIntEncoding::fixed); }
+BENCHMARK(BinaryMemoryWritePrimitivesVarInt) { BinaryMemoryWrite(state, GetPrimitives(), SerializeIntEncoding::varint); }
+BENCHMARK(BinaryMemoryReadPrimitivesFixed) { BinaryMemoryRead(state, GetPrimitives(), SerializeIntEncoding::fixed); }
+BENCHMARK(BinaryMemoryReadPrimitivesVarInt) { BinaryMemoryRead(state, GetPrimitives(), SerializeIntEncoding::varint); }
+BENCHMARK(BinaryMemoryWriteFloatVector) { BinaryMemoryWrite(state, GetFloats(), SerializeIntEncoding::fixed); }
+BENCHMARK(BinaryMemoryReadFloatVector) { BinaryMemoryRead(state, GetFloats(), SerializeIntEncoding::fixed); }
+BENCHMARK(BinaryMemoryWriteNestedMapFixed) { BinaryMemoryWrite(state, GetNestedMap(), SerializeIntEncoding::fixed); }
+BENCHMARK(BinaryMemoryWriteNestedMapVarInt) { BinaryMemoryWrite(state, GetNestedMap(), SerializeIntEncoding::varint); }
+BENCHMARK(BinaryMemoryReadNestedMapFixed) { BinaryMemoryRead(state, GetNestedMap(), SerializeIntEncoding::fixed); }
+BENCHMARK(BinaryMemoryReadNestedMapVarInt) { BinaryMemoryRead(state, GetNestedMap(), SerializeIntEncoding::varint); }
+
+BENCHMARK(BinaryFileWriteFloatVector) { BinaryFileWrite(state, GetFloats()); }
+BENCHMARK(BinaryFileReadFloatVector) { BinaryFileRead<std::vector<float>, BinaryFileDeserializeStream<>>(state, GetFloats()); }
+BENCHMARK(MappedFileReadFloatVector) { BinaryFileRead<std::vector<float>, MappedFileDeserializeStream<>>(state, GetFloats()); }
+BENCHMARK(BinaryFileWriteNestedMap) { BinaryFileWrite(state, GetNestedMap()); }
+BENCHMARK(BinaryFileReadNestedMap) { BinaryFileRead<NestedMap, BinaryFileDeserializeStream<>>(state, GetNestedMap()); }
+BENCHMARK(MappedFileReadNestedMap) { BinaryFileRead<NestedMap, MappedFileDeserializeStream<>>(state, GetNestedMap()); }
+
+BENCHMARK(JsonDomWritePrimitives) { JsonDomWrite(state, GetPrimitives()); }
+BENCHMARK(JsonDomReadPrimitives) { JsonDomRead(state, GetPrimitives()); }
+BENCHMARK(JsonStreamWritePrimitives) { JsonStreamWrite(state, GetPrimitives()); }
+BENCHMARK(JsonStreamReadPrimitives) { JsonStreamRead(state, GetPrimitives()); }
+BENCHMARK(JsonDomWriteFloatVector) { JsonDomWrite(state, GetFloats()); }
+BENCHMARK(JsonDomReadFloatVector) { JsonDomRead(state, GetFloats()); }
+BENCHMARK(JsonStreamWriteFloatVector) { JsonStreamWrite(state, GetFloats()); }
+BENCHMARK(JsonStreamReadFloatVector) { JsonStreamRead(state, GetFloats()); }
+BENCHMARK(JsonDomWriteNestedMap) { JsonDomWrite(state, GetNestedMap()); }
+BENCHMARK(JsonDomReadNestedMap) { JsonDomRead(state, GetNestedMap()); }
+BENCHMARK(JsonStreamWriteNestedMap) { JsonStreamWrite(state, GetNestedMap()); }
+BENCHMARK(JsonStreamReadNestedMap) { JsonStreamRead(state, GetNestedMap()); }
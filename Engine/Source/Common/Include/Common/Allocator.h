@@ -0,0 +1,305 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+#include <new>
+
+#include <Common/Utility.h>
+#include <Common/Debug.h>
+
+namespace Common {
+    // bump-pointer allocator, memory is released wholesale by Rewind() or Reset(), destructors of allocated objects are never called by allocator,
+    // standard sized pages are recycled through a global page pool, so a steady-state workload makes nearly no heap allocation, not thread-safe
+    class LinearAllocator {
+    public:
+        static constexpr size_t defaultPageSize = 64 * 1024;
+
+        struct Marker {
+            void* page;
+            uint8_t* cursor;
+            size_t usedBytes;
+        };
+
+        NonCopyable(LinearAllocator)
+        NonMovable(LinearAllocator)
+        explicit LinearAllocator(size_t inPageSize = defaultPageSize);
+        ~LinearAllocator();
+
+        void* Allocate(size_t inSize, size_t inAlignment = alignof(std::max_align_t));
+        template <typename T, typename... Args> T* New(Args&&... inArgs);
+        Marker Mark() const;
+        void Rewind(const Marker& inMarker);
+        void Reset();
+        size_t UsedBytes() const;
+        size_t PageSize() const;
+
+    private:
+        struct Page {
+            Page* prev;
+            size_t size;
+        };
+
+        static constexpr size_t pageHeaderSize = (sizeof(Page) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+        void AcquirePage(size_t inMinDataSize);
+        void ReleasePage(Page* inPage);
+
+        size_t pageSize;
+        Page* currentPage;
+        Page* freePages;
+        uint8_t* cursor;
+        uint8_t* end;
+        size_t usedBytes;
+    };
+
+    // thread-local linear allocator for frame-scoped data, each thread resets its own arena at the end of its frame,
+    // memory allocated from frame arena must not be held across frames
+    class FrameArena {
+    public:
+        static LinearAllocator& Get();
+        static void* Allocate(size_t inSize, size_t inAlignment = alignof(std::max_align_t));
+        static void Reset();
+    };
+
+    // rewind current thread's frame arena on scope exit, useful for scratch data
+    class FrameArenaMark {
+    public:
+        NonCopyable(FrameArenaMark)
+        NonMovable(FrameArenaMark)
+        FrameArenaMark();
+        ~FrameArenaMark();
+
+    private:
+        LinearAllocator::Marker marker;
+    };
+
+    // stl allocator adaptor of current thread's frame arena, deallocate is a no-op
+    template <typename T>
+    class FrameAllocator {
+    public:
+        using value_type = T;
+
+        FrameAllocator() noexcept;
+        template <typename U> FrameAllocator(const FrameAllocator<U>& inOther) noexcept; // NOLINT
+
+        T* allocate(size_t inNum); // NOLINT
+        void deallocate(T* inPtr, size_t inNum) noexcept; // NOLINT
+        template <typename U> bool operator==(const FrameAllocator<U>& inRhs) const noexcept;
+        template <typename U> bool operator!=(const FrameAllocator<U>& inRhs) const noexcept;
+    };
+
+    // stl allocator adaptor of a specified linear allocator, deallocate is a no-op
+    template <typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(LinearAllocator& inAllocator) noexcept;
+        template <typename U> ArenaAllocator(const ArenaAllocator<U>& inOther) noexcept; // NOLINT
+
+        T* allocate(size_t inNum); // NOLINT
+        void deallocate(T* inPtr, size_t inNum) noexcept; // NOLINT
+        LinearAllocator& GetAllocator() const;
+        template <typename U> bool operator==(const ArenaAllocator<U>& inRhs) const noexcept;
+        template <typename U> bool operator!=(const ArenaAllocator<U>& inRhs) const noexcept;
+
+    private:
+        template <typename U> friend class ArenaAllocator;
+
+        LinearAllocator* allocator;
+    };
+
+    enum class MemoryTag : uint8_t {
+        general,
+        container,
+        delegate,
+        reflection,
+        ecs,
+        render,
+        asset,
+        max
+    };
+
+    struct MemoryTagStats {
+        int64_t bytes;
+        int64_t allocations;
+    };
+
+    // size-class allocator for small objects, each thread allocates and frees from its own cache, caches exchange free blocks with the central
+    // lists in batches, so frees from another thread never touch the allocating thread's cache, sizes exceed maxSmallSize go to global heap
+    class SmallObjectAllocator {
+    public:
+        static constexpr size_t maxSmallSize = 512;
+
+        static void* Allocate(size_t inSize, MemoryTag inTag = MemoryTag::general);
+        static void Deallocate(void* inPtr, size_t inSize, MemoryTag inTag = MemoryTag::general);
+        static MemoryTagStats GetStats(MemoryTag inTag);
+        // return blocks cached by current thread to central lists
+        static void FlushThreadCache();
+    };
+
+    // stl allocator adaptor of small object allocator
+    template <typename T, MemoryTag Tag = MemoryTag::container>
+    class PooledAllocator {
+    public:
+        using value_type = T;
+        template <typename U> struct rebind { using other = PooledAllocator<U, Tag>; }; // NOLINT
+
+        PooledAllocator() noexcept;
+        template <typename U> PooledAllocator(const PooledAllocator<U, Tag>& inOther) noexcept; // NOLINT
+
+        T* allocate(size_t inNum); // NOLINT
+        void deallocate(T* inPtr, size_t inNum) noexcept; // NOLINT
+        template <typename U> bool operator==(const PooledAllocator<U, Tag>& inRhs) const noexcept;
+        template <typename U> bool operator!=(const PooledAllocator<U, Tag>& inRhs) const noexcept;
+    };
+
+    namespace Internal {
+        struct PooledObjectBase {};
+    }
+
+    // derive from it to make new/delete, MakeUnique and MakeShared of the class allocate from small object allocator
+    template <MemoryTag Tag = MemoryTag::general>
+    class PooledObject : public Internal::PooledObjectBase {
+    public:
+        static constexpr MemoryTag memoryTag = Tag;
+
+        static void* operator new(size_t inSize);
+        static void operator delete(void* inPtr, size_t inSize);
+    };
+
+    template <typename T>
+    concept PooledObjectType = std::is_base_of_v<Internal::PooledObjectBase, T>;
+}
+
+namespace Common {
+    template <typename T, typename... Args>
+    T* LinearAllocator::New(Args&&... inArgs)
+    {
+        return new(Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(inArgs)...);
+    }
+
+    template <typename T>
+    FrameAllocator<T>::FrameAllocator() noexcept = default;
+
+    template <typename T>
+    template <typename U>
+    FrameAllocator<T>::FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+    template <typename T>
+    T* FrameAllocator<T>::allocate(size_t inNum)
+    {
+        return static_cast<T*>(FrameArena::Allocate(sizeof(T) * inNum, alignof(T)));
+    }
+
+    template <typename T>
+    void FrameAllocator<T>::deallocate(T*, size_t) noexcept {}
+
+    template <typename T>
+    template <typename U>
+    bool FrameAllocator<T>::operator==(const FrameAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename T>
+    template <typename U>
+    bool FrameAllocator<T>::operator!=(const FrameAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+
+    template <typename T>
+    ArenaAllocator<T>::ArenaAllocator(LinearAllocator& inAllocator) noexcept
+        : allocator(&inAllocator)
+    {
+    }
+
+    template <typename T>
+    template <typename U>
+    ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& inOther) noexcept
+        : allocator(inOther.allocator)
+    {
+    }
+
+    template <typename T>
+    T* ArenaAllocator<T>::allocate(size_t inNum)
+    {
+        return static_cast<T*>(allocator->Allocate(sizeof(T) * inNum, alignof(T)));
+    }
+
+    template <typename T>
+    void ArenaAllocator<T>::deallocate(T*, size_t) noexcept {}
+
+    template <typename T>
+    LinearAllocator& ArenaAllocator<T>::GetAllocator() const
+    {
+        return *allocator;
+    }
+
+    template <typename T>
+    template <typename U>
+    bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& inRhs) const noexcept
+    {
+        return allocator == inRhs.allocator;
+    }
+
+    template <typename T>
+    template <typename U>
+    bool ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& inRhs) const noexcept
+    {
+        return allocator != inRhs.allocator;
+    }
+
+    template <typename T, MemoryTag Tag>
+    PooledAllocator<T, Tag>::PooledAllocator() noexcept = default;
+
+    template <typename T, MemoryTag Tag>
+    template <typename U>
+    PooledAllocator<T, Tag>::PooledAllocator(const PooledAllocator<U, Tag>&) noexcept {}
+
+    template <typename T, MemoryTag Tag>
+    T* PooledAllocator<T, Tag>::allocate(size_t inNum)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+        return static_cast<T*>(SmallObjectAllocator::Allocate(sizeof(T) * inNum, Tag));
+    }
+
+    template <typename T, MemoryTag Tag>
+    void PooledAllocator<T, Tag>::deallocate(T* inPtr, size_t inNum) noexcept
+    {
+        SmallObjectAllocator::Deallocate(inPtr, sizeof(T) * inNum, Tag);
+    }
+
+    template <typename T, MemoryTag Tag>
+    template <typename U>
+    bool PooledAllocator<T, Tag>::operator==(const PooledAllocator<U, Tag>&) const noexcept
+    {
+        return true;
+    }
+
+    template <typename T, MemoryTag Tag>
+    template <typename U>
+    bool PooledAllocator<T, Tag>::operator!=(const PooledAllocator<U, Tag>&) const noexcept
+    {
+        return false;
+    }
+
+    template <MemoryTag Tag>
+    void* PooledObject<Tag>::operator new(size_t inSize)
+    {
+        return SmallObjectAllocator::Allocate(inSize, Tag);
+    }
+
+    template <MemoryTag Tag>
+    void PooledObject<Tag>::operator delete(void* inPtr, size_t inSize)
+    {
+        SmallObjectAllocator::Deallocate(inPtr, inSize, Tag);
+    }
+}
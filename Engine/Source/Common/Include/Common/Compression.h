@@ -0,0 +1,20 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace Common {
+    class CompressionUtils {
+    public:
+        // worst case compressed size of inSize bytes
+        static size_t LzCompressBound(size_t inSize);
+        // fast lz77 codec producing lz4 block format, returns compressed size, or 0 when output does not fit in inDstCapacity
+        static size_t LzCompress(const void* inSrc, size_t inSrcSize, void* outDst, size_t inDstCapacity);
+        // decoded size must be exactly inDstSize, returns false on malformed input
+        static bool LzDecompress(const void* inSrc, size_t inSrcSize, void* outDst, size_t inDstSize);
+    };
+}
@@ -6,16 +6,22 @@
 
 #include <vector>
 #include <queue>
+#include <array>
 #include <mutex>
+#include <atomic>
 #include <thread>
 #include <future>
 #include <memory>
+#include <cstddef>
 #include <functional>
 #include <type_traits>
+#include <bit>
+#include <list>
 
 #include <Common/String.h>
 #include <Common/Debug.h>
 #include <Common/Utility.h>
+#include <Common/Container.h>
 
 namespace Common {
     class NamedThread {
@@ -43,6 +49,12 @@ namespace Common {
         template <typename F, typename... Args>
         auto EmplaceTask(F&& task, Args&&... args);
 
+        // fire-and-forget, no future will be created
+        template <typename F>
+        void DispatchTask(F&& task);
+
+        uint8_t ThreadNum() const;
+
     private:
         bool stop;
         std::mutex mutex;
@@ -51,9 +63,52 @@ namespace Common {
         std::queue<std::function<void()>> tasks;
     };
 
+    // bounded lock-free command queue, commands are placement constructed into preallocated slots and consumed in order by a single consumer,
+    // commands larger than the slot fall back to heap
+    template <bool MultiProducer = true, size_t SlotSize = 64>
+    class CommandRing {
+    public:
+        NonCopyable(CommandRing)
+        NonMovable(CommandRing)
+        explicit CommandRing(size_t inCapacity);
+        ~CommandRing();
+
+        template <typename F> bool TryEmplace(F&& inCommand);
+        template <typename F> void Emplace(F&& inCommand);
+        // consumer side
+        bool TryExecuteOne();
+        size_t ExecuteAll();
+        bool Empty() const;
+        size_t Capacity() const;
+        // total number of commands enqueued (including in flight ones) / executed since creation
+        size_t EnqueuedNum() const;
+        size_t DequeuedNum() const;
+
+    private:
+        // execute (optional) and destruct the command stored in memory
+        using Executor = void(*)(void*, bool);
+
+        struct alignas(64) Slot {
+            std::atomic<size_t> sequence;
+            Executor executor;
+            alignas(std::max_align_t) std::array<uint8_t, SlotSize> memory;
+        };
+
+        template <typename C> static void ExecuteInplace(void* inMemory, bool inExecute);
+        template <typename C> static void ExecuteHeap(void* inMemory, bool inExecute);
+
+        size_t mask;
+        std::unique_ptr<Slot[]> slots;
+        alignas(64) std::atomic<size_t> enqueuePos;
+        alignas(64) std::atomic<size_t> dequeuePos;
+    };
+
+    using SpscCommandRing = CommandRing<false>;
+    using MpscCommandRing = CommandRing<true>;
+
     class WorkerThread {
     public:
-        explicit WorkerThread(const std::string& name);
+        explicit WorkerThread(const std::string& name, size_t inCommandCapacity = 4096);
         ~WorkerThread();
 
         void Flush();
@@ -61,14 +116,87 @@ namespace Common {
         template <typename F, typename... Args>
         auto EmplaceTask(F&& task, Args&&... args);
 
+        // fire-and-forget, no future will be created
+        template <typename F, typename... Args>
+        void DispatchTask(F&& task, Args&&... args);
+
     private:
-        bool stop;
-        bool flush;
-        std::mutex mutex;
-        std::condition_variable taskCondition;
-        std::condition_variable flushCondition;
+        template <typename F> void EmplaceCommand(F&& inCommand);
+        bool IsCurrentThread() const;
+        size_t ExecuteCommands();
+        void Notify();
+
+        std::atomic<bool> stop;
+        std::atomic<bool> sleeping;
+        std::atomic<uint32_t> signal;
+        MpscCommandRing commands;
+        // commands enqueued by worker itself when ring is full, worker can not wait for itself to free a slot. each one is tagged with
+        // ring enqueued num at spill time and runs once ring is consumed up to it, so order against other producers is kept.
+        // only touched by worker thread
+        std::queue<std::pair<size_t, std::function<void()>>> overflowCommands;
         NamedThread thread;
-        std::queue<std::function<void()>> tasks;
+    };
+
+    struct CacheStats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        size_t size;
+    };
+
+    // lock-striped cache, keys are spread over ShardNum independently locked LRU lists. eviction only happens in Tick(),
+    // entries used in the last inRetainFrames frames are never evicted so that pointers obtained in flight frames stay valid.
+    // an entry is evicted when its shard exceeds capacity (LRU) or it is idle for more than inMaxIdleFrames, 0 disables each of them
+    template <typename K, typename V, typename Hash = std::hash<K>, size_t ShardNum = 16>
+    class ShardedLruCache {
+    public:
+        static_assert(std::has_single_bit(ShardNum));
+
+        NonCopyable(ShardedLruCache)
+        NonMovable(ShardedLruCache)
+        explicit ShardedLruCache(size_t inCapacity = 0, uint64_t inMaxIdleFrames = 0, uint64_t inRetainFrames = 3);
+        ~ShardedLruCache();
+
+        // inCreator() is invoked with the shard locked, it must not access this cache
+        template <typename F> V& GetOrCreate(const K& inKey, F&& inCreator);
+        // same as GetOrCreate(), and inVisitor(V&) is invoked before the shard is unlocked, for values which are mutated after creation
+        template <typename F, typename A> decltype(auto) Visit(const K& inKey, F&& inCreator, A&& inVisitor);
+        bool Erase(const K& inKey);
+        template <typename P> size_t EraseIf(P&& inPredicate);
+        void Clear();
+        // advance frame and perform eviction, returns evicted entry count
+        size_t Tick();
+        void SetCapacity(size_t inCapacity);
+        void SetMaxIdleFrames(uint64_t inMaxIdleFrames);
+        size_t Capacity() const;
+        size_t Size() const;
+        uint64_t Frame() const;
+        CacheStats GetStats() const;
+
+    private:
+        struct Entry {
+            K key;
+            V value;
+            uint64_t lastUsedFrame;
+        };
+
+        struct alignas(64) Shard {
+            mutable std::mutex mutex;
+            // most recently used at front
+            std::list<Entry> lru;
+            FlatHashMap<K, typename std::list<Entry>::iterator, Hash> map;
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+            uint64_t evictions = 0;
+        };
+
+        Shard& GetShard(const K& inKey);
+
+        std::atomic<size_t> capacity;
+        std::atomic<uint64_t> maxIdleFrames;
+        uint64_t retainFrames;
+        std::atomic<uint64_t> frame;
+        std::array<Shard, ShardNum> shards;
     };
 }
 
@@ -97,18 +225,382 @@ namespace Common {
         return result;
     }
 
-    template <typename F, typename... Args>
-    auto WorkerThread::EmplaceTask(F&& task, Args&& ... args)
+    template <typename F>
+    void ThreadPool::DispatchTask(F&& task)
     {
-        using RetType = std::invoke_result_t<F, Args...>;
-        auto packagedTask = std::make_shared<std::packaged_task<RetType()>>(std::bind(std::forward<F>(task), std::forward<Args>(args)...));
-        auto result = packagedTask->get_future();
         {
             std::unique_lock lock(mutex);
             Assert(!stop);
-            tasks.emplace([packagedTask]() -> void { (*packagedTask)(); });
+            tasks.emplace(std::forward<F>(task));
+        }
+        condition.notify_one();
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    CommandRing<MultiProducer, SlotSize>::CommandRing(size_t inCapacity)
+        : mask(std::bit_ceil(inCapacity) - 1)
+        , slots(std::make_unique<Slot[]>(mask + 1))
+        , enqueuePos(0)
+        , dequeuePos(0)
+    {
+        Assert(inCapacity > 0);
+        for (size_t i = 0; i <= mask; i++) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+            slots[i].executor = nullptr;
+        }
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    CommandRing<MultiProducer, SlotSize>::~CommandRing()
+    {
+        auto pos = dequeuePos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& slot = slots[pos & mask];
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            slot.executor(slot.memory.data(), false);
+            pos++;
+        }
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    template <typename F>
+    bool CommandRing<MultiProducer, SlotSize>::TryEmplace(F&& inCommand)
+    {
+        using CommandType = std::decay_t<F>;
+        static_assert(std::is_invocable_v<CommandType&>);
+
+        Slot* slot;
+        auto pos = enqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            slot = &slots[pos & mask];
+            const auto sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+            if (diff == 0) {
+                if constexpr (MultiProducer) {
+                    if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else {
+                    enqueuePos.store(pos + 1, std::memory_order_relaxed);
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        if constexpr (sizeof(CommandType) <= SlotSize && alignof(CommandType) <= alignof(std::max_align_t)) {
+            new(slot->memory.data()) CommandType(std::forward<F>(inCommand));
+            slot->executor = &ExecuteInplace<CommandType>;
+        } else {
+            new(slot->memory.data()) CommandType*(new CommandType(std::forward<F>(inCommand)));
+            slot->executor = &ExecuteHeap<CommandType>;
+        }
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    template <typename F>
+    void CommandRing<MultiProducer, SlotSize>::Emplace(F&& inCommand)
+    {
+        // command will only be consumed when slot acquired, so it is safe to forward it again
+        while (!TryEmplace(std::forward<F>(inCommand))) {
+            std::this_thread::yield();
+        }
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    bool CommandRing<MultiProducer, SlotSize>::TryExecuteOne()
+    {
+        const auto pos = dequeuePos.load(std::memory_order_relaxed);
+        auto& slot = slots[pos & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+        dequeuePos.store(pos + 1, std::memory_order_relaxed);
+        slot.executor(slot.memory.data(), true);
+        slot.sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    size_t CommandRing<MultiProducer, SlotSize>::ExecuteAll()
+    {
+        size_t count = 0;
+        while (TryExecuteOne()) {
+            count++;
+        }
+        return count;
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    bool CommandRing<MultiProducer, SlotSize>::Empty() const
+    {
+        const auto pos = dequeuePos.load(std::memory_order_relaxed);
+        return slots[pos & mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    size_t CommandRing<MultiProducer, SlotSize>::Capacity() const
+    {
+        return mask + 1;
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    size_t CommandRing<MultiProducer, SlotSize>::EnqueuedNum() const
+    {
+        return enqueuePos.load(std::memory_order_relaxed);
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    size_t CommandRing<MultiProducer, SlotSize>::DequeuedNum() const
+    {
+        return dequeuePos.load(std::memory_order_relaxed);
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    template <typename C>
+    void CommandRing<MultiProducer, SlotSize>::ExecuteInplace(void* inMemory, bool inExecute)
+    {
+        auto* command = static_cast<C*>(inMemory);
+        if (inExecute) {
+            (*command)();
+        }
+        command->~C();
+    }
+
+    template <bool MultiProducer, size_t SlotSize>
+    template <typename C>
+    void CommandRing<MultiProducer, SlotSize>::ExecuteHeap(void* inMemory, bool inExecute)
+    {
+        auto* command = *static_cast<C**>(inMemory);
+        if (inExecute) {
+            (*command)();
+        }
+        delete command;
+    }
+
+    template <typename F, typename... Args>
+    auto WorkerThread::EmplaceTask(F&& task, Args&& ... args)
+    {
+        using RetType = std::invoke_result_t<F, Args...>;
+        std::packaged_task<RetType()> packagedTask([task = std::forward<F>(task), ...args = std::forward<Args>(args)]() mutable -> RetType {
+            return std::invoke(task, args...);
+        });
+        auto result = packagedTask.get_future();
+        Assert(!stop.load(std::memory_order_relaxed));
+        EmplaceCommand([packagedTask = std::move(packagedTask)]() mutable -> void { packagedTask(); });
+        Notify();
+        return result;
+    }
+
+    template <typename F, typename... Args>
+    void WorkerThread::DispatchTask(F&& task, Args&& ... args)
+    {
+        Assert(!stop.load(std::memory_order_relaxed));
+        if constexpr (sizeof...(Args) == 0) {
+            EmplaceCommand(std::forward<F>(task));
+        } else {
+            EmplaceCommand([task = std::forward<F>(task), ...args = std::forward<Args>(args)]() mutable -> void {
+                std::invoke(task, args...);
+            });
+        }
+        Notify();
+    }
+
+    template <typename F>
+    void WorkerThread::EmplaceCommand(F&& inCommand)
+    {
+        if (!IsCurrentThread()) {
+            commands.Emplace(std::forward<F>(inCommand));
+            return;
+        }
+        // once a command spilled, later ones from worker spill too so that they keep their order
+        if (overflowCommands.empty() && commands.TryEmplace(std::forward<F>(inCommand))) {
+            return;
+        }
+        overflowCommands.emplace(commands.EnqueuedNum(), [command = std::make_shared<std::decay_t<F>>(std::forward<F>(inCommand))]() -> void {
+            (*command)();
+        });
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    ShardedLruCache<K, V, Hash, ShardNum>::ShardedLruCache(size_t inCapacity, uint64_t inMaxIdleFrames, uint64_t inRetainFrames)
+        : capacity(inCapacity)
+        , maxIdleFrames(inMaxIdleFrames)
+        , retainFrames(inRetainFrames)
+        , frame(0)
+    {
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    ShardedLruCache<K, V, Hash, ShardNum>::~ShardedLruCache() = default;
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    template <typename F>
+    V& ShardedLruCache<K, V, Hash, ShardNum>::GetOrCreate(const K& inKey, F&& inCreator)
+    {
+        return Visit(inKey, std::forward<F>(inCreator), [](V& inValue) -> V& { return inValue; });
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    template <typename F, typename A>
+    decltype(auto) ShardedLruCache<K, V, Hash, ShardNum>::Visit(const K& inKey, F&& inCreator, A&& inVisitor)
+    {
+        auto& shard = GetShard(inKey);
+        const auto currentFrame = frame.load(std::memory_order_relaxed);
+
+        std::unique_lock lock(shard.mutex);
+        if (const auto iter = shard.map.Find(inKey);
+            iter != shard.map.End()) {
+            auto entryIter = iter->second;
+            shard.lru.splice(shard.lru.begin(), shard.lru, entryIter);
+            entryIter->lastUsedFrame = currentFrame;
+            shard.hits++;
+            return inVisitor(entryIter->value);
+        }
+
+        shard.misses++;
+        shard.lru.emplace_front(Entry { inKey, inCreator(), currentFrame });
+        shard.map.Emplace(inKey, shard.lru.begin());
+        return inVisitor(shard.lru.front().value);
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    bool ShardedLruCache<K, V, Hash, ShardNum>::Erase(const K& inKey)
+    {
+        auto& shard = GetShard(inKey);
+        std::unique_lock lock(shard.mutex);
+        const auto iter = shard.map.Find(inKey);
+        if (iter == shard.map.End()) {
+            return false;
+        }
+        shard.lru.erase(iter->second);
+        shard.map.Erase(inKey);
+        return true;
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    template <typename P>
+    size_t ShardedLruCache<K, V, Hash, ShardNum>::EraseIf(P&& inPredicate)
+    {
+        size_t count = 0;
+        for (auto& shard : shards) {
+            std::unique_lock lock(shard.mutex);
+            for (auto iter = shard.lru.begin(); iter != shard.lru.end();) {
+                if (inPredicate(std::as_const(iter->key), std::as_const(iter->value))) {
+                    shard.map.Erase(iter->key);
+                    iter = shard.lru.erase(iter);
+                    count++;
+                } else {
+                    ++iter;
+                }
+            }
+        }
+        return count;
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    void ShardedLruCache<K, V, Hash, ShardNum>::Clear()
+    {
+        for (auto& shard : shards) {
+            std::unique_lock lock(shard.mutex);
+            shard.map.Clear();
+            shard.lru.clear();
+        }
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    size_t ShardedLruCache<K, V, Hash, ShardNum>::Tick()
+    {
+        const auto currentFrame = frame.fetch_add(1, std::memory_order_relaxed) + 1;
+        const auto totalCapacity = capacity.load(std::memory_order_relaxed);
+        const auto shardCapacity = (totalCapacity + ShardNum - 1) / ShardNum;
+        const auto idleFrames = maxIdleFrames.load(std::memory_order_relaxed);
+
+        size_t count = 0;
+        for (auto& shard : shards) {
+            std::unique_lock lock(shard.mutex);
+            while (!shard.lru.empty()) {
+                const auto& oldest = shard.lru.back();
+                const auto age = currentFrame - oldest.lastUsedFrame;
+                const bool overCapacity = totalCapacity != 0 && shard.lru.size() > shardCapacity;
+                const bool idle = idleFrames != 0 && age > idleFrames;
+                if (age < retainFrames || (!overCapacity && !idle)) {
+                    break;
+                }
+                shard.map.Erase(oldest.key);
+                shard.lru.pop_back();
+                shard.evictions++;
+                count++;
+            }
+        }
+        return count;
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    void ShardedLruCache<K, V, Hash, ShardNum>::SetCapacity(size_t inCapacity)
+    {
+        capacity.store(inCapacity, std::memory_order_relaxed);
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    void ShardedLruCache<K, V, Hash, ShardNum>::SetMaxIdleFrames(uint64_t inMaxIdleFrames)
+    {
+        maxIdleFrames.store(inMaxIdleFrames, std::memory_order_relaxed);
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    size_t ShardedLruCache<K, V, Hash, ShardNum>::Capacity() const
+    {
+        return capacity.load(std::memory_order_relaxed);
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    size_t ShardedLruCache<K, V, Hash, ShardNum>::Size() const
+    {
+        size_t result = 0;
+        for (const auto& shard : shards) {
+            std::unique_lock lock(shard.mutex);
+            result += shard.lru.size();
         }
-        taskCondition.notify_one();
         return result;
     }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    uint64_t ShardedLruCache<K, V, Hash, ShardNum>::Frame() const
+    {
+        return frame.load(std::memory_order_relaxed);
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    CacheStats ShardedLruCache<K, V, Hash, ShardNum>::GetStats() const
+    {
+        CacheStats result {};
+        for (const auto& shard : shards) {
+            std::unique_lock lock(shard.mutex);
+            result.hits += shard.hits;
+            result.misses += shard.misses;
+            result.evictions += shard.evictions;
+            result.size += shard.lru.size();
+        }
+        return result;
+    }
+
+    template <typename K, typename V, typename Hash, size_t ShardNum>
+    typename ShardedLruCache<K, V, Hash, ShardNum>::Shard& ShardedLruCache<K, V, Hash, ShardNum>::GetShard(const K& inKey)
+    {
+        if constexpr (ShardNum == 1) {
+            return shards[0];
+        } else {
+            // fibonacci hashing, high bits are well mixed even for pointer or already hashed keys
+            const auto hash = static_cast<uint64_t>(Hash {}(inKey)) * 0x9E3779B97F4A7C15ull;
+            return shards[hash >> (64 - std::countr_zero(ShardNum))];
+        }
+    }
 }
@@ -13,12 +13,28 @@
 #include <list>
 #include <functional>
 #include <iterator>
+#include <bit>
+#include <limits>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <tuple>
+#include <memory>
+#include <initializer_list>
+#include <type_traits>
 
 #include <Common/Debug.h>
 #include <Common/Concepts.h>
 #include <Common/Math/Common.h>
 #include <Common/Utility.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COMMON_FLAT_HASH_SSE2 1
+#else
+#define COMMON_FLAT_HASH_SSE2 0
+#endif
+
 namespace Common {
     class VectorUtils {
     public:
@@ -148,12 +164,117 @@ namespace Common {
         std::array<uint8_t, memorySize> memory;
     };
 
+    // vector which stores up to N elements inline and spills to heap when exceeds, useful for lists which almost always hold only
+    // a few elements, elements are contiguous so iterators are raw pointers, any growth invalidates pointers and iterators
+    template <typename T, size_t N>
+    class SmallVector {
+    public:
+        static_assert(N > 0);
+        using Iter = T*;
+        using ConstIter = const T*;
+
+        SmallVector();
+        explicit SmallVector(size_t inSize, const T& inDefault = {});
+        SmallVector(std::initializer_list<T> inValues);
+        template <std::input_iterator I> SmallVector(I inBegin, I inEnd);
+        ~SmallVector();
+
+        SmallVector(const SmallVector& inOther);
+        SmallVector(SmallVector&& inOther) noexcept;
+        SmallVector& operator=(const SmallVector& inOther);
+        SmallVector& operator=(SmallVector&& inOther) noexcept;
+
+        template <typename... Args> T& EmplaceBack(Args&&... inArgs);
+        T& PushBack(T&& inElement);
+        T& PushBack(const T& inElement);
+        T& Insert(size_t inIndex, const T& inElement);
+        T& Insert(size_t inIndex, T&& inElement);
+        void PopBack();
+        void Erase(size_t inIndex);
+        Iter Erase(ConstIter inIter);
+        void EraseSwapLast(size_t inIndex);
+        T& At(size_t inIndex);
+        const T& At(size_t inIndex) const;
+        T& Back();
+        const T& Back() const;
+        bool Empty() const;
+        void Resize(size_t inSize, const T& inDefault = {});
+        void Reserve(size_t inCapacity);
+        void Clear();
+        size_t Size() const;
+        size_t Capacity() const;
+        // true if elements are still stored in the inline buffer
+        bool IsInline() const;
+        T* Data();
+        const T* Data() const;
+        T& operator[](size_t inIndex);
+        const T& operator[](size_t inIndex) const;
+        explicit operator bool() const;
+        template <size_t N2> bool operator==(const SmallVector<T, N2>& inRhs) const;
+        std::vector<T> ToVector() const;
+        Iter Begin();
+        ConstIter Begin() const;
+        Iter End();
+        ConstIter End() const;
+        Iter begin();
+        ConstIter begin() const;
+        Iter end();
+        ConstIter end() const;
+
+    private:
+        T* InlineData();
+        void Grow(size_t inMinCapacity);
+        void Deallocate();
+
+        T* data;
+        size_t size;
+        size_t capacity;
+        alignas(T) std::array<uint8_t, sizeof(T) * N> inlineMemory;
+    };
+
+    namespace Internal {
+        // returns the index of first set bit at or after inBegin, or inBitNum if no bit is set
+        size_t FindNextSetBit(const uint64_t* inWords, size_t inBitNum, size_t inBegin);
+
+        // forward iterator over allocated slots of trunk, dead slots are skipped by scanning occupancy words
+        template <typename T, size_t N>
+        class TrunkIter {
+        public:
+            using iterator_category = std::forward_iterator_tag; // NOLINT
+            using value_type = std::remove_const_t<T>; // NOLINT
+            using difference_type = std::ptrdiff_t; // NOLINT
+            using pointer = T*; // NOLINT
+            using reference = T&; // NOLINT
+
+            TrunkIter();
+            TrunkIter(const uint64_t* inWords, T* inData, size_t inIndex);
+            template <typename T2> requires std::is_same_v<const T2, T> TrunkIter(const TrunkIter<T2, N>& inOther); // NOLINT
+
+            T& operator*() const;
+            T* operator->() const;
+            TrunkIter& operator++();
+            TrunkIter operator++(int);
+            template <typename T2> bool operator==(const TrunkIter<T2, N>& inRhs) const;
+            template <typename T2> bool operator!=(const TrunkIter<T2, N>& inRhs) const;
+            size_t Index() const;
+
+        private:
+            template <typename T2, size_t N2> friend class TrunkIter;
+
+            const uint64_t* words;
+            T* data;
+            size_t index;
+        };
+    }
+
     // container which perform inplace destruct and leave a slot for re-alloc when erase
     template <typename T, size_t N = 128>
     class Trunk {
     public:
         using TraverseFunc = std::function<void(T&)>;
         using ConstTraverseFunc = std::function<void(const T&)>;
+        using Iter = Internal::TrunkIter<T, N>;
+        using ConstIter = Internal::TrunkIter<const T, N>;
 
         static constexpr size_t Capacity();
 
@@ -172,8 +293,8 @@ namespace Common {
         const T* Try(size_t inIndex) const;
         T& At(size_t inIndex);
         const T& At(size_t inIndex) const;
-        void Each(const TraverseFunc& inFunc);
-        void Each(const ConstTraverseFunc& inFunc) const;
+        template <typename F> void Each(F&& inFunc);
+        template <typename F> void Each(F&& inFunc) const;
         bool HasFree() const;
         size_t Free() const;
         size_t Allocated() const;
@@ -182,27 +303,79 @@ namespace Common {
         explicit operator bool() const;
         T& operator[](size_t inIndex);
         const T& operator[](size_t inIndex) const;
+        Iter Begin();
+        ConstIter Begin() const;
+        Iter End();
+        ConstIter End() const;
+        Iter begin();
+        ConstIter begin() const;
+        Iter end();
+        ConstIter end() const;
 
     private:
         static constexpr size_t elemMemSize = sizeof(T);
         static constexpr size_t totalMemSize = elemMemSize * N;
+        static constexpr size_t wordBits = 64;
+        static constexpr size_t wordNum = (N + wordBits - 1) / wordBits;
         static bool Contains(size_t inIndex);
 
+        bool Test(size_t inIndex) const;
+        void Mark(size_t inIndex, bool inAllocated);
+        T* TypedData();
+        const T* TypedData() const;
         T& TypedMemory(size_t inIndex);
         const T& TypedMemory(size_t inIndex) const;
         template <typename... Args> void InplaceConstruct(size_t inIndex, Args&&... inArgs);
         void InplaceDestruct(size_t inIndex);
 
-        std::bitset<N> allocated;
-        std::array<uint8_t, totalMemSize> memory;
+        // one bit per slot, bits beyond N are always zero
+        std::array<uint64_t, wordNum> allocated {};
+        alignas(T) std::array<uint8_t, totalMemSize> memory;
     };
 
+    namespace Internal {
+        // forward iterator over all the allocated elements of trunk list, empty trunks are skipped
+        template <typename T, size_t N>
+        class TrunkListIter {
+        public:
+            using iterator_category = std::forward_iterator_tag; // NOLINT
+            using value_type = std::remove_const_t<T>; // NOLINT
+            using difference_type = std::ptrdiff_t; // NOLINT
+            using pointer = T*; // NOLINT
+            using reference = T&; // NOLINT
+            using TrunkType = Trunk<std::remove_const_t<T>, N>;
+            using ListIter = std::conditional_t<std::is_const_v<T>, typename std::list<TrunkType>::const_iterator, typename std::list<TrunkType>::iterator>;
+
+            TrunkListIter();
+            TrunkListIter(ListIter inTrunk, ListIter inTrunkEnd);
+            template <typename T2> requires std::is_same_v<const T2, T> TrunkListIter(const TrunkListIter<T2, N>& inOther); // NOLINT
+
+            T& operator*() const;
+            T* operator->() const;
+            TrunkListIter& operator++();
+            TrunkListIter operator++(int);
+            template <typename T2> bool operator==(const TrunkListIter<T2, N>& inRhs) const;
+            template <typename T2> bool operator!=(const TrunkListIter<T2, N>& inRhs) const;
+
+        private:
+            template <typename T2, size_t N2> friend class TrunkListIter;
+
+            void SkipEmptyTrunks();
+
+            ListIter trunk;
+            ListIter trunkEnd;
+            TrunkIter<T, N> elem;
+        };
+    }
+
     // pointer stable
     template <typename T, size_t N = 128>
     class TrunkList {
     public:
         using TraverseFunc = typename Trunk<T, N>::TraverseFunc;
         using ConstTraverseFunc = typename Trunk<T, N>::ConstTraverseFunc;
+        using Iter = Internal::TrunkListIter<T, N>;
+        using ConstIter = Internal::TrunkListIter<const T, N>;
 
         class ConstHandle {
         public:
@@ -215,7 +388,7 @@ namespace Common {
         private:
             friend class TrunkList;
 
-            void Valid();
+            bool Valid() const;
 
             const TrunkList* owner;
             const Trunk<T, N>* trunk;
@@ -234,7 +407,7 @@ namespace Common {
         private:
             friend class TrunkList;
 
-            void Valid();
+            bool Valid() const;
 
             TrunkList* owner;
             Trunk<T, N>* trunk;
@@ -251,14 +424,22 @@ namespace Common {
         template <typename... Args> Handle Emplace(Args&&... inArgs);
         void Erase(const Handle& inHandle);
         void Erase(const ConstHandle& inHandle);
-        void Each(const TraverseFunc& inFunc);
-        void Each(const ConstTraverseFunc& inFunc) const;
+        template <typename F> void Each(F&& inFunc);
+        template <typename F> void Each(F&& inFunc) const;
         void Reserve(size_t inIndex);
         size_t Allocated() const;
         size_t Capacity() const;
         size_t Free() const;
         bool Empty() const;
         explicit operator bool() const;
+        Iter Begin();
+        ConstIter Begin() const;
+        Iter End();
+        ConstIter End() const;
+        Iter begin();
+        ConstIter begin() const;
+        Iter end();
+        ConstIter end() const;
 
     private:
         std::list<Trunk<T, N>> trunks;
@@ -269,6 +450,9 @@ namespace Common {
     public:
         using TraverseFunc = std::function<void(const K&, V&)>;
         using ConstTraverseFunc = std::function<void(const K&, const V&)>;
+        using ValueType = std::pair<const K, V>;
+        using Iter = typename TrunkList<ValueType, N>::Iter;
+        using ConstIter = typename TrunkList<ValueType, N>::ConstIter;
 
         StableUnorderedMap();
         ~StableUnorderedMap();
@@ -277,8 +461,8 @@ namespace Common {
         NonMovable(StableUnorderedMap)
 
         template <typename... Args> V& Emplace(const K& inKey, Args&&... inValueArgs);
-        void Each(const TraverseFunc& inFunc);
-        void Each(const ConstTraverseFunc& inFunc) const;
+        template <typename F> void Each(F&& inFunc);
+        template <typename F> void Each(F&& inFunc) const;
         V& At(const K& inKey);
         const V& At(const K& inKey) const;
         bool Contains(const K& inKey) const;
@@ -286,13 +470,199 @@ namespace Common {
         void Reserve(size_t inCapacity);
         size_t Size() const;
         size_t Capacity() const;
+        // iterate in slot order, key-value pairs are stored together so traversal never touches the hash map
+        Iter Begin();
+        ConstIter Begin() const;
+        Iter End();
+        ConstIter End() const;
+        Iter begin();
+        ConstIter begin() const;
+        Iter end();
+        ConstIter end() const;
 
     private:
-        using ValuesContainer = TrunkList<V, N>;
+        using ValuesContainer = TrunkList<ValueType, N>;
 
         std::unordered_map<K, typename ValuesContainer::Handle, HashProvider, EqualTo> handleMap;
         ValuesContainer values;
     };
+
+    namespace Internal {
+        // control bytes of one probing group, a slot is full when its control byte is non-negative, which stores 7 bits of the hash
+        class FlatHashGroup {
+        public:
+            static constexpr size_t width = 16;
+            static constexpr int8_t empty = -128;
+            static constexpr int8_t deleted = -2;
+
+            explicit FlatHashGroup(const int8_t* inCtrl);
+            uint32_t Match(int8_t inH2) const;
+            uint32_t MatchEmpty() const;
+            uint32_t MatchEmptyOrDeleted() const;
+
+        private:
+#if COMMON_FLAT_HASH_SSE2
+            __m128i ctrl;
+#else
+            std::array<int8_t, width> ctrl;
+#endif
+        };
+
+        template <typename K, typename V>
+        struct FlatHashMapPolicy {
+            using KeyType = K;
+            using ValueType = std::pair<const K, V>;
+            static constexpr bool constIter = false;
+
+            static const K& Key(const ValueType& inValue);
+            static void Relocate(ValueType* inDst, ValueType* inSrc);
+        };
+
+        template <typename K>
+        struct FlatHashSetPolicy {
+            using KeyType = K;
+            using ValueType = K;
+            static constexpr bool constIter = true;
+
+            static const K& Key(const ValueType& inValue);
+            static void Relocate(ValueType* inDst, ValueType* inSrc);
+        };
+
+        template <typename T>
+        class FlatHashTableIter {
+        public:
+            using iterator_category = std::forward_iterator_tag; // NOLINT
+            using value_type = std::remove_const_t<T>; // NOLINT
+            using difference_type = std::ptrdiff_t; // NOLINT
+            using pointer = T*; // NOLINT
+            using reference = T&; // NOLINT
+
+            FlatHashTableIter();
+            FlatHashTableIter(const int8_t* inCtrl, const int8_t* inCtrlEnd, T* inSlot);
+            template <typename T2> requires std::is_same_v<const T2, T> FlatHashTableIter(const FlatHashTableIter<T2>& inOther); // NOLINT
+
+            T& operator*() const;
+            T* operator->() const;
+            FlatHashTableIter& operator++();
+            FlatHashTableIter operator++(int);
+            template <typename T2> bool operator==(const FlatHashTableIter<T2>& inRhs) const;
+            template <typename T2> bool operator!=(const FlatHashTableIter<T2>& inRhs) const;
+
+        private:
+            template <typename T2> friend class FlatHashTableIter;
+            template <typename P, typename H, typename E> friend class FlatHashTable;
+
+            void SkipNonFull();
+
+            const int8_t* ctrl;
+            const int8_t* ctrlEnd;
+            T* slot;
+        };
+
+        template <typename H, typename E>
+        concept FlatHashTransparent = requires { typename H::is_transparent; typename E::is_transparent; };
+
+        // open-addressing hash table with swiss table layout, control bytes are probed a group at a time, so most lookups touch
+        // one cache line of metadata and one slot, elements are stored inline and move on rehash, references and iterators are
+        // invalidated by insertion which triggers rehash
+        template <typename Policy, typename Hash, typename EqualTo>
+        class FlatHashTable {
+        public:
+            using KeyType = typename Policy::KeyType;
+            using ValueType = typename Policy::ValueType;
+            using Iter = FlatHashTableIter<std::conditional_t<Policy::constIter, const ValueType, ValueType>>;
+            using ConstIter = FlatHashTableIter<const ValueType>;
+
+            FlatHashTable();
+            FlatHashTable(std::initializer_list<ValueType> inValues);
+            ~FlatHashTable();
+
+            FlatHashTable(const FlatHashTable& inOther);
+            FlatHashTable(FlatHashTable&& inOther) noexcept;
+            FlatHashTable& operator=(const FlatHashTable& inOther);
+            FlatHashTable& operator=(FlatHashTable&& inOther) noexcept;
+
+            Iter Find(const KeyType& inKey);
+            ConstIter Find(const KeyType& inKey) const;
+            template <typename KeyLike> requires FlatHashTransparent<Hash, EqualTo> Iter Find(const KeyLike& inKey);
+            template <typename KeyLike> requires FlatHashTransparent<Hash, EqualTo> ConstIter Find(const KeyLike& inKey) const;
+            bool Contains(const KeyType& inKey) const;
+            template <typename KeyLike> requires FlatHashTransparent<Hash, EqualTo> bool Contains(const KeyLike& inKey) const;
+            size_t Erase(const KeyType& inKey);
+            Iter Erase(ConstIter inIter);
+            void Reserve(size_t inSize);
+            void Clear();
+            size_t Size() const;
+            size_t Capacity() const;
+            bool Empty() const;
+            Iter Begin();
+            ConstIter Begin() const;
+            Iter End();
+            ConstIter End() const;
+            Iter begin();
+            ConstIter begin() const;
+            Iter end();
+            ConstIter end() const;
+
+        protected:
+            static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+            template <typename KeyLike> size_t HashOf(const KeyLike& inKey) const;
+            template <typename KeyLike> size_t FindIndex(const KeyLike& inKey) const;
+            // construct callable receives the uninitialized slot and must construct a value which has the given key, it is called
+            // before old storage is released on growth, so arguments referencing existing elements stay valid
+            template <typename KeyLike, typename F> std::pair<Iter, bool> FindOrInsert(const KeyLike& inKey, F&& inConstruct);
+            Iter IterAt(size_t inIndex);
+            ConstIter IterAt(size_t inIndex) const;
+
+        private:
+            static size_t MaxLoad(size_t inCapacity);
+            static size_t CapacityForSize(size_t inSize);
+
+            size_t FindInsertSlot(size_t inHash) const;
+            void SetCtrl(size_t inIndex, int8_t inValue);
+            void EraseAt(size_t inIndex);
+            void Rehash(size_t inNewCapacity);
+            // inBeforeRelocate is called after new storage is allocated and before old elements are moved into it
+            template <typename F> void Rehash(size_t inNewCapacity, F&& inBeforeRelocate);
+            void DestroyAll();
+            void Deallocate();
+
+            int8_t* ctrl;
+            ValueType* slots;
+            size_t capacity;
+            size_t size;
+            size_t growthLeft;
+            [[no_unique_address]] Hash hash;
+            [[no_unique_address]] EqualTo equal;
+        };
+    }
+
+    template <typename K, typename V, typename Hash = std::hash<K>, typename EqualTo = std::equal_to<K>>
+    class FlatHashMap : public Internal::FlatHashTable<Internal::FlatHashMapPolicy<K, V>, Hash, EqualTo> {
+    public:
+        using Super = Internal::FlatHashTable<Internal::FlatHashMapPolicy<K, V>, Hash, EqualTo>;
+        using Iter = typename Super::Iter;
+        using ConstIter = typename Super::ConstIter;
+        using Super::Super;
+
+        // construct value only when key is not present
+        template <typename K2, typename... Args> std::pair<Iter, bool> Emplace(K2&& inKey, Args&&... inArgs);
+        V& At(const K& inKey);
+        const V& At(const K& inKey) const;
+        V& operator[](const K& inKey);
+    };
+
+    template <typename K, typename Hash = std::hash<K>, typename EqualTo = std::equal_to<K>>
+    class FlatHashSet : public Internal::FlatHashTable<Internal::FlatHashSetPolicy<K>, Hash, EqualTo> {
+    public:
+        using Super = Internal::FlatHashTable<Internal::FlatHashSetPolicy<K>, Hash, EqualTo>;
+        using Iter = typename Super::Iter;
+        using ConstIter = typename Super::ConstIter;
+        using Super::Super;
+
+        template <typename K2> std::pair<Iter, bool> Emplace(K2&& inKey);
+    };
 }
 
 namespace Common {
@@ -1061,496 +1431,1855 @@ namespace Common {
     }
 
     template <typename T, size_t N>
-    constexpr size_t Trunk<T, N>::Capacity()
+    SmallVector<T, N>::SmallVector()
+        : data(InlineData())
+        , size(0)
+        , capacity(N)
     {
-        return N;
     }
 
     template <typename T, size_t N>
-    Trunk<T, N>::Trunk() = default;
+    SmallVector<T, N>::SmallVector(size_t inSize, const T& inDefault)
+        : SmallVector()
+    {
+        Resize(inSize, inDefault);
+    }
 
     template <typename T, size_t N>
-    Trunk<T, N>::~Trunk()
+    SmallVector<T, N>::SmallVector(std::initializer_list<T> inValues)
+        : SmallVector(inValues.begin(), inValues.end())
     {
-        Clear();
     }
 
     template <typename T, size_t N>
-    Trunk<T, N>::Trunk(const Trunk& inOther)
-        : allocated(inOther.allocated)
-        , memory()
+    template <std::input_iterator I>
+    SmallVector<T, N>::SmallVector(I inBegin, I inEnd)
+        : SmallVector()
     {
-        for (auto i = 0; i < allocated.size(); i++) {
-            if (allocated.test(i)) {
-                InplaceConstruct(i, inOther.TypedMemory(i));
-            }
+        if constexpr (std::forward_iterator<I>) {
+            Reserve(std::distance(inBegin, inEnd));
+        }
+        for (auto iter = inBegin; iter != inEnd; ++iter) {
+            EmplaceBack(*iter);
         }
     }
 
     template <typename T, size_t N>
-    Trunk<T, N>::Trunk(Trunk&& inOther) noexcept
-        : allocated(std::move(inOther.allocated))
-        , memory()
+    SmallVector<T, N>::~SmallVector()
     {
-        for (auto i = 0; i < allocated.size(); i++) {
-            if (allocated.test(i)) {
-                InplaceConstruct(i, std::move(inOther.TypedMemory(i)));
-            }
-        }
+        Clear();
+        Deallocate();
     }
 
     template <typename T, size_t N>
-    Trunk<T, N>& Trunk<T, N>::operator=(const Trunk& inOther)
+    SmallVector<T, N>::SmallVector(const SmallVector& inOther)
+        : SmallVector(inOther.Begin(), inOther.End())
     {
-        auto oldAllocated = allocated;
-        allocated = inOther.allocated;
+    }
 
-        for (auto i = 0; i < allocated.size(); i++) {
-            if (oldAllocated.test(i) && !allocated.test(i)) {
-                InplaceDestruct(i);
-            }
-            if (!oldAllocated.test(i) && allocated.test(i)) {
-                InplaceConstruct(i, inOther.TypedMemory(i));
-            }
-            if (oldAllocated.test(i) && allocated.test(i)) {
-                TypedMemory(i) = inOther.TypedMemory(i);
-            }
+    template <typename T, size_t N>
+    SmallVector<T, N>::SmallVector(SmallVector&& inOther) noexcept
+        : SmallVector()
+    {
+        *this = std::move(inOther);
+    }
+
+    template <typename T, size_t N>
+    SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& inOther)
+    {
+        if (this == &inOther) {
+            return *this;
+        }
+        Clear();
+        Reserve(inOther.size);
+        for (const auto& element : inOther) {
+            new(data + size) T(element);
+            size++;
         }
         return *this;
     }
 
     template <typename T, size_t N>
-    Trunk<T, N>& Trunk<T, N>::operator=(Trunk&& inOther) noexcept
+    SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& inOther) noexcept
     {
-        auto oldAllocated = allocated;
-        allocated = inOther.allocated;
-
-        for (auto i = 0; i < allocated.size(); i++) {
-            if (oldAllocated.test(i) && !allocated.test(i)) {
-                InplaceDestruct(i);
-            }
-            if (!oldAllocated.test(i) && allocated.test(i)) {
-                InplaceConstruct(i, std::move(inOther.TypedMemory(i)));
-            }
-            if (oldAllocated.test(i) && allocated.test(i)) {
-                TypedMemory(i) = std::move(inOther.TypedMemory(i));
-            }
+        if (this == &inOther) {
+            return *this;
+        }
+        Clear();
+        if (!inOther.IsInline()) {
+            // steal heap buffer
+            Deallocate();
+            data = std::exchange(inOther.data, inOther.InlineData());
+            size = std::exchange(inOther.size, 0);
+            capacity = std::exchange(inOther.capacity, N);
+            return *this;
         }
+        for (auto i = 0; i < inOther.size; i++) {
+            new(data + i) T(std::move(inOther.data[i]));
+        }
+        size = inOther.size;
+        inOther.Clear();
         return *this;
     }
 
     template <typename T, size_t N>
-    template <typename ... Args>
-    size_t Trunk<T, N>::Emplace(Args&&... inArgs)
+    template <typename... Args>
+    T& SmallVector<T, N>::EmplaceBack(Args&&... inArgs)
     {
-        for (auto i = 0; i < allocated.size(); i++) {
-            if (!allocated.test(i)) {
-                allocated.set(i, true);
-                InplaceConstruct(i, std::forward<Args>(inArgs)...);
-                return i;
-            }
+        if (size < capacity) {
+            new(data + size) T(std::forward<Args>(inArgs)...);
+            return data[size++];
         }
-        QuickFailWithReason("container is full");
-        return 0;
+
+        // construct the new element before relocating, arguments may reference elements of this vector
+        const size_t newCapacity = std::max(capacity * 2, size + 1);
+        auto* newData = std::allocator<T>().allocate(newCapacity);
+        new(newData + size) T(std::forward<Args>(inArgs)...);
+        for (auto i = 0; i < size; i++) {
+            new(newData + i) T(std::move(data[i]));
+            data[i].~T();
+        }
+        Deallocate();
+        data = newData;
+        capacity = newCapacity;
+        return data[size++];
     }
 
     template <typename T, size_t N>
-    bool Trunk<T, N>::Valid(size_t inIndex) const
+    T& SmallVector<T, N>::PushBack(T&& inElement)
     {
-        if (!Contains(inIndex)) {
-            return false;
-        }
-        return allocated.test(inIndex);
+        return EmplaceBack(std::move(inElement));
     }
 
     template <typename T, size_t N>
-    void Trunk<T, N>::Erase(size_t inIndex)
+    T& SmallVector<T, N>::PushBack(const T& inElement)
     {
-        Assert(Valid(inIndex));
-        allocated.set(inIndex, false);
-        InplaceDestruct(inIndex);
+        return EmplaceBack(inElement);
     }
 
     template <typename T, size_t N>
-    T* Trunk<T, N>::Try(size_t inIndex)
+    T& SmallVector<T, N>::Insert(size_t inIndex, const T& inElement)
     {
-        return Valid(inIndex) ? &TypedMemory(inIndex) : nullptr;
+        Assert(inIndex <= size);
+        EmplaceBack(inElement);
+        std::rotate(data + inIndex, data + size - 1, data + size);
+        return data[inIndex];
     }
 
     template <typename T, size_t N>
-    const T* Trunk<T, N>::Try(size_t inIndex) const
+    T& SmallVector<T, N>::Insert(size_t inIndex, T&& inElement)
     {
-        return Valid(inIndex) ? &TypedMemory(inIndex) : nullptr;
+        Assert(inIndex <= size);
+        EmplaceBack(std::move(inElement));
+        std::rotate(data + inIndex, data + size - 1, data + size);
+        return data[inIndex];
     }
 
     template <typename T, size_t N>
-    T& Trunk<T, N>::At(size_t inIndex)
+    void SmallVector<T, N>::PopBack()
     {
-        Assert(Valid(inIndex));
-        return TypedMemory(inIndex);
+        Assert(size > 0);
+        data[--size].~T();
     }
 
     template <typename T, size_t N>
-    const T& Trunk<T, N>::At(size_t inIndex) const
+    void SmallVector<T, N>::Erase(size_t inIndex)
     {
-        Assert(Valid(inIndex));
-        return TypedMemory(inIndex);
+        Assert(inIndex < size);
+        std::move(data + inIndex + 1, data + size, data + inIndex);
+        PopBack();
     }
 
     template <typename T, size_t N>
-    void Trunk<T, N>::Each(const TraverseFunc& inFunc)
+    typename SmallVector<T, N>::Iter SmallVector<T, N>::Erase(ConstIter inIter)
     {
-        for (auto i = 0; i < allocated.size(); i++) {
-            if (allocated.test(i)) {
-                inFunc(TypedMemory(i));
-            }
-        }
+        const size_t index = inIter - data;
+        Erase(index);
+        return data + index;
     }
 
     template <typename T, size_t N>
-    void Trunk<T, N>::Each(const ConstTraverseFunc& inFunc) const
+    void SmallVector<T, N>::EraseSwapLast(size_t inIndex)
     {
-        for (auto i = 0; i < allocated.size(); i++) {
-            if (allocated.test(i)) {
-                inFunc(TypedMemory(i));
-            }
+        Assert(inIndex < size);
+        if (inIndex != size - 1) {
+            data[inIndex] = std::move(data[size - 1]);
         }
+        PopBack();
     }
 
     template <typename T, size_t N>
-    bool Trunk<T, N>::HasFree() const
+    T& SmallVector<T, N>::At(size_t inIndex)
     {
-        return Free() > 0;
+        Assert(inIndex < size);
+        return data[inIndex];
     }
 
     template <typename T, size_t N>
-    size_t Trunk<T, N>::Free() const
+    const T& SmallVector<T, N>::At(size_t inIndex) const
     {
-        return Capacity() - Allocated();
+        Assert(inIndex < size);
+        return data[inIndex];
     }
 
     template <typename T, size_t N>
-    size_t Trunk<T, N>::Allocated() const
+    T& SmallVector<T, N>::Back()
     {
-        return allocated.count();
+        return At(size - 1);
     }
 
     template <typename T, size_t N>
-    bool Trunk<T, N>::Empty() const
+    const T& SmallVector<T, N>::Back() const
     {
-        return Allocated() == 0;
+        return At(size - 1);
     }
 
     template <typename T, size_t N>
-    void Trunk<T, N>::Clear()
+    bool SmallVector<T, N>::Empty() const
     {
-        for (auto i = 0; i < allocated.size(); i++) {
-            if (allocated.test(i)) {
-                InplaceDestruct(i);
-            }
-        }
+        return size == 0;
     }
 
     template <typename T, size_t N>
-    Trunk<T, N>::operator bool() const
+    void SmallVector<T, N>::Resize(size_t inSize, const T& inDefault)
     {
-        return !Empty();
+        while (size > inSize) {
+            PopBack();
+        }
+        Reserve(inSize);
+        while (size < inSize) {
+            new(data + size) T(inDefault);
+            size++;
+        }
     }
 
     template <typename T, size_t N>
-    T& Trunk<T, N>::operator[](size_t inIndex)
+    void SmallVector<T, N>::Reserve(size_t inCapacity)
     {
-        return At(inIndex);
+        if (inCapacity > capacity) {
+            Grow(inCapacity);
+        }
     }
 
     template <typename T, size_t N>
-    const T& Trunk<T, N>::operator[](size_t inIndex) const
+    void SmallVector<T, N>::Clear()
     {
-        return At(inIndex);
+        for (auto i = 0; i < size; i++) {
+            data[i].~T();
+        }
+        size = 0;
     }
 
     template <typename T, size_t N>
-    bool Trunk<T, N>::Contains(size_t inIndex)
+    size_t SmallVector<T, N>::Size() const
     {
-        return inIndex < Capacity();
+        return size;
     }
 
     template <typename T, size_t N>
-    T& Trunk<T, N>::TypedMemory(size_t inIndex)
+    size_t SmallVector<T, N>::Capacity() const
     {
-        Assert(Contains(inIndex));
-        auto* data = reinterpret_cast<T*>(memory.data());
-        return data[inIndex];
+        return capacity;
     }
 
     template <typename T, size_t N>
-    const T& Trunk<T, N>::TypedMemory(size_t inIndex) const
+    bool SmallVector<T, N>::IsInline() const
     {
-        Assert(Contains(inIndex));
-        const auto* data = reinterpret_cast<const T*>(memory.data());
-        return data[inIndex];
+        return data == reinterpret_cast<const T*>(inlineMemory.data());
     }
 
     template <typename T, size_t N>
-    template <typename ... Args>
-    void Trunk<T, N>::InplaceConstruct(size_t inIndex, Args&&... inArgs)
+    T* SmallVector<T, N>::Data()
     {
-        new(&TypedMemory(inIndex)) T(std::forward<Args>(inArgs)...);
+        return data;
     }
 
     template <typename T, size_t N>
-    void Trunk<T, N>::InplaceDestruct(size_t inIndex)
+    const T* SmallVector<T, N>::Data() const
     {
-        TypedMemory(inIndex).~T();
+        return data;
     }
 
     template <typename T, size_t N>
-    TrunkList<T, N>::ConstHandle::ConstHandle(const TrunkList* inOwner, const Trunk<T, N>* inTrunk, size_t inIndex)
-        : owner(inOwner)
-        , trunk(inTrunk)
-        , index(inIndex)
+    T& SmallVector<T, N>::operator[](size_t inIndex)
     {
+        return At(inIndex);
     }
 
     template <typename T, size_t N>
-    TrunkList<T, N>::ConstHandle::operator bool() const
+    const T& SmallVector<T, N>::operator[](size_t inIndex) const
     {
-        return Valid();
+        return At(inIndex);
     }
 
     template <typename T, size_t N>
-    const T* TrunkList<T, N>::ConstHandle::operator->() const
+    SmallVector<T, N>::operator bool() const
     {
-        return trunk->Try(index);
+        return !Empty();
     }
 
     template <typename T, size_t N>
-    const T& TrunkList<T, N>::ConstHandle::operator*() const
+    template <size_t N2>
+    bool SmallVector<T, N>::operator==(const SmallVector<T, N2>& inRhs) const
     {
-        return trunk->At(index);
+        return std::equal(Begin(), End(), inRhs.Begin(), inRhs.End());
     }
 
     template <typename T, size_t N>
-    void TrunkList<T, N>::ConstHandle::Valid()
+    std::vector<T> SmallVector<T, N>::ToVector() const
     {
-        return trunk->Valid(index);
+        return std::vector<T>(Begin(), End());
     }
 
     template <typename T, size_t N>
-    TrunkList<T, N>::Handle::Handle(TrunkList* inOwner, Trunk<T, N>* inTrunk, size_t inIndex)
-        : owner(inOwner)
-        , trunk(inTrunk)
-        , index(inIndex)
+    typename SmallVector<T, N>::Iter SmallVector<T, N>::Begin()
     {
+        return data;
     }
 
     template <typename T, size_t N>
-    typename TrunkList<T, N>::ConstHandle TrunkList<T, N>::Handle::Const() const
+    typename SmallVector<T, N>::ConstIter SmallVector<T, N>::Begin() const
     {
-        return { trunk, index };
+        return data;
     }
 
     template <typename T, size_t N>
-    TrunkList<T, N>::Handle::operator bool() const
+    typename SmallVector<T, N>::Iter SmallVector<T, N>::End()
     {
-        return Valid();
+        return data + size;
     }
 
     template <typename T, size_t N>
-    T* TrunkList<T, N>::Handle::operator->() const
+    typename SmallVector<T, N>::ConstIter SmallVector<T, N>::End() const
     {
-        return trunk->Try(index);
+        return data + size;
     }
 
     template <typename T, size_t N>
-    T& TrunkList<T, N>::Handle::operator*() const
+    typename SmallVector<T, N>::Iter SmallVector<T, N>::begin()
     {
-        return trunk->At(index);
+        return Begin();
     }
 
     template <typename T, size_t N>
-    void TrunkList<T, N>::Handle::Valid()
+    typename SmallVector<T, N>::ConstIter SmallVector<T, N>::begin() const
     {
-        return trunk->Valid(index);
+        return Begin();
     }
 
     template <typename T, size_t N>
-    TrunkList<T, N>::TrunkList() = default;
+    typename SmallVector<T, N>::Iter SmallVector<T, N>::end()
+    {
+        return End();
+    }
 
     template <typename T, size_t N>
-    TrunkList<T, N>::~TrunkList() = default;
+    typename SmallVector<T, N>::ConstIter SmallVector<T, N>::end() const
+    {
+        return End();
+    }
 
     template <typename T, size_t N>
-    template <typename ... Args>
-    typename TrunkList<T, N>::Handle TrunkList<T, N>::Emplace(Args&&... inArgs)
+    T* SmallVector<T, N>::InlineData()
     {
-        Trunk<T, N>* allocator = nullptr;
-        for (auto& trunk : trunks) {
-            if (trunk.HasFree()) {
-                allocator = &trunk;
-                break;
-            }
+        return reinterpret_cast<T*>(inlineMemory.data());
+    }
+
+    template <typename T, size_t N>
+    void SmallVector<T, N>::Grow(size_t inMinCapacity)
+    {
+        const size_t newCapacity = std::max(capacity * 2, inMinCapacity);
+        auto* newData = std::allocator<T>().allocate(newCapacity);
+        for (auto i = 0; i < size; i++) {
+            new(newData + i) T(std::move(data[i]));
+            data[i].~T();
         }
-        if (allocator == nullptr) {
-            allocator = &trunks.emplace_back();
+        Deallocate();
+        data = newData;
+        capacity = newCapacity;
+    }
+
+    template <typename T, size_t N>
+    void SmallVector<T, N>::Deallocate()
+    {
+        if (!IsInline()) {
+            std::allocator<T>().deallocate(data, capacity);
         }
-        return { this, allocator, allocator->Emplace(std::forward<Args>(inArgs)...) };
+        data = InlineData();
+        capacity = N;
     }
 
     template <typename T, size_t N>
-    void TrunkList<T, N>::Erase(const Handle& inHandle)
+    constexpr size_t Trunk<T, N>::Capacity()
     {
-        Assert(this == inHandle.owner);
-        inHandle.trunk->Erase(inHandle.index);
+        return N;
     }
 
     template <typename T, size_t N>
-    void TrunkList<T, N>::Erase(const ConstHandle& inHandle)
+    Trunk<T, N>::Trunk() = default;
+
+    template <typename T, size_t N>
+    Trunk<T, N>::~Trunk()
     {
-        Assert(this == inHandle.owner);
-        inHandle.trunk->Erase(inHandle.index);
+        Clear();
     }
 
     template <typename T, size_t N>
-    void TrunkList<T, N>::Each(const TraverseFunc& inFunc)
+    Trunk<T, N>::Trunk(const Trunk& inOther)
+        : allocated(inOther.allocated)
+        , memory()
     {
-        for (auto& trunk : trunks) {
-            trunk.Each(inFunc);
+        for (auto iter = inOther.Begin(); iter != inOther.End(); ++iter) {
+            InplaceConstruct(iter.Index(), *iter);
         }
     }
 
     template <typename T, size_t N>
-    void TrunkList<T, N>::Each(const ConstTraverseFunc& inFunc) const
+    Trunk<T, N>::Trunk(Trunk&& inOther) noexcept
+        : allocated(inOther.allocated)
+        , memory()
     {
-        for (auto& trunk : trunks) {
-            trunk.Each(inFunc);
+        for (auto iter = inOther.Begin(); iter != inOther.End(); ++iter) {
+            InplaceConstruct(iter.Index(), std::move(*iter));
         }
     }
 
     template <typename T, size_t N>
-    void TrunkList<T, N>::Reserve(size_t inIndex)
+    Trunk<T, N>& Trunk<T, N>::operator=(const Trunk& inOther)
     {
-        auto trunkNum = DivideAndRoundUp(inIndex, N);
-        if (trunkNum <= trunks.size()) {
-            return;
+        auto oldAllocated = allocated;
+        allocated = inOther.allocated;
+
+        for (auto i = 0; i < N; i++) {
+            const bool oldTest = (oldAllocated[i / wordBits] >> (i % wordBits)) & 1;
+            if (oldTest && !Test(i)) {
+                InplaceDestruct(i);
+            }
+            if (!oldTest && Test(i)) {
+                InplaceConstruct(i, inOther.TypedMemory(i));
+            }
+            if (oldTest && Test(i)) {
+                TypedMemory(i) = inOther.TypedMemory(i);
+            }
         }
-        trunks.reserve(trunkNum);
+        return *this;
     }
 
     template <typename T, size_t N>
-    size_t TrunkList<T, N>::Allocated() const
+    Trunk<T, N>& Trunk<T, N>::operator=(Trunk&& inOther) noexcept
     {
-        size_t result = 0;
-        for (const auto& trunk : trunks) {
-            result += trunk.Allocated();
+        auto oldAllocated = allocated;
+        allocated = inOther.allocated;
+
+        for (auto i = 0; i < N; i++) {
+            const bool oldTest = (oldAllocated[i / wordBits] >> (i % wordBits)) & 1;
+            if (oldTest && !Test(i)) {
+                InplaceDestruct(i);
+            }
+            if (!oldTest && Test(i)) {
+                InplaceConstruct(i, std::move(inOther.TypedMemory(i)));
+            }
+            if (oldTest && Test(i)) {
+                TypedMemory(i) = std::move(inOther.TypedMemory(i));
+            }
         }
-        return result;
+        return *this;
     }
 
     template <typename T, size_t N>
-    size_t TrunkList<T, N>::Capacity() const
+    template <typename ... Args>
+    size_t Trunk<T, N>::Emplace(Args&&... inArgs)
     {
-        return trunks.size() * N;
+        for (auto w = 0; w < wordNum; w++) {
+            const size_t freeBit = std::countr_one(allocated[w]);
+            const size_t index = w * wordBits + freeBit;
+            if (freeBit < wordBits && index < N) {
+                Mark(index, true);
+                InplaceConstruct(index, std::forward<Args>(inArgs)...);
+                return index;
+            }
+        }
+        QuickFailWithReason("container is full");
+        return 0;
     }
 
     template <typename T, size_t N>
-    size_t TrunkList<T, N>::Free() const
+    bool Trunk<T, N>::Valid(size_t inIndex) const
+    {
+        if (!Contains(inIndex)) {
+            return false;
+        }
+        return Test(inIndex);
+    }
+
+    template <typename T, size_t N>
+    void Trunk<T, N>::Erase(size_t inIndex)
+    {
+        Assert(Valid(inIndex));
+        Mark(inIndex, false);
+        InplaceDestruct(inIndex);
+    }
+
+    template <typename T, size_t N>
+    T* Trunk<T, N>::Try(size_t inIndex)
+    {
+        return Valid(inIndex) ? &TypedMemory(inIndex) : nullptr;
+    }
+
+    template <typename T, size_t N>
+    const T* Trunk<T, N>::Try(size_t inIndex) const
+    {
+        return Valid(inIndex) ? &TypedMemory(inIndex) : nullptr;
+    }
+
+    template <typename T, size_t N>
+    T& Trunk<T, N>::At(size_t inIndex)
+    {
+        Assert(Valid(inIndex));
+        return TypedMemory(inIndex);
+    }
+
+    template <typename T, size_t N>
+    const T& Trunk<T, N>::At(size_t inIndex) const
+    {
+        Assert(Valid(inIndex));
+        return TypedMemory(inIndex);
+    }
+
+    template <typename T, size_t N>
+    template <typename F>
+    void Trunk<T, N>::Each(F&& inFunc)
+    {
+        for (auto& elem : *this) {
+            inFunc(elem);
+        }
+    }
+
+    template <typename T, size_t N>
+    template <typename F>
+    void Trunk<T, N>::Each(F&& inFunc) const
+    {
+        for (const auto& elem : *this) {
+            inFunc(elem);
+        }
+    }
+
+    template <typename T, size_t N>
+    bool Trunk<T, N>::HasFree() const
+    {
+        return Free() > 0;
+    }
+
+    template <typename T, size_t N>
+    size_t Trunk<T, N>::Free() const
+    {
+        return Capacity() - Allocated();
+    }
+
+    template <typename T, size_t N>
+    size_t Trunk<T, N>::Allocated() const
     {
         size_t result = 0;
-        for (const auto& trunk : trunks) {
-            result += trunk.Free();
+        for (const auto word : allocated) {
+            result += std::popcount(word);
         }
         return result;
     }
 
     template <typename T, size_t N>
-    bool TrunkList<T, N>::Empty() const
+    bool Trunk<T, N>::Empty() const
     {
         return Allocated() == 0;
     }
 
     template <typename T, size_t N>
-    TrunkList<T, N>::operator bool() const
+    void Trunk<T, N>::Clear()
     {
-        return Empty();
+        for (auto iter = Begin(); iter != End(); ++iter) {
+            InplaceDestruct(iter.Index());
+        }
+        allocated.fill(0);
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    StableUnorderedMap<K, V, N, HashProvider, EqualTo>::StableUnorderedMap() = default;
+    template <typename T, size_t N>
+    Trunk<T, N>::operator bool() const
+    {
+        return !Empty();
+    }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    StableUnorderedMap<K, V, N, HashProvider, EqualTo>::~StableUnorderedMap() = default;
+    template <typename T, size_t N>
+    T& Trunk<T, N>::operator[](size_t inIndex)
+    {
+        return At(inIndex);
+    }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    template <typename ... Args>
-    V& StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Emplace(const K& inKey, Args&&... inValueArgs)
+    template <typename T, size_t N>
+    const T& Trunk<T, N>::operator[](size_t inIndex) const
     {
-        Assert(!Contains(inKey));
-        const auto handle = values.Emplace(std::forward<Args>(inValueArgs)...);
-        handleMap.emplace(inKey, handle);
-        return *handle;
+        return At(inIndex);
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    void StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Each(const TraverseFunc& inFunc)
+    template <typename T, size_t N>
+    typename Trunk<T, N>::Iter Trunk<T, N>::Begin()
     {
-        for (const auto& [key, handle] : handleMap) {
-            inFunc(key, *handle);
-        }
+        return { allocated.data(), TypedData(), Internal::FindNextSetBit(allocated.data(), N, 0) };
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    void StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Each(const ConstTraverseFunc& inFunc) const
+    template <typename T, size_t N>
+    typename Trunk<T, N>::ConstIter Trunk<T, N>::Begin() const
     {
-        for (const auto& [key, handle] : handleMap) {
-            inFunc(key, *handle);
-        }
+        return { allocated.data(), TypedData(), Internal::FindNextSetBit(allocated.data(), N, 0) };
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    V& StableUnorderedMap<K, V, N, HashProvider, EqualTo>::At(const K& inKey)
+    template <typename T, size_t N>
+    typename Trunk<T, N>::Iter Trunk<T, N>::End()
     {
-        const auto& handle = handleMap.at(inKey);
-        return *handle;
+        return { allocated.data(), TypedData(), N };
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    const V& StableUnorderedMap<K, V, N, HashProvider, EqualTo>::At(const K& inKey) const
+    template <typename T, size_t N>
+    typename Trunk<T, N>::ConstIter Trunk<T, N>::End() const
     {
-        const auto& handle = handleMap.at(inKey);
-        return *handle;
+        return { allocated.data(), TypedData(), N };
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    bool StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Contains(const K& inKey) const
+    template <typename T, size_t N>
+    typename Trunk<T, N>::Iter Trunk<T, N>::begin()
     {
-        return handleMap.contains(inKey);
+        return Begin();
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    void StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Erase(const K& inKey)
+    template <typename T, size_t N>
+    typename Trunk<T, N>::ConstIter Trunk<T, N>::begin() const
     {
-        const auto& handle = handleMap.at(inKey);
-        values.Erase(handle);
-        handleMap.erase(inKey);
+        return Begin();
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    void StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Reserve(size_t inCapacity)
+    template <typename T, size_t N>
+    typename Trunk<T, N>::Iter Trunk<T, N>::end()
     {
-        values.Reserve(inCapacity);
-        handleMap.reserve(values.Capacity());
+        return End();
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    size_t StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Size() const
+    template <typename T, size_t N>
+    typename Trunk<T, N>::ConstIter Trunk<T, N>::end() const
     {
-        return handleMap.size();
+        return End();
     }
 
-    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
-    size_t StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Capacity() const
+    template <typename T, size_t N>
+    bool Trunk<T, N>::Contains(size_t inIndex)
+    {
+        return inIndex < Capacity();
+    }
+
+    template <typename T, size_t N>
+    bool Trunk<T, N>::Test(size_t inIndex) const
+    {
+        return (allocated[inIndex / wordBits] >> (inIndex % wordBits)) & 1;
+    }
+
+    template <typename T, size_t N>
+    void Trunk<T, N>::Mark(size_t inIndex, bool inAllocated)
+    {
+        const uint64_t mask = static_cast<uint64_t>(1) << (inIndex % wordBits);
+        if (inAllocated) {
+            allocated[inIndex / wordBits] |= mask;
+        } else {
+            allocated[inIndex / wordBits] &= ~mask;
+        }
+    }
+
+    template <typename T, size_t N>
+    T* Trunk<T, N>::TypedData()
+    {
+        return reinterpret_cast<T*>(memory.data());
+    }
+
+    template <typename T, size_t N>
+    const T* Trunk<T, N>::TypedData() const
+    {
+        return reinterpret_cast<const T*>(memory.data());
+    }
+
+    template <typename T, size_t N>
+    T& Trunk<T, N>::TypedMemory(size_t inIndex)
+    {
+        Assert(Contains(inIndex));
+        return TypedData()[inIndex];
+    }
+
+    template <typename T, size_t N>
+    const T& Trunk<T, N>::TypedMemory(size_t inIndex) const
+    {
+        Assert(Contains(inIndex));
+        return TypedData()[inIndex];
+    }
+
+    template <typename T, size_t N>
+    template <typename ... Args>
+    void Trunk<T, N>::InplaceConstruct(size_t inIndex, Args&&... inArgs)
+    {
+        new(&TypedMemory(inIndex)) T(std::forward<Args>(inArgs)...);
+    }
+
+    template <typename T, size_t N>
+    void Trunk<T, N>::InplaceDestruct(size_t inIndex)
+    {
+        TypedMemory(inIndex).~T();
+    }
+
+    template <typename T, size_t N>
+    TrunkList<T, N>::ConstHandle::ConstHandle(const TrunkList* inOwner, const Trunk<T, N>* inTrunk, size_t inIndex)
+        : owner(inOwner)
+        , trunk(inTrunk)
+        , index(inIndex)
+    {
+    }
+
+    template <typename T, size_t N>
+    TrunkList<T, N>::ConstHandle::operator bool() const
+    {
+        return Valid();
+    }
+
+    template <typename T, size_t N>
+    const T* TrunkList<T, N>::ConstHandle::operator->() const
+    {
+        return trunk->Try(index);
+    }
+
+    template <typename T, size_t N>
+    const T& TrunkList<T, N>::ConstHandle::operator*() const
+    {
+        return trunk->At(index);
+    }
+
+    template <typename T, size_t N>
+    bool TrunkList<T, N>::ConstHandle::Valid() const
+    {
+        return trunk->Valid(index);
+    }
+
+    template <typename T, size_t N>
+    TrunkList<T, N>::Handle::Handle(TrunkList* inOwner, Trunk<T, N>* inTrunk, size_t inIndex)
+        : owner(inOwner)
+        , trunk(inTrunk)
+        , index(inIndex)
+    {
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::ConstHandle TrunkList<T, N>::Handle::Const() const
+    {
+        return { owner, trunk, index };
+    }
+
+    template <typename T, size_t N>
+    TrunkList<T, N>::Handle::operator bool() const
+    {
+        return Valid();
+    }
+
+    template <typename T, size_t N>
+    T* TrunkList<T, N>::Handle::operator->() const
+    {
+        return trunk->Try(index);
+    }
+
+    template <typename T, size_t N>
+    T& TrunkList<T, N>::Handle::operator*() const
+    {
+        return trunk->At(index);
+    }
+
+    template <typename T, size_t N>
+    bool TrunkList<T, N>::Handle::Valid() const
+    {
+        return trunk->Valid(index);
+    }
+
+    template <typename T, size_t N>
+    TrunkList<T, N>::TrunkList() = default;
+
+    template <typename T, size_t N>
+    TrunkList<T, N>::~TrunkList() = default;
+
+    template <typename T, size_t N>
+    template <typename ... Args>
+    typename TrunkList<T, N>::Handle TrunkList<T, N>::Emplace(Args&&... inArgs)
+    {
+        Trunk<T, N>* allocator = nullptr;
+        for (auto& trunk : trunks) {
+            if (trunk.HasFree()) {
+                allocator = &trunk;
+                break;
+            }
+        }
+        if (allocator == nullptr) {
+            allocator = &trunks.emplace_back();
+        }
+        return { this, allocator, allocator->Emplace(std::forward<Args>(inArgs)...) };
+    }
+
+    template <typename T, size_t N>
+    void TrunkList<T, N>::Erase(const Handle& inHandle)
+    {
+        Assert(this == inHandle.owner);
+        inHandle.trunk->Erase(inHandle.index);
+    }
+
+    template <typename T, size_t N>
+    void TrunkList<T, N>::Erase(const ConstHandle& inHandle)
+    {
+        Assert(this == inHandle.owner);
+        inHandle.trunk->Erase(inHandle.index);
+    }
+
+    template <typename T, size_t N>
+    template <typename F>
+    void TrunkList<T, N>::Each(F&& inFunc)
+    {
+        for (auto& trunk : trunks) {
+            trunk.Each(inFunc);
+        }
+    }
+
+    template <typename T, size_t N>
+    template <typename F>
+    void TrunkList<T, N>::Each(F&& inFunc) const
+    {
+        for (const auto& trunk : trunks) {
+            trunk.Each(inFunc);
+        }
+    }
+
+    template <typename T, size_t N>
+    void TrunkList<T, N>::Reserve(size_t inIndex)
+    {
+        const auto trunkNum = DivideAndRoundUp(inIndex, N);
+        while (trunks.size() < trunkNum) {
+            trunks.emplace_back();
+        }
+    }
+
+    template <typename T, size_t N>
+    size_t TrunkList<T, N>::Allocated() const
+    {
+        size_t result = 0;
+        for (const auto& trunk : trunks) {
+            result += trunk.Allocated();
+        }
+        return result;
+    }
+
+    template <typename T, size_t N>
+    size_t TrunkList<T, N>::Capacity() const
+    {
+        return trunks.size() * N;
+    }
+
+    template <typename T, size_t N>
+    size_t TrunkList<T, N>::Free() const
+    {
+        size_t result = 0;
+        for (const auto& trunk : trunks) {
+            result += trunk.Free();
+        }
+        return result;
+    }
+
+    template <typename T, size_t N>
+    bool TrunkList<T, N>::Empty() const
+    {
+        return Allocated() == 0;
+    }
+
+    template <typename T, size_t N>
+    TrunkList<T, N>::operator bool() const
+    {
+        return !Empty();
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::Iter TrunkList<T, N>::Begin()
+    {
+        return { trunks.begin(), trunks.end() };
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::ConstIter TrunkList<T, N>::Begin() const
+    {
+        return { trunks.begin(), trunks.end() };
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::Iter TrunkList<T, N>::End()
+    {
+        return { trunks.end(), trunks.end() };
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::ConstIter TrunkList<T, N>::End() const
+    {
+        return { trunks.end(), trunks.end() };
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::Iter TrunkList<T, N>::begin()
+    {
+        return Begin();
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::ConstIter TrunkList<T, N>::begin() const
+    {
+        return Begin();
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::Iter TrunkList<T, N>::end()
+    {
+        return End();
+    }
+
+    template <typename T, size_t N>
+    typename TrunkList<T, N>::ConstIter TrunkList<T, N>::end() const
+    {
+        return End();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    StableUnorderedMap<K, V, N, HashProvider, EqualTo>::StableUnorderedMap() = default;
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    StableUnorderedMap<K, V, N, HashProvider, EqualTo>::~StableUnorderedMap() = default;
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    template <typename ... Args>
+    V& StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Emplace(const K& inKey, Args&&... inValueArgs)
+    {
+        Assert(!Contains(inKey));
+        const auto handle = values.Emplace(std::piecewise_construct, std::forward_as_tuple(inKey), std::forward_as_tuple(std::forward<Args>(inValueArgs)...));
+        handleMap.emplace(inKey, handle);
+        return handle->second;
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    template <typename F>
+    void StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Each(F&& inFunc)
+    {
+        for (auto& [key, value] : values) {
+            inFunc(key, value);
+        }
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    template <typename F>
+    void StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Each(F&& inFunc) const
+    {
+        for (const auto& [key, value] : values) {
+            inFunc(key, value);
+        }
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    V& StableUnorderedMap<K, V, N, HashProvider, EqualTo>::At(const K& inKey)
+    {
+        const auto& handle = handleMap.at(inKey);
+        return handle->second;
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    const V& StableUnorderedMap<K, V, N, HashProvider, EqualTo>::At(const K& inKey) const
+    {
+        const auto& handle = handleMap.at(inKey);
+        return handle->second;
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    bool StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Contains(const K& inKey) const
+    {
+        return handleMap.contains(inKey);
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    void StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Erase(const K& inKey)
+    {
+        const auto& handle = handleMap.at(inKey);
+        values.Erase(handle);
+        handleMap.erase(inKey);
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    void StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Reserve(size_t inCapacity)
+    {
+        values.Reserve(inCapacity);
+        handleMap.reserve(values.Capacity());
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    size_t StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Size() const
+    {
+        return handleMap.size();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    size_t StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Capacity() const
     {
         return values.Capacity();
     }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    typename StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Iter StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Begin()
+    {
+        return values.Begin();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    typename StableUnorderedMap<K, V, N, HashProvider, EqualTo>::ConstIter StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Begin() const
+    {
+        return values.Begin();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    typename StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Iter StableUnorderedMap<K, V, N, HashProvider, EqualTo>::End()
+    {
+        return values.End();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    typename StableUnorderedMap<K, V, N, HashProvider, EqualTo>::ConstIter StableUnorderedMap<K, V, N, HashProvider, EqualTo>::End() const
+    {
+        return values.End();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    typename StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Iter StableUnorderedMap<K, V, N, HashProvider, EqualTo>::begin()
+    {
+        return Begin();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    typename StableUnorderedMap<K, V, N, HashProvider, EqualTo>::ConstIter StableUnorderedMap<K, V, N, HashProvider, EqualTo>::begin() const
+    {
+        return Begin();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    typename StableUnorderedMap<K, V, N, HashProvider, EqualTo>::Iter StableUnorderedMap<K, V, N, HashProvider, EqualTo>::end()
+    {
+        return End();
+    }
+
+    template <typename K, typename V, size_t N, typename HashProvider, typename EqualTo>
+    typename StableUnorderedMap<K, V, N, HashProvider, EqualTo>::ConstIter StableUnorderedMap<K, V, N, HashProvider, EqualTo>::end() const
+    {
+        return End();
+    }
+}
+
+namespace Common::Internal {
+    inline size_t FindNextSetBit(const uint64_t* inWords, size_t inBitNum, size_t inBegin)
+    {
+        if (inBegin >= inBitNum) {
+            return inBitNum;
+        }
+        size_t w = inBegin / 64;
+        uint64_t word = inWords[w] & (~static_cast<uint64_t>(0) << (inBegin % 64));
+        const size_t wordNum = (inBitNum + 63) / 64;
+        while (word == 0) {
+            if (++w == wordNum) {
+                return inBitNum;
+            }
+            word = inWords[w];
+        }
+        return w * 64 + std::countr_zero(word);
+    }
+
+    template <typename T, size_t N>
+    TrunkIter<T, N>::TrunkIter()
+        : words(nullptr)
+        , data(nullptr)
+        , index(N)
+    {
+    }
+
+    template <typename T, size_t N>
+    TrunkIter<T, N>::TrunkIter(const uint64_t* inWords, T* inData, size_t inIndex)
+        : words(inWords)
+        , data(inData)
+        , index(inIndex)
+    {
+    }
+
+    template <typename T, size_t N>
+    template <typename T2> requires std::is_same_v<const T2, T>
+    TrunkIter<T, N>::TrunkIter(const TrunkIter<T2, N>& inOther)
+        : words(inOther.words)
+        , data(inOther.data)
+        , index(inOther.index)
+    {
+    }
+
+    template <typename T, size_t N>
+    T& TrunkIter<T, N>::operator*() const
+    {
+        return data[index];
+    }
+
+    template <typename T, size_t N>
+    T* TrunkIter<T, N>::operator->() const
+    {
+        return data + index;
+    }
+
+    template <typename T, size_t N>
+    TrunkIter<T, N>& TrunkIter<T, N>::operator++()
+    {
+        index = FindNextSetBit(words, N, index + 1);
+        return *this;
+    }
+
+    template <typename T, size_t N>
+    TrunkIter<T, N> TrunkIter<T, N>::operator++(int)
+    {
+        auto result = *this;
+        ++*this;
+        return result;
+    }
+
+    template <typename T, size_t N>
+    template <typename T2>
+    bool TrunkIter<T, N>::operator==(const TrunkIter<T2, N>& inRhs) const
+    {
+        return data == inRhs.data && index == inRhs.index;
+    }
+
+    template <typename T, size_t N>
+    template <typename T2>
+    bool TrunkIter<T, N>::operator!=(const TrunkIter<T2, N>& inRhs) const
+    {
+        return !(*this == inRhs);
+    }
+
+    template <typename T, size_t N>
+    size_t TrunkIter<T, N>::Index() const
+    {
+        return index;
+    }
+
+    template <typename T, size_t N>
+    TrunkListIter<T, N>::TrunkListIter() = default;
+
+    template <typename T, size_t N>
+    TrunkListIter<T, N>::TrunkListIter(ListIter inTrunk, ListIter inTrunkEnd)
+        : trunk(inTrunk)
+        , trunkEnd(inTrunkEnd)
+    {
+        if (trunk != trunkEnd) {
+            elem = trunk->Begin();
+            SkipEmptyTrunks();
+        }
+    }
+
+    template <typename T, size_t N>
+    template <typename T2> requires std::is_same_v<const T2, T>
+    TrunkListIter<T, N>::TrunkListIter(const TrunkListIter<T2, N>& inOther)
+        : trunk(inOther.trunk)
+        , trunkEnd(inOther.trunkEnd)
+        , elem(inOther.elem)
+    {
+    }
+
+    template <typename T, size_t N>
+    T& TrunkListIter<T, N>::operator*() const
+    {
+        return *elem;
+    }
+
+    template <typename T, size_t N>
+    T* TrunkListIter<T, N>::operator->() const
+    {
+        return elem.operator->();
+    }
+
+    template <typename T, size_t N>
+    TrunkListIter<T, N>& TrunkListIter<T, N>::operator++()
+    {
+        ++elem;
+        SkipEmptyTrunks();
+        return *this;
+    }
+
+    template <typename T, size_t N>
+    TrunkListIter<T, N> TrunkListIter<T, N>::operator++(int)
+    {
+        auto result = *this;
+        ++*this;
+        return result;
+    }
+
+    template <typename T, size_t N>
+    template <typename T2>
+    bool TrunkListIter<T, N>::operator==(const TrunkListIter<T2, N>& inRhs) const
+    {
+        if (trunk != inRhs.trunk) {
+            return false;
+        }
+        return trunk == trunkEnd || elem == inRhs.elem;
+    }
+
+    template <typename T, size_t N>
+    template <typename T2>
+    bool TrunkListIter<T, N>::operator!=(const TrunkListIter<T2, N>& inRhs) const
+    {
+        return !(*this == inRhs);
+    }
+
+    template <typename T, size_t N>
+    void TrunkListIter<T, N>::SkipEmptyTrunks()
+    {
+        while (elem.Index() == N) {
+            if (++trunk == trunkEnd) {
+                return;
+            }
+            elem = trunk->Begin();
+        }
+    }
+
+    inline FlatHashGroup::FlatHashGroup(const int8_t* inCtrl)
+    {
+#if COMMON_FLAT_HASH_SSE2
+        ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inCtrl));
+#else
+        std::memcpy(ctrl.data(), inCtrl, width);
+#endif
+    }
+
+    inline uint32_t FlatHashGroup::Match(int8_t inH2) const
+    {
+#if COMMON_FLAT_HASH_SSE2
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(inH2))));
+#else
+        uint32_t result = 0;
+        for (size_t i = 0; i < width; i++) {
+            result |= static_cast<uint32_t>(ctrl[i] == inH2) << i;
+        }
+        return result;
+#endif
+    }
+
+    inline uint32_t FlatHashGroup::MatchEmpty() const
+    {
+        return Match(empty);
+    }
+
+    inline uint32_t FlatHashGroup::MatchEmptyOrDeleted() const
+    {
+        // empty and deleted are the only control bytes less than -1
+#if COMMON_FLAT_HASH_SSE2
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)));
+#else
+        uint32_t result = 0;
+        for (size_t i = 0; i < width; i++) {
+            result |= static_cast<uint32_t>(ctrl[i] < -1) << i;
+        }
+        return result;
+#endif
+    }
+
+    template <typename K, typename V>
+    const K& FlatHashMapPolicy<K, V>::Key(const ValueType& inValue)
+    {
+        return inValue.first;
+    }
+
+    template <typename K, typename V>
+    void FlatHashMapPolicy<K, V>::Relocate(ValueType* inDst, ValueType* inSrc)
+    {
+        // source is destroyed right after, so it is safe to move its const key
+        new(inDst) ValueType(std::move(const_cast<K&>(inSrc->first)), std::move(inSrc->second));
+        inSrc->~ValueType();
+    }
+
+    template <typename K>
+    const K& FlatHashSetPolicy<K>::Key(const ValueType& inValue)
+    {
+        return inValue;
+    }
+
+    template <typename K>
+    void FlatHashSetPolicy<K>::Relocate(ValueType* inDst, ValueType* inSrc)
+    {
+        new(inDst) ValueType(std::move(*inSrc));
+        inSrc->~ValueType();
+    }
+
+    template <typename T>
+    FlatHashTableIter<T>::FlatHashTableIter()
+        : ctrl(nullptr)
+        , ctrlEnd(nullptr)
+        , slot(nullptr)
+    {
+    }
+
+    template <typename T>
+    FlatHashTableIter<T>::FlatHashTableIter(const int8_t* inCtrl, const int8_t* inCtrlEnd, T* inSlot)
+        : ctrl(inCtrl)
+        , ctrlEnd(inCtrlEnd)
+        , slot(inSlot)
+    {
+    }
+
+    template <typename T>
+    template <typename T2> requires std::is_same_v<const T2, T>
+    FlatHashTableIter<T>::FlatHashTableIter(const FlatHashTableIter<T2>& inOther)
+        : ctrl(inOther.ctrl)
+        , ctrlEnd(inOther.ctrlEnd)
+        , slot(inOther.slot)
+    {
+    }
+
+    template <typename T>
+    T& FlatHashTableIter<T>::operator*() const
+    {
+        return *slot;
+    }
+
+    template <typename T>
+    T* FlatHashTableIter<T>::operator->() const
+    {
+        return slot;
+    }
+
+    template <typename T>
+    FlatHashTableIter<T>& FlatHashTableIter<T>::operator++()
+    {
+        ++ctrl;
+        ++slot;
+        SkipNonFull();
+        return *this;
+    }
+
+    template <typename T>
+    FlatHashTableIter<T> FlatHashTableIter<T>::operator++(int)
+    {
+        auto result = *this;
+        ++*this;
+        return result;
+    }
+
+    template <typename T>
+    template <typename T2>
+    bool FlatHashTableIter<T>::operator==(const FlatHashTableIter<T2>& inRhs) const
+    {
+        return ctrl == inRhs.ctrl;
+    }
+
+    template <typename T>
+    template <typename T2>
+    bool FlatHashTableIter<T>::operator!=(const FlatHashTableIter<T2>& inRhs) const
+    {
+        return ctrl != inRhs.ctrl;
+    }
+
+    template <typename T>
+    void FlatHashTableIter<T>::SkipNonFull()
+    {
+        while (ctrl != ctrlEnd && *ctrl < 0) {
+            ++ctrl;
+            ++slot;
+        }
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    FlatHashTable<Policy, Hash, EqualTo>::FlatHashTable()
+        : ctrl(nullptr)
+        , slots(nullptr)
+        , capacity(0)
+        , size(0)
+        , growthLeft(0)
+        , hash()
+        , equal()
+    {
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    FlatHashTable<Policy, Hash, EqualTo>::FlatHashTable(std::initializer_list<ValueType> inValues)
+        : FlatHashTable()
+    {
+        Reserve(inValues.size());
+        for (const auto& value : inValues) {
+            FindOrInsert(Policy::Key(value), [&](ValueType* inSlot) -> void { new(inSlot) ValueType(value); });
+        }
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    FlatHashTable<Policy, Hash, EqualTo>::~FlatHashTable()
+    {
+        DestroyAll();
+        Deallocate();
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    FlatHashTable<Policy, Hash, EqualTo>::FlatHashTable(const FlatHashTable& inOther)
+        : FlatHashTable()
+    {
+        *this = inOther;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    FlatHashTable<Policy, Hash, EqualTo>::FlatHashTable(FlatHashTable&& inOther) noexcept
+        : ctrl(std::exchange(inOther.ctrl, nullptr))
+        , slots(std::exchange(inOther.slots, nullptr))
+        , capacity(std::exchange(inOther.capacity, 0))
+        , size(std::exchange(inOther.size, 0))
+        , growthLeft(std::exchange(inOther.growthLeft, 0))
+        , hash(std::move(inOther.hash))
+        , equal(std::move(inOther.equal))
+    {
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    FlatHashTable<Policy, Hash, EqualTo>& FlatHashTable<Policy, Hash, EqualTo>::operator=(const FlatHashTable& inOther)
+    {
+        if (this == &inOther) {
+            return *this;
+        }
+        Clear();
+        hash = inOther.hash;
+        equal = inOther.equal;
+        Reserve(inOther.size);
+        for (const auto& value : inOther) {
+            FindOrInsert(Policy::Key(value), [&](ValueType* inSlot) -> void { new(inSlot) ValueType(value); });
+        }
+        return *this;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    FlatHashTable<Policy, Hash, EqualTo>& FlatHashTable<Policy, Hash, EqualTo>::operator=(FlatHashTable&& inOther) noexcept
+    {
+        if (this == &inOther) {
+            return *this;
+        }
+        DestroyAll();
+        Deallocate();
+        ctrl = std::exchange(inOther.ctrl, nullptr);
+        slots = std::exchange(inOther.slots, nullptr);
+        capacity = std::exchange(inOther.capacity, 0);
+        size = std::exchange(inOther.size, 0);
+        growthLeft = std::exchange(inOther.growthLeft, 0);
+        hash = std::move(inOther.hash);
+        equal = std::move(inOther.equal);
+        return *this;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::Iter FlatHashTable<Policy, Hash, EqualTo>::Find(const KeyType& inKey)
+    {
+        const auto index = FindIndex(inKey);
+        return index == npos ? End() : IterAt(index);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::ConstIter FlatHashTable<Policy, Hash, EqualTo>::Find(const KeyType& inKey) const
+    {
+        const auto index = FindIndex(inKey);
+        return index == npos ? End() : IterAt(index);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    template <typename KeyLike> requires FlatHashTransparent<Hash, EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::Iter FlatHashTable<Policy, Hash, EqualTo>::Find(const KeyLike& inKey)
+    {
+        const auto index = FindIndex(inKey);
+        return index == npos ? End() : IterAt(index);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    template <typename KeyLike> requires FlatHashTransparent<Hash, EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::ConstIter FlatHashTable<Policy, Hash, EqualTo>::Find(const KeyLike& inKey) const
+    {
+        const auto index = FindIndex(inKey);
+        return index == npos ? End() : IterAt(index);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    bool FlatHashTable<Policy, Hash, EqualTo>::Contains(const KeyType& inKey) const
+    {
+        return FindIndex(inKey) != npos;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    template <typename KeyLike> requires FlatHashTransparent<Hash, EqualTo>
+    bool FlatHashTable<Policy, Hash, EqualTo>::Contains(const KeyLike& inKey) const
+    {
+        return FindIndex(inKey) != npos;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    size_t FlatHashTable<Policy, Hash, EqualTo>::Erase(const KeyType& inKey)
+    {
+        const auto index = FindIndex(inKey);
+        if (index == npos) {
+            return 0;
+        }
+        EraseAt(index);
+        return 1;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::Iter FlatHashTable<Policy, Hash, EqualTo>::Erase(ConstIter inIter)
+    {
+        Assert(inIter.ctrl >= ctrl && inIter.ctrl < ctrl + capacity && *inIter.ctrl >= 0);
+        const auto index = static_cast<size_t>(inIter.ctrl - ctrl);
+        EraseAt(index);
+        auto result = IterAt(index);
+        result.SkipNonFull();
+        return result;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    void FlatHashTable<Policy, Hash, EqualTo>::Reserve(size_t inSize)
+    {
+        if (inSize <= size + growthLeft) {
+            return;
+        }
+        Rehash(CapacityForSize(inSize));
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    void FlatHashTable<Policy, Hash, EqualTo>::Clear()
+    {
+        DestroyAll();
+        if (capacity != 0) {
+            std::memset(ctrl, FlatHashGroup::empty, capacity + FlatHashGroup::width);
+        }
+        size = 0;
+        growthLeft = MaxLoad(capacity);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    size_t FlatHashTable<Policy, Hash, EqualTo>::Size() const
+    {
+        return size;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    size_t FlatHashTable<Policy, Hash, EqualTo>::Capacity() const
+    {
+        return capacity;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    bool FlatHashTable<Policy, Hash, EqualTo>::Empty() const
+    {
+        return size == 0;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::Iter FlatHashTable<Policy, Hash, EqualTo>::Begin()
+    {
+        auto result = IterAt(0);
+        result.SkipNonFull();
+        return result;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::ConstIter FlatHashTable<Policy, Hash, EqualTo>::Begin() const
+    {
+        auto result = IterAt(0);
+        result.SkipNonFull();
+        return result;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::Iter FlatHashTable<Policy, Hash, EqualTo>::End()
+    {
+        return IterAt(capacity);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::ConstIter FlatHashTable<Policy, Hash, EqualTo>::End() const
+    {
+        return IterAt(capacity);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::Iter FlatHashTable<Policy, Hash, EqualTo>::begin()
+    {
+        return Begin();
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::ConstIter FlatHashTable<Policy, Hash, EqualTo>::begin() const
+    {
+        return Begin();
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::Iter FlatHashTable<Policy, Hash, EqualTo>::end()
+    {
+        return End();
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::ConstIter FlatHashTable<Policy, Hash, EqualTo>::end() const
+    {
+        return End();
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    template <typename KeyLike>
+    size_t FlatHashTable<Policy, Hash, EqualTo>::HashOf(const KeyLike& inKey) const
+    {
+        // std::hash of integers and pointers is identity on most implementations, mix it so both h1 and h2 bits are well distributed
+        auto value = static_cast<uint64_t>(hash(inKey));
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+        return static_cast<size_t>(value);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    template <typename KeyLike>
+    size_t FlatHashTable<Policy, Hash, EqualTo>::FindIndex(const KeyLike& inKey) const
+    {
+        if (size == 0) {
+            return npos;
+        }
+
+        const size_t hashValue = HashOf(inKey);
+        const auto h2 = static_cast<int8_t>(hashValue & 0x7f);
+        const size_t mask = capacity - 1;
+        size_t pos = (hashValue >> 7) & mask;
+        for (size_t step = FlatHashGroup::width;; step += FlatHashGroup::width) {
+            const FlatHashGroup group(ctrl + pos);
+            for (auto bits = group.Match(h2); bits != 0; bits &= bits - 1) {
+                const size_t index = (pos + std::countr_zero(bits)) & mask;
+                if (equal(Policy::Key(slots[index]), inKey)) {
+                    return index;
+                }
+            }
+            if (group.MatchEmpty() != 0) {
+                return npos;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    template <typename KeyLike, typename F>
+    std::pair<typename FlatHashTable<Policy, Hash, EqualTo>::Iter, bool> FlatHashTable<Policy, Hash, EqualTo>::FindOrInsert(const KeyLike& inKey, F&& inConstruct)
+    {
+        if (const auto index = FindIndex(inKey); index != npos) {
+            return { IterAt(index), false };
+        }
+
+        const size_t hashValue = HashOf(inKey);
+        size_t index = capacity == 0 ? npos : FindInsertSlot(hashValue);
+        const auto insert = [&]() -> void {
+            inConstruct(slots + index);
+            if (ctrl[index] == FlatHashGroup::empty) {
+                growthLeft--;
+            }
+            SetCtrl(index, static_cast<int8_t>(hashValue & 0x7f));
+        };
+
+        if (index == npos || (growthLeft == 0 && ctrl[index] != FlatHashGroup::deleted)) {
+            // grow when live elements fill half of max load, otherwise only drop the tombstones. the new value is constructed
+            // while old storage is still alive, e.g. map.Emplace(k2, map.At(k1)) reads k1 from there
+            Rehash(capacity == 0 ? FlatHashGroup::width : (size + 1 > MaxLoad(capacity) / 2 ? capacity * 2 : capacity), [&]() -> void {
+                index = FindInsertSlot(hashValue);
+                insert();
+            });
+        } else {
+            insert();
+        }
+        size++;
+        return { IterAt(index), true };
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::Iter FlatHashTable<Policy, Hash, EqualTo>::IterAt(size_t inIndex)
+    {
+        return Iter(ctrl + inIndex, ctrl + capacity, slots + inIndex);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    typename FlatHashTable<Policy, Hash, EqualTo>::ConstIter FlatHashTable<Policy, Hash, EqualTo>::IterAt(size_t inIndex) const
+    {
+        return ConstIter(ctrl + inIndex, ctrl + capacity, slots + inIndex);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    size_t FlatHashTable<Policy, Hash, EqualTo>::MaxLoad(size_t inCapacity)
+    {
+        return inCapacity - inCapacity / 8;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    size_t FlatHashTable<Policy, Hash, EqualTo>::CapacityForSize(size_t inSize)
+    {
+        size_t result = FlatHashGroup::width;
+        while (MaxLoad(result) < inSize) {
+            result *= 2;
+        }
+        return result;
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    size_t FlatHashTable<Policy, Hash, EqualTo>::FindInsertSlot(size_t inHash) const
+    {
+        const size_t mask = capacity - 1;
+        size_t pos = (inHash >> 7) & mask;
+        for (size_t step = FlatHashGroup::width;; step += FlatHashGroup::width) {
+            if (const auto bits = FlatHashGroup(ctrl + pos).MatchEmptyOrDeleted();
+                bits != 0) {
+                return (pos + std::countr_zero(bits)) & mask;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    void FlatHashTable<Policy, Hash, EqualTo>::SetCtrl(size_t inIndex, int8_t inValue)
+    {
+        ctrl[inIndex] = inValue;
+        // the first group is mirrored after the last slot, so a group load never needs to wrap around
+        if (inIndex < FlatHashGroup::width) {
+            ctrl[capacity + inIndex] = inValue;
+        }
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    void FlatHashTable<Policy, Hash, EqualTo>::EraseAt(size_t inIndex)
+    {
+        slots[inIndex].~ValueType();
+        size--;
+        if (size == 0) {
+            // no probe sequence can pass a fully empty table, so all the tombstones can be dropped
+            std::memset(ctrl, FlatHashGroup::empty, capacity + FlatHashGroup::width);
+            growthLeft = MaxLoad(capacity);
+            return;
+        }
+        SetCtrl(inIndex, FlatHashGroup::deleted);
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    void FlatHashTable<Policy, Hash, EqualTo>::Rehash(size_t inNewCapacity)
+    {
+        Rehash(inNewCapacity, []() -> void {});
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    template <typename F>
+    void FlatHashTable<Policy, Hash, EqualTo>::Rehash(size_t inNewCapacity, F&& inBeforeRelocate)
+    {
+        Assert(inNewCapacity >= FlatHashGroup::width && std::has_single_bit(inNewCapacity) && MaxLoad(inNewCapacity) >= size);
+        auto* oldCtrl = ctrl;
+        auto* oldSlots = slots;
+        const auto oldCapacity = capacity;
+
+        const size_t ctrlBytes = inNewCapacity + FlatHashGroup::width;
+        const size_t slotsOffset = (ctrlBytes + alignof(ValueType) - 1) / alignof(ValueType) * alignof(ValueType);
+        auto* memory = static_cast<uint8_t*>(::operator new(slotsOffset + inNewCapacity * sizeof(ValueType), std::align_val_t(std::max(alignof(ValueType), FlatHashGroup::width))));
+        ctrl = reinterpret_cast<int8_t*>(memory);
+        slots = reinterpret_cast<ValueType*>(memory + slotsOffset);
+        capacity = inNewCapacity;
+        growthLeft = MaxLoad(inNewCapacity) - size;
+        std::memset(ctrl, FlatHashGroup::empty, ctrlBytes);
+        inBeforeRelocate();
+
+        for (size_t i = 0; i < oldCapacity; i++) {
+            if (oldCtrl[i] < 0) {
+                continue;
+            }
+            const size_t hashValue = HashOf(Policy::Key(oldSlots[i]));
+            const size_t index = FindInsertSlot(hashValue);
+            Policy::Relocate(slots + index, oldSlots + i);
+            SetCtrl(index, static_cast<int8_t>(hashValue & 0x7f));
+        }
+        if (oldCtrl != nullptr) {
+            ::operator delete(oldCtrl, std::align_val_t(std::max(alignof(ValueType), FlatHashGroup::width)));
+        }
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    void FlatHashTable<Policy, Hash, EqualTo>::DestroyAll()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ValueType>) {
+            for (size_t i = 0; i < capacity; i++) {
+                if (ctrl[i] >= 0) {
+                    slots[i].~ValueType();
+                }
+            }
+        }
+    }
+
+    template <typename Policy, typename Hash, typename EqualTo>
+    void FlatHashTable<Policy, Hash, EqualTo>::Deallocate()
+    {
+        if (ctrl != nullptr) {
+            ::operator delete(ctrl, std::align_val_t(std::max(alignof(ValueType), FlatHashGroup::width)));
+        }
+        ctrl = nullptr;
+        slots = nullptr;
+        capacity = 0;
+        size = 0;
+        growthLeft = 0;
+    }
+}
+
+namespace Common {
+    template <typename K, typename V, typename Hash, typename EqualTo>
+    template <typename K2, typename... Args>
+    std::pair<typename FlatHashMap<K, V, Hash, EqualTo>::Iter, bool> FlatHashMap<K, V, Hash, EqualTo>::Emplace(K2&& inKey, Args&&... inArgs)
+    {
+        using ValueType = typename Super::ValueType;
+        if constexpr (std::is_same_v<std::remove_cvref_t<K2>, K> || Internal::FlatHashTransparent<Hash, EqualTo>) {
+            return Super::FindOrInsert(inKey, [&](ValueType* inSlot) -> void {
+                new(inSlot) ValueType(std::piecewise_construct, std::forward_as_tuple(std::forward<K2>(inKey)), std::forward_as_tuple(std::forward<Args>(inArgs)...));
+            });
+        } else {
+            return Emplace(K(std::forward<K2>(inKey)), std::forward<Args>(inArgs)...);
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename EqualTo>
+    V& FlatHashMap<K, V, Hash, EqualTo>::At(const K& inKey)
+    {
+        const auto index = Super::FindIndex(inKey);
+        Assert(index != Super::npos);
+        return Super::IterAt(index)->second;
+    }
+
+    template <typename K, typename V, typename Hash, typename EqualTo>
+    const V& FlatHashMap<K, V, Hash, EqualTo>::At(const K& inKey) const
+    {
+        const auto index = Super::FindIndex(inKey);
+        Assert(index != Super::npos);
+        return Super::IterAt(index)->second;
+    }
+
+    template <typename K, typename V, typename Hash, typename EqualTo>
+    V& FlatHashMap<K, V, Hash, EqualTo>::operator[](const K& inKey)
+    {
+        return Emplace(inKey).first->second;
+    }
+
+    template <typename K, typename Hash, typename EqualTo>
+    template <typename K2>
+    std::pair<typename FlatHashSet<K, Hash, EqualTo>::Iter, bool> FlatHashSet<K, Hash, EqualTo>::Emplace(K2&& inKey)
+    {
+        using ValueType = typename Super::ValueType;
+        if constexpr (std::is_same_v<std::remove_cvref_t<K2>, K> || Internal::FlatHashTransparent<Hash, EqualTo>) {
+            return Super::FindOrInsert(inKey, [&](ValueType* inSlot) -> void {
+                new(inSlot) ValueType(std::forward<K2>(inKey));
+            });
+        } else {
+            return Emplace(K(std::forward<K2>(inKey)));
+        }
+    }
 }
@@ -0,0 +1,318 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <optional>
+#include <coroutine>
+#include <type_traits>
+
+#include <Common/TaskGraph.h>
+#include <Common/Concurrent.h>
+#include <Common/Utility.h>
+#include <Common/Debug.h>
+
+namespace Common {
+    template <typename T = void> class Task;
+
+    namespace Internal {
+        class TaskPromiseBase {
+        public:
+            struct FinalAwaiter {
+                bool await_ready() const noexcept; // NOLINT
+                template <typename P> std::coroutine_handle<> await_suspend(std::coroutine_handle<P> inHandle) noexcept; // NOLINT
+                void await_resume() const noexcept; // NOLINT
+            };
+
+            std::suspend_always initial_suspend() const noexcept; // NOLINT
+            FinalAwaiter final_suspend() const noexcept; // NOLINT
+            void unhandled_exception() const; // NOLINT
+            void SetContinuation(std::coroutine_handle<> inContinuation);
+
+        private:
+            std::coroutine_handle<> continuation;
+        };
+
+        template <typename T>
+        class TaskPromise : public TaskPromiseBase {
+        public:
+            Task<T> get_return_object(); // NOLINT
+            template <typename V> void return_value(V&& inValue); // NOLINT
+            T& Result();
+
+        private:
+            std::optional<T> value;
+        };
+
+        template <>
+        class TaskPromise<void> : public TaskPromiseBase {
+        public:
+            Task<void> get_return_object(); // NOLINT
+            void return_void() const; // NOLINT
+            void Result() const;
+        };
+
+        // eager and self-destroyed coroutine, used to bridge Task<T> to TaskFuture<T>
+        struct DetachedCoroutine {
+            struct promise_type { // NOLINT
+                DetachedCoroutine get_return_object() const; // NOLINT
+                std::suspend_never initial_suspend() const noexcept; // NOLINT
+                std::suspend_never final_suspend() const noexcept; // NOLINT
+                void return_void() const; // NOLINT
+                void unhandled_exception() const; // NOLINT
+            };
+        };
+    }
+
+    // lazy coroutine task, starts when awaited or launched, resumes the awaiter when completed
+    template <typename T>
+    class Task {
+    public:
+        using promise_type = Internal::TaskPromise<T>;
+
+        NonCopyable(Task)
+        explicit Task(std::coroutine_handle<promise_type> inHandle);
+        Task(Task&& inOther) noexcept;
+        ~Task();
+        Task& operator=(Task&& inOther) noexcept;
+
+        bool Valid() const;
+        bool Done() const;
+        auto operator co_await() && noexcept;
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    class ExecutorAwaiter {
+    public:
+        explicit ExecutorAwaiter(TaskExecutor& inExecutor);
+        bool await_ready() const noexcept; // NOLINT
+        void await_suspend(std::coroutine_handle<> inHandle) const; // NOLINT
+        void await_resume() const noexcept; // NOLINT
+
+    private:
+        TaskExecutor& executor;
+    };
+
+    class WorkerThreadAwaiter {
+    public:
+        WorkerThreadAwaiter(WorkerThread& inWorkerThread, TaskExecutor* inResumeExecutor);
+        bool await_ready() const noexcept; // NOLINT
+        void await_suspend(std::coroutine_handle<> inHandle) const; // NOLINT
+        void await_resume() const noexcept; // NOLINT
+
+    private:
+        WorkerThread& workerThread;
+        TaskExecutor* resumeExecutor;
+    };
+
+    template <typename T>
+    class TaskFutureAwaiter {
+    public:
+        explicit TaskFutureAwaiter(const TaskFuture<T>& inFuture);
+        bool await_ready() const; // NOLINT
+        void await_suspend(std::coroutine_handle<> inHandle) const; // NOLINT
+        auto await_resume() const; // NOLINT
+
+    private:
+        TaskFuture<T> future;
+    };
+
+    // resume the coroutine in executor
+    ExecutorAwaiter SwitchTo(TaskExecutor& inExecutor);
+    // resume the coroutine in worker thread, e.g. co_await SwitchTo(renderingThread) to issue rendering commands inline
+    WorkerThreadAwaiter SwitchTo(WorkerThread& inWorkerThread);
+    // suspend until all the commands enqueued to worker thread before are executed, then resume in executor, a non-blocking version of WorkerThread::Flush()
+    WorkerThreadAwaiter WaitForFlush(WorkerThread& inWorkerThread, TaskExecutor& inResumeExecutor = TaskExecutor::Shared());
+    Task<std::vector<uint8_t>> ReadBinaryFileAsync(std::string inFileName, TaskExecutor& inExecutor = TaskExecutor::Shared());
+    Task<std::string> ReadTextFileAsync(std::string inFileName, TaskExecutor& inExecutor = TaskExecutor::Shared());
+
+    // suspend until task future completed, then resume in the future's executor
+    template <typename T> TaskFutureAwaiter<T> operator co_await(const TaskFuture<T>& inFuture);
+    // start task in executor, the result can be observed from the returned future
+    template <typename T> TaskFuture<T> Launch(Task<T>&& inTask, TaskExecutor& inExecutor = TaskExecutor::Shared());
+    // blocking wait, do not call it inside executor tasks
+    template <typename T> T SyncWait(Task<T>&& inTask, TaskExecutor& inExecutor = TaskExecutor::Shared());
+}
+
+namespace Common::Internal {
+    template <typename P>
+    std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<P> inHandle) noexcept
+    {
+        // symmetric transfer to the awaiter, avoid stack growth on long await chains
+        auto& promise = static_cast<TaskPromiseBase&>(inHandle.promise());
+        return promise.continuation ? promise.continuation : std::noop_coroutine();
+    }
+
+    template <typename T>
+    Task<T> TaskPromise<T>::get_return_object()
+    {
+        return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    template <typename T>
+    template <typename V>
+    void TaskPromise<T>::return_value(V&& inValue)
+    {
+        value.emplace(std::forward<V>(inValue));
+    }
+
+    template <typename T>
+    T& TaskPromise<T>::Result()
+    {
+        return value.value();
+    }
+
+    template <typename T>
+    DetachedCoroutine RunDetached(Task<T> inTask, TaskExecutor& inExecutor, std::shared_ptr<TaskState<T>> inState)
+    {
+        co_await SwitchTo(inExecutor);
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(inTask);
+            inState->SetValue();
+        } else {
+            inState->SetValue(co_await std::move(inTask));
+        }
+    }
+}
+
+namespace Common {
+    template <typename T>
+    Task<T>::Task(std::coroutine_handle<promise_type> inHandle)
+        : handle(inHandle)
+    {
+    }
+
+    template <typename T>
+    Task<T>::Task(Task&& inOther) noexcept
+        : handle(std::exchange(inOther.handle, nullptr))
+    {
+    }
+
+    template <typename T>
+    Task<T>::~Task()
+    {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    template <typename T>
+    Task<T>& Task<T>::operator=(Task&& inOther) noexcept
+    {
+        if (this != &inOther) {
+            if (handle) {
+                handle.destroy();
+            }
+            handle = std::exchange(inOther.handle, nullptr);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    bool Task<T>::Valid() const
+    {
+        return handle != nullptr;
+    }
+
+    template <typename T>
+    bool Task<T>::Done() const
+    {
+        return handle && handle.done();
+    }
+
+    template <typename T>
+    auto Task<T>::operator co_await() && noexcept
+    {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept // NOLINT
+            {
+                return !handle || handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> inAwaiter) const noexcept // NOLINT
+            {
+                handle.promise().SetContinuation(inAwaiter);
+                return handle;
+            }
+
+            decltype(auto) await_resume() const // NOLINT
+            {
+                Assert(static_cast<bool>(handle));
+                if constexpr (std::is_void_v<T>) {
+                    handle.promise().Result();
+                } else {
+                    return std::move(handle.promise().Result());
+                }
+            }
+        };
+        return Awaiter { handle };
+    }
+
+    template <typename T>
+    TaskFutureAwaiter<T>::TaskFutureAwaiter(const TaskFuture<T>& inFuture)
+        : future(inFuture)
+    {
+    }
+
+    template <typename T>
+    bool TaskFutureAwaiter<T>::await_ready() const
+    {
+        return future.Ready();
+    }
+
+    template <typename T>
+    void TaskFutureAwaiter<T>::await_suspend(std::coroutine_handle<> inHandle) const
+    {
+        // coroutine may be resumed and destroy the awaiter before Then() returns
+        const TaskFuture<T> localFuture = future;
+        if constexpr (std::is_void_v<T>) {
+            localFuture.Then([inHandle]() -> void { inHandle.resume(); });
+        } else {
+            localFuture.Then([inHandle](const T&) -> void { inHandle.resume(); });
+        }
+    }
+
+    template <typename T>
+    auto TaskFutureAwaiter<T>::await_resume() const
+    {
+        if constexpr (std::is_void_v<T>) {
+            future.Wait();
+        } else {
+            return T(future.Get());
+        }
+    }
+
+    template <typename T>
+    TaskFutureAwaiter<T> operator co_await(const TaskFuture<T>& inFuture)
+    {
+        return TaskFutureAwaiter<T>(inFuture);
+    }
+
+    template <typename T>
+    TaskFuture<T> Launch(Task<T>&& inTask, TaskExecutor& inExecutor)
+    {
+        auto state = std::make_shared<Internal::TaskState<T>>();
+        Internal::RunDetached(std::move(inTask), inExecutor, state);
+        return TaskFuture<T>(inExecutor, std::move(state));
+    }
+
+    template <typename T>
+    T SyncWait(Task<T>&& inTask, TaskExecutor& inExecutor)
+    {
+        auto future = Launch(std::move(inTask), inExecutor);
+        if constexpr (std::is_void_v<T>) {
+            future.Wait();
+        } else {
+            return T(future.Get());
+        }
+    }
+}
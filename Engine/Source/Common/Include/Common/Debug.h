@@ -7,8 +7,9 @@
 #include <string>
 #include <cstdint>
 
-#define Assert(expression) Common::Debug::AssertImpl(expression, #expression, __FILE__, __LINE__)
-#define AssertWithReason(expression, reason) Common::Debug::AssertImpl(expression, #expression, __FILE__, __LINE__, reason)
+// only build the message strings when expression fails, asserts sit on hot paths such as reflection invokers
+#define Assert(expression) ((expression) ? static_cast<void>(0) : Common::Debug::AssertImpl(false, #expression, __FILE__, __LINE__))
+#define AssertWithReason(expression, reason) ((expression) ? static_cast<void>(0) : Common::Debug::AssertImpl(false, #expression, __FILE__, __LINE__, reason))
 #define Unimplement() Assert(false)
 #define QuickFail() Assert(false)
 #define QuickFailWithReason(reason) AssertWithReason(false, reason)
@@ -7,33 +7,61 @@
 #include <utility>
 #include <vector>
 #include <functional>
+#include <type_traits>
+#include <new>
+#include <cstddef>
 
 #include <Common/Debug.h>
-
-#define IMPL_INDEX_TO_STD_PLACEHOLDER(I) \
-    template <> struct IndexToStdPlaceholder<I> { static constexpr auto value = std::placeholders::_##I; }; \
-
-namespace Common::Internal {
-    template <size_t I> struct IndexToStdPlaceholder {};
-
-    IMPL_INDEX_TO_STD_PLACEHOLDER(1)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(2)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(3)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(4)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(5)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(6)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(7)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(8)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(9)
-    IMPL_INDEX_TO_STD_PLACEHOLDER(10)
-}
+#include <Common/Container.h>
 
 namespace Common {
+    template <typename Signature, size_t Capacity = 32> class InlineFunction;
+
+    // type-erased callable which stores callables up to Capacity bytes inline, larger ones fall back to heap,
+    // invoking costs a single indirect call and binding a small lambda never allocates
+    template <typename R, typename... Args, size_t Capacity>
+    class InlineFunction<R(Args...), Capacity> {
+    public:
+        InlineFunction();
+        template <typename F> requires (!std::is_same_v<std::decay_t<F>, InlineFunction<R(Args...), Capacity>>) InlineFunction(F&& inFunc); // NOLINT
+        ~InlineFunction();
+
+        InlineFunction(const InlineFunction& inOther);
+        InlineFunction(InlineFunction&& inOther) noexcept;
+        InlineFunction& operator=(const InlineFunction& inOther);
+        InlineFunction& operator=(InlineFunction&& inOther) noexcept;
+
+        R operator()(Args... inArgs) const;
+        explicit operator bool() const;
+        void Reset();
+
+    private:
+        enum class Op : uint8_t {
+            copy,
+            move,
+            destroy
+        };
+
+        using InvokeFunc = R(void*, Args&&...);
+        using ManageFunc = void(Op, void*, void*);
+
+        template <typename F> static constexpr bool storeInline = sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<F>;
+        template <typename F> static R Invoke(void* inStorage, Args&&... inArgs);
+        template <typename F> static void Manage(Op inOp, void* inDst, void* inSrc);
+        template <typename F> static F& Callable(void* inStorage);
+
+        InvokeFunc* invoker;
+        ManageFunc* manager;
+        alignas(std::max_align_t) mutable uint8_t storage[Capacity];
+    };
+
     using CallbackHandle = size_t;
-    
+
     template <typename... T>
     class Delegate {
     public:
+        using Receiver = InlineFunction<void(T...)>;
+
         Delegate();
 
         template <auto F> CallbackHandle BindStatic();
@@ -45,16 +73,159 @@ namespace Common {
         void Reset();
 
     private:
-        template <auto F, size_t... I> void BindStaticInternal(CallbackHandle inHandle, std::index_sequence<I...>);
-        template <auto F, typename C, size_t... I> void BindMemberInternal(CallbackHandle inHandle, C& inObj, std::index_sequence<I...>);
-        template <typename F, size_t... I> void BindLambdaInternal(CallbackHandle inHandle, F&& inLambda, std::index_sequence<I...>);
-
         CallbackHandle counter;
-        std::vector<std::pair<CallbackHandle, std::function<void(T...)>>> receivers;
+        // most delegates have only one or two receivers, keep them inline
+        SmallVector<std::pair<CallbackHandle, Receiver>, 2> receivers;
     };
 }
 
 namespace Common {
+    template <typename R, typename... Args, size_t Capacity>
+    InlineFunction<R(Args...), Capacity>::InlineFunction()
+        : invoker(nullptr)
+        , manager(nullptr)
+        , storage()
+    {
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    template <typename F> requires (!std::is_same_v<std::decay_t<F>, InlineFunction<R(Args...), Capacity>>)
+    InlineFunction<R(Args...), Capacity>::InlineFunction(F&& inFunc)
+        : invoker(&Invoke<std::decay_t<F>>)
+        , manager(&Manage<std::decay_t<F>>)
+        , storage()
+    {
+        using Func = std::decay_t<F>;
+        if constexpr (storeInline<Func>) {
+            new(storage) Func(std::forward<F>(inFunc));
+        } else {
+            new(storage) Func*(new Func(std::forward<F>(inFunc)));
+        }
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    InlineFunction<R(Args...), Capacity>::~InlineFunction()
+    {
+        Reset();
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    InlineFunction<R(Args...), Capacity>::InlineFunction(const InlineFunction& inOther)
+        : invoker(inOther.invoker)
+        , manager(inOther.manager)
+        , storage()
+    {
+        if (manager != nullptr) {
+            manager(Op::copy, storage, inOther.storage);
+        }
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    InlineFunction<R(Args...), Capacity>::InlineFunction(InlineFunction&& inOther) noexcept
+        : invoker(inOther.invoker)
+        , manager(inOther.manager)
+        , storage()
+    {
+        if (manager != nullptr) {
+            manager(Op::move, storage, inOther.storage);
+            inOther.Reset();
+        }
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    InlineFunction<R(Args...), Capacity>& InlineFunction<R(Args...), Capacity>::operator=(const InlineFunction& inOther)
+    {
+        if (this != &inOther) {
+            Reset();
+            invoker = inOther.invoker;
+            manager = inOther.manager;
+            if (manager != nullptr) {
+                manager(Op::copy, storage, inOther.storage);
+            }
+        }
+        return *this;
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    InlineFunction<R(Args...), Capacity>& InlineFunction<R(Args...), Capacity>::operator=(InlineFunction&& inOther) noexcept
+    {
+        if (this != &inOther) {
+            Reset();
+            invoker = inOther.invoker;
+            manager = inOther.manager;
+            if (manager != nullptr) {
+                manager(Op::move, storage, inOther.storage);
+                inOther.Reset();
+            }
+        }
+        return *this;
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    R InlineFunction<R(Args...), Capacity>::operator()(Args... inArgs) const
+    {
+        Assert(invoker != nullptr);
+        return invoker(storage, std::forward<Args>(inArgs)...);
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    InlineFunction<R(Args...), Capacity>::operator bool() const
+    {
+        return invoker != nullptr;
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    void InlineFunction<R(Args...), Capacity>::Reset()
+    {
+        if (manager != nullptr) {
+            manager(Op::destroy, storage, nullptr);
+        }
+        invoker = nullptr;
+        manager = nullptr;
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    template <typename F>
+    R InlineFunction<R(Args...), Capacity>::Invoke(void* inStorage, Args&&... inArgs)
+    {
+        return std::invoke(Callable<F>(inStorage), std::forward<Args>(inArgs)...);
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    template <typename F>
+    void InlineFunction<R(Args...), Capacity>::Manage(Op inOp, void* inDst, void* inSrc)
+    {
+        if constexpr (storeInline<F>) {
+            if (inOp == Op::copy) {
+                new(inDst) F(Callable<F>(inSrc));
+            } else if (inOp == Op::move) {
+                new(inDst) F(std::move(Callable<F>(inSrc)));
+            } else {
+                Callable<F>(inDst).~F();
+            }
+        } else {
+            if (inOp == Op::copy) {
+                new(inDst) F*(new F(Callable<F>(inSrc)));
+            } else if (inOp == Op::move) {
+                // steal heap object, source is reset by caller and must not delete it
+                new(inDst) F*(std::exchange(*static_cast<F**>(inSrc), nullptr));
+            } else {
+                delete *static_cast<F**>(inDst);
+            }
+        }
+    }
+
+    template <typename R, typename... Args, size_t Capacity>
+    template <typename F>
+    F& InlineFunction<R(Args...), Capacity>::Callable(void* inStorage)
+    {
+        if constexpr (storeInline<F>) {
+            return *std::launder(static_cast<F*>(inStorage));
+        } else {
+            return **static_cast<F**>(inStorage);
+        }
+    }
+
     template <typename... T>
     Delegate<T...>::Delegate()
         : counter(0)
@@ -66,7 +237,7 @@ namespace Common {
     CallbackHandle Delegate<T...>::BindStatic()
     {
         const auto handle = counter++;
-        BindStaticInternal<F>(handle, std::make_index_sequence<sizeof...(T)>());
+        receivers.EmplaceBack(handle, [](T... inArgs) -> void { std::invoke(F, std::forward<T>(inArgs)...); });
         return handle;
     }
 
@@ -75,7 +246,7 @@ namespace Common {
     CallbackHandle Delegate<T...>::BindMember(C& inObj)
     {
         const auto handle = counter++;
-        BindMemberInternal<F, C>(handle, inObj, std::make_index_sequence<sizeof...(T)>());
+        receivers.EmplaceBack(handle, [obj = &inObj](T... inArgs) -> void { std::invoke(F, obj, std::forward<T>(inArgs)...); });
         return handle;
     }
 
@@ -84,7 +255,7 @@ namespace Common {
     CallbackHandle Delegate<T...>::BindLambda(F&& inLambda)
     {
         const auto handle = counter++;
-        BindLambdaInternal(handle, std::forward<F>(inLambda), std::make_index_sequence<sizeof...(T)>());
+        receivers.EmplaceBack(handle, std::forward<F>(inLambda));
         return handle;
     }
 
@@ -100,42 +271,21 @@ namespace Common {
     template <typename... T>
     void Delegate<T...>::Unbind(CallbackHandle inHandle)
     {
-        auto iter = std::find_if(receivers.begin(), receivers.end(), [&](const auto& pair) -> bool { return pair.first == inHandle; });
-        Assert(iter != receivers.end());
-        receivers.erase(iter);
+        auto iter = std::find_if(receivers.Begin(), receivers.End(), [&](const auto& pair) -> bool { return pair.first == inHandle; });
+        Assert(iter != receivers.End());
+        receivers.Erase(iter);
     }
 
     template <typename... T>
     size_t Delegate<T...>::Count() const
     {
-        return receivers.size();
+        return receivers.Size();
     }
 
     template <typename... T>
     void Delegate<T...>::Reset()
     {
         counter = 0;
-        receivers.clear();
-    }
-
-    template <typename... T>
-    template <auto F, size_t... I>
-    void Delegate<T...>::BindStaticInternal(CallbackHandle inHandle, std::index_sequence<I...>)
-    {
-        receivers.emplace_back(inHandle, std::bind(F, Internal::IndexToStdPlaceholder<I + 1>::value...));
-    }
-
-    template <typename... T>
-    template <auto F, typename C, size_t... I>
-    void Delegate<T...>::BindMemberInternal(CallbackHandle inHandle, C& inObj, std::index_sequence<I...>)
-    {
-        receivers.emplace_back(inHandle, std::bind(F, &inObj, Internal::IndexToStdPlaceholder<I + 1>::value...));
-    }
-
-    template <typename... T>
-    template <typename F, size_t... I>
-    void Delegate<T...>::BindLambdaInternal(CallbackHandle inHandle, F&& inLambda, std::index_sequence<I...>)
-    {
-        receivers.emplace_back(inHandle, std::bind(inLambda, Internal::IndexToStdPlaceholder<I + 1>::value...));
+        receivers.Clear();
     }
 } // namespace Common
@@ -5,10 +5,41 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <cstdint>
+
+#include <Common/Utility.h>
 
 namespace Common {
     class FileUtils {
     public:
         static std::string ReadTextFile(const std::string& fileName);
+        static std::vector<uint8_t> ReadBinaryFile(const std::string& fileName);
+    };
+
+    // read only memory mapping of a whole file, pages are loaded by os on first access
+    class MappedFile {
+    public:
+        NonCopyable(MappedFile)
+        MappedFile();
+        explicit MappedFile(const std::string& inFileName);
+        ~MappedFile();
+
+        MappedFile(MappedFile&& inOther) noexcept;
+        MappedFile& operator=(MappedFile&& inOther) noexcept;
+
+        bool IsValid() const;
+        const uint8_t* Data() const;
+        size_t Size() const;
+        void Close();
+
+    private:
+        bool valid;
+        const uint8_t* data;
+        size_t size;
+#if PLATFORM_WINDOWS
+        void* fileHandle;
+        void* mappingHandle;
+#endif
     };
 }
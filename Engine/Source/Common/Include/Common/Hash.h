@@ -6,6 +6,9 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
+#include <array>
+#include <type_traits>
 
 #include <city.h>
 
@@ -82,6 +85,34 @@ namespace Common {
         static uint32_t StrCrc32(const char* str, size_t length);
         static uint32_t StrCrc32(const std::string& str);
         static uint64_t CityHash(const void* buffer, size_t length);
+        // fast non-cryptographic 64-bit hash, same result as Hasher with the same seed and bytes
+        static uint64_t Hash64(const void* buffer, size_t length, uint64_t seed = 0);
+        // castagnoli crc, uses SSE4.2 or ARMv8 crc instructions when cpu supports them, table driven otherwise
+        static uint32_t Crc32C(const void* buffer, size_t length, uint32_t seed = 0);
+        static bool IsCrc32CAccelerated();
+    };
+
+    // streaming version of HashUtils::Hash64, the result only depends on the concatenated bytes, not on how they are split
+    class Hasher {
+    public:
+        explicit Hasher(uint64_t inSeed = 0);
+
+        Hasher& Update(const void* inData, size_t inSize);
+        // length is hashed before chars, so that ("ab", "c") and ("a", "bc") are different
+        Hasher& Update(std::string_view inString);
+        template <typename T> requires (std::is_trivially_copyable_v<T> && !std::is_convertible_v<const T&, std::string_view>) Hasher& Update(const T& inValue);
+        uint64_t Finish() const;
+        void Reset(uint64_t inSeed = 0);
+
+    private:
+        static constexpr size_t stripeSize = 48;
+
+        static void ConsumeStripe(std::array<uint64_t, 3>& ioLanes, const uint8_t* inStripe);
+
+        std::array<uint64_t, 3> lanes;
+        std::array<uint8_t, stripeSize> buffer;
+        size_t bufferSize;
+        uint64_t totalSize;
     };
 }
 
@@ -91,4 +122,10 @@ namespace Common {
     {
         return Internal::StrCrc32Internal<sizeof(str) - 2>(str) ^ 0xffffffff;
     }
+
+    template <typename T> requires (std::is_trivially_copyable_v<T> && !std::is_convertible_v<const T&, std::string_view>)
+    Hasher& Hasher::Update(const T& inValue)
+    {
+        return Update(&inValue, sizeof(T));
+    }
 }
@@ -116,6 +116,33 @@ namespace Common { // NOLINT
                 JsonSerializer<Vec<T, 3>>::JsonDeserialize(inJsonValue["max"], outValue.max);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Box<T>& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("min");
+            JsonSerializer<Vec<T, 3>>::JsonWrite(inWriter, inValue.min);
+            inWriter.Key("max");
+            JsonSerializer<Vec<T, 3>>::JsonWrite(inWriter, inValue.max);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, Box<T>& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (key == "min") {
+                    JsonSerializer<Vec<T, 3>>::JsonRead(inReader, outValue.min);
+                } else if (key == "max") {
+                    JsonSerializer<Vec<T, 3>>::JsonRead(inReader, outValue.max);
+                } else {
+                    inReader.Skip();
+                }
+            }
+        }
     };
 }
 
@@ -178,6 +178,48 @@ namespace Common {
                 outValue.a = static_cast<uint8_t>(inJsonValue["a"].GetUint());
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Color& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("r");
+            inWriter.Uint(inValue.r);
+            inWriter.Key("g");
+            inWriter.Uint(inValue.g);
+            inWriter.Key("b");
+            inWriter.Uint(inValue.b);
+            inWriter.Key("a");
+            inWriter.Uint(inValue.a);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, Color& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                uint8_t* component;
+                if (key == "r") {
+                    component = &outValue.r;
+                } else if (key == "g") {
+                    component = &outValue.g;
+                } else if (key == "b") {
+                    component = &outValue.b;
+                } else if (key == "a") {
+                    component = &outValue.a;
+                } else {
+                    inReader.Skip();
+                    continue;
+                }
+
+                uint32_t value;
+                if (inReader.ReadUint(value)) {
+                    *component = static_cast<uint8_t>(value);
+                }
+            }
+        }
     };
 
     template <>
@@ -209,5 +251,40 @@ namespace Common {
                 outValue.a = inJsonValue["a"].GetFloat();
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const LinearColor& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("r");
+            inWriter.Double(inValue.r);
+            inWriter.Key("g");
+            inWriter.Double(inValue.g);
+            inWriter.Key("b");
+            inWriter.Double(inValue.b);
+            inWriter.Key("a");
+            inWriter.Double(inValue.a);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, LinearColor& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (key == "r") {
+                    JsonSerializer<float>::JsonRead(inReader, outValue.r);
+                } else if (key == "g") {
+                    JsonSerializer<float>::JsonRead(inReader, outValue.g);
+                } else if (key == "b") {
+                    JsonSerializer<float>::JsonRead(inReader, outValue.b);
+                } else if (key == "a") {
+                    JsonSerializer<float>::JsonRead(inReader, outValue.a);
+                } else {
+                    inReader.Skip();
+                }
+            }
+        }
     };
 }
@@ -139,6 +139,16 @@ namespace Common {
         {
             JsonSerializer<float>::JsonDeserialize(inJsonValue, outValue.value);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Internal::FullFloat<E>& inValue)
+        {
+            JsonSerializer<float>::JsonWrite(inWriter, inValue.value);
+        }
+
+        static void JsonRead(JsonReader& inReader, Internal::FullFloat<E>& outValue)
+        {
+            JsonSerializer<float>::JsonRead(inReader, outValue.value);
+        }
     };
 
     template <std::endian E>
@@ -154,6 +164,18 @@ namespace Common {
             JsonSerializer<float>::JsonDeserialize(inJsonValue, fltValue);
             outValue = fltValue;
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const HalfFloat<E>& inValue)
+        {
+            JsonSerializer<float>::JsonWrite(inWriter, inValue.AsFloat());
+        }
+
+        static void JsonRead(JsonReader& inReader, HalfFloat<E>& outValue)
+        {
+            float fltValue;
+            JsonSerializer<float>::JsonRead(inReader, fltValue);
+            outValue = fltValue;
+        }
     };
 }
 
@@ -375,6 +375,44 @@ namespace Common { // NOLINT
                 outValue.At(row, col) = std::move(element);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mat<T, R, C>& inValue)
+        {
+            inWriter.StartArray();
+            for (auto i = 0; i < R; i++) {
+                for (auto j = 0; j < C; j++) {
+                    JsonSerializer<T>::JsonWrite(inWriter, inValue.At(i, j));
+                }
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, Mat<T, R, C>& outValue)
+        {
+            if (!inReader.StartArray()) {
+                return;
+            }
+            // size is unknown before whole array is read, keep value untouched like dom path when size mismatch, elements
+            // are staged in std::array like Vec
+            std::array<T, R * C> elements;
+            for (auto i = 0; i < R * C; i++) {
+                elements[i] = outValue.At(i / C, i % C);
+            }
+            size_t count = 0;
+            while (inReader.NextElement()) {
+                if (count < R * C) {
+                    JsonSerializer<T>::JsonRead(inReader, elements[count]);
+                } else {
+                    inReader.Skip();
+                }
+                count++;
+            }
+            if (count == R * C) {
+                for (auto i = 0; i < R * C; i++) {
+                    outValue.At(i / C, i % C) = elements[i];
+                }
+            }
+        }
     };
 }
 
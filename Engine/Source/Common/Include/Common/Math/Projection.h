@@ -187,6 +187,41 @@ namespace Common {
                 JsonSerializer<std::optional<T>>::JsonDeserialize(inJsonValue["far"], outValue.farPlane);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const ReversedZOrthogonalProjection<T>& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("width");
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.width);
+            inWriter.Key("height");
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.height);
+            inWriter.Key("near");
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.nearPlane);
+            inWriter.Key("far");
+            JsonSerializer<std::optional<T>>::JsonWrite(inWriter, inValue.farPlane);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, ReversedZOrthogonalProjection<T>& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (key == "width") {
+                    JsonSerializer<T>::JsonRead(inReader, outValue.width);
+                } else if (key == "height") {
+                    JsonSerializer<T>::JsonRead(inReader, outValue.height);
+                } else if (key == "near") {
+                    JsonSerializer<T>::JsonRead(inReader, outValue.nearPlane);
+                } else if (key == "far") {
+                    JsonSerializer<std::optional<T>>::JsonRead(inReader, outValue.farPlane);
+                } else {
+                    inReader.Skip();
+                }
+            }
+        }
     };
 
     template <JsonSerializable T>
@@ -237,6 +272,45 @@ namespace Common {
                 JsonSerializer<std::optional<T>>::JsonDeserialize(inJsonValue["far"], outValue.farPlane);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const ReversedZPerspectiveProjection<T>& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("fov");
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.fov);
+            inWriter.Key("width");
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.width);
+            inWriter.Key("height");
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.height);
+            inWriter.Key("near");
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.nearPlane);
+            inWriter.Key("far");
+            JsonSerializer<std::optional<T>>::JsonWrite(inWriter, inValue.farPlane);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, ReversedZPerspectiveProjection<T>& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (key == "fov") {
+                    JsonSerializer<T>::JsonRead(inReader, outValue.fov);
+                } else if (key == "width") {
+                    JsonSerializer<T>::JsonRead(inReader, outValue.width);
+                } else if (key == "height") {
+                    JsonSerializer<T>::JsonRead(inReader, outValue.height);
+                } else if (key == "near") {
+                    JsonSerializer<T>::JsonRead(inReader, outValue.nearPlane);
+                } else if (key == "far") {
+                    JsonSerializer<std::optional<T>>::JsonRead(inReader, outValue.farPlane);
+                } else {
+                    inReader.Skip();
+                }
+            }
+        }
     };
 }
 
@@ -224,6 +224,16 @@ namespace Common {
         {
             JsonSerializer<T>::JsonDeserialize(inJsonValue, outValue.value);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Angle<T>& inValue)
+        {
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.value);
+        }
+
+        static void JsonRead(JsonReader& inReader, Angle<T>& outValue)
+        {
+            JsonSerializer<T>::JsonRead(inReader, outValue.value);
+        }
     };
 
     template <JsonSerializable T>
@@ -237,6 +247,16 @@ namespace Common {
         {
             JsonSerializer<T>::JsonDeserialize(inJsonValue, outValue.value);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Radian<T>& inValue)
+        {
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.value);
+        }
+
+        static void JsonRead(JsonReader& inReader, Radian<T>& outValue)
+        {
+            JsonSerializer<T>::JsonRead(inReader, outValue.value);
+        }
     };
 
     template <JsonSerializable T>
@@ -272,6 +292,40 @@ namespace Common {
             JsonSerializer<T>::JsonDeserialize(inJsonValue[2], outValue.y);
             JsonSerializer<T>::JsonDeserialize(inJsonValue[3], outValue.z);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Quaternion<T>& inValue)
+        {
+            inWriter.StartArray();
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.w);
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.x);
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.y);
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.z);
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, Quaternion<T>& outValue)
+        {
+            if (!inReader.StartArray()) {
+                return;
+            }
+            // size is unknown before whole array is read, keep value untouched like dom path when size mismatch
+            std::array<T, 4> components = { outValue.w, outValue.x, outValue.y, outValue.z };
+            size_t count = 0;
+            while (inReader.NextElement()) {
+                if (count < 4) {
+                    JsonSerializer<T>::JsonRead(inReader, components[count]);
+                } else {
+                    inReader.Skip();
+                }
+                count++;
+            }
+            if (count == 4) {
+                outValue.w = components[0];
+                outValue.x = components[1];
+                outValue.y = components[2];
+                outValue.z = components[3];
+            }
+        }
     };
 }
 
@@ -114,6 +114,33 @@ namespace Common {
                 JsonSerializer<Vec<T, 2>>::JsonDeserialize(inJsonValue["max"], outValue.max);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Rect<T>& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("min");
+            JsonSerializer<Vec<T, 2>>::JsonWrite(inWriter, inValue.min);
+            inWriter.Key("max");
+            JsonSerializer<Vec<T, 2>>::JsonWrite(inWriter, inValue.max);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, Rect<T>& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (key == "min") {
+                    JsonSerializer<Vec<T, 2>>::JsonRead(inReader, outValue.min);
+                } else if (key == "max") {
+                    JsonSerializer<Vec<T, 2>>::JsonRead(inReader, outValue.max);
+                } else {
+                    inReader.Skip();
+                }
+            }
+        }
     };
 }
 
@@ -102,6 +102,33 @@ namespace Common {
                 JsonSerializer<T>::JsonDeserialize(inJsonValue["radius"], outValue.radius);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Sphere<T>& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("center");
+            JsonSerializer<Vec<T, 3>>::JsonWrite(inWriter, inValue.center);
+            inWriter.Key("radius");
+            JsonSerializer<T>::JsonWrite(inWriter, inValue.radius);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, Sphere<T>& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (key == "center") {
+                    JsonSerializer<Vec<T, 3>>::JsonRead(inReader, outValue.center);
+                } else if (key == "radius") {
+                    JsonSerializer<T>::JsonRead(inReader, outValue.radius);
+                } else {
+                    inReader.Skip();
+                }
+            }
+        }
     };
 }
 
@@ -140,6 +140,37 @@ namespace Common {
                 JsonSerializer<Vec<T, 3>>::JsonDeserialize(inJsonValue["translation"], outValue.translation);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Transform<T>& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("scale");
+            JsonSerializer<Vec<T, 3>>::JsonWrite(inWriter, inValue.scale);
+            inWriter.Key("rotation");
+            JsonSerializer<Quaternion<T>>::JsonWrite(inWriter, inValue.rotation);
+            inWriter.Key("translation");
+            JsonSerializer<Vec<T, 3>>::JsonWrite(inWriter, inValue.translation);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, Transform<T>& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (key == "scale") {
+                    JsonSerializer<Vec<T, 3>>::JsonRead(inReader, outValue.scale);
+                } else if (key == "rotation") {
+                    JsonSerializer<Quaternion<T>>::JsonRead(inReader, outValue.rotation);
+                } else if (key == "translation") {
+                    JsonSerializer<Vec<T, 3>>::JsonRead(inReader, outValue.translation);
+                } else {
+                    inReader.Skip();
+                }
+            }
+        }
     };
 }
 
@@ -279,6 +279,42 @@ namespace Common {
                 JsonSerializer<T>::JsonDeserialize(inJsonValue[i], outValue[i]);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Vec<T, L>& inValue)
+        {
+            inWriter.StartArray();
+            for (auto i = 0; i < L; i++) {
+                JsonSerializer<T>::JsonWrite(inWriter, inValue[i]);
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, Vec<T, L>& outValue)
+        {
+            if (!inReader.StartArray()) {
+                return;
+            }
+            // size is unknown before whole array is read, keep value untouched like dom path when size mismatch. elements are
+            // staged in std::array, copying a Vec of non-trivial elements (e.g. HalfFloat) is not possible
+            std::array<T, L> elements;
+            for (auto i = 0; i < L; i++) {
+                elements[i] = outValue[i];
+            }
+            size_t count = 0;
+            while (inReader.NextElement()) {
+                if (count < L) {
+                    JsonSerializer<T>::JsonRead(inReader, elements[count]);
+                } else {
+                    inReader.Skip();
+                }
+                count++;
+            }
+            if (count == L) {
+                for (auto i = 0; i < L; i++) {
+                    outValue[i] = elements[i];
+                }
+            }
+        }
     };
 }
 
@@ -66,6 +66,16 @@ namespace Common {
         {
             JsonSerializer<Transform<T>>::JsonDeserialize(inJsonValue, outValue);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const ViewTransform<T>& inValue)
+        {
+            JsonSerializer<Transform<T>>::JsonWrite(inWriter, inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, ViewTransform<T>& outValue)
+        {
+            JsonSerializer<Transform<T>>::JsonRead(inReader, outValue);
+        }
     };
 }
 
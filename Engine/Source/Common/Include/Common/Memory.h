@@ -6,8 +6,11 @@
 
 #include <memory>
 #include <mutex>
+#include <atomic>
+#include <cstdint>
 
 #include <Common/Utility.h>
+#include <Common/Allocator.h>
 
 namespace Common {
     template <typename T>
@@ -119,11 +122,139 @@ namespace Common {
         std::weak_ptr<T> ref;
     };
 
+    namespace Internal {
+        class WeakRefBlock;
+    }
+
+    // base class of intrusive reference counted objects, the count lives in object itself, so object and count share one allocation,
+    // copying an object never copies its count, weak references allocate a side block lazily and only when they are used
+    class RefCounted {
+    public:
+        RefCounted();
+        RefCounted(const RefCounted& inOther);
+        RefCounted& operator=(const RefCounted& inOther);
+        virtual ~RefCounted();
+
+        void AddRef() const;
+        void Release() const;
+        uint32_t RefCount() const;
+        bool IsUnique() const;
+
+    private:
+        template <typename T> friend class IntrusiveWeakRef;
+        friend class Internal::WeakRefBlock;
+
+        Internal::WeakRefBlock* AcquireWeakBlock() const;
+
+        mutable std::atomic<uint32_t> refCount;
+        mutable std::atomic<Internal::WeakRefBlock*> weakBlock;
+    };
+
+    namespace Internal {
+        class WeakRefBlock {
+        public:
+            explicit WeakRefBlock(const RefCounted* inObject);
+
+            void AddRef();
+            void Release();
+            // add a strong reference if object is still alive
+            bool TryLock();
+            bool Expired();
+            void Detach();
+
+        private:
+            std::mutex mutex;
+            const RefCounted* object;
+            std::atomic<uint32_t> refCount;
+        };
+    }
+
+    template <typename T>
+    concept RefCountedType = std::is_base_of_v<RefCounted, T>;
+
+    template <typename T>
+    class IntrusiveRef {
+    public:
+        IntrusiveRef(T* pointer); // NOLINT
+        IntrusiveRef(nullptr_t); // NOLINT
+        IntrusiveRef(const IntrusiveRef& other); // NOLINT
+        IntrusiveRef(IntrusiveRef&& other) noexcept; // NOLINT
+        template <typename T2> IntrusiveRef(const IntrusiveRef<T2>& other); // NOLINT
+        template <typename T2> IntrusiveRef(IntrusiveRef<T2>&& other) noexcept; // NOLINT
+        IntrusiveRef();
+        ~IntrusiveRef();
+
+        IntrusiveRef& operator=(T* pointer);
+        IntrusiveRef& operator=(const IntrusiveRef& other);
+        IntrusiveRef& operator=(IntrusiveRef&& other) noexcept;
+        template <typename T2> IntrusiveRef& operator=(const IntrusiveRef<T2>& other);
+        template <typename T2> IntrusiveRef& operator=(IntrusiveRef<T2>&& other) noexcept;
+
+        T* operator->() const noexcept;
+        T& operator*() const noexcept;
+        bool operator==(nullptr_t) const noexcept;
+        bool operator!=(nullptr_t) const noexcept;
+        template <typename T2> bool operator==(const IntrusiveRef<T2>& rhs) const noexcept;
+
+        T* Get() const;
+        void Reset(T* pointer = nullptr);
+        uint32_t RefCount() const;
+        // true if this is the only strong reference, cheaper than comparing RefCount() with 1 across threads
+        bool IsUnique() const;
+
+        template <typename T2>
+        IntrusiveRef<T2> StaticCast() const;
+
+        template <typename T2>
+        IntrusiveRef<T2> DynamicCast() const;
+
+        template <typename T2>
+        IntrusiveRef<T2> ReinterpretCast() const;
+
+    private:
+        template <typename T2> friend class IntrusiveRef;
+        template <typename T2> friend class IntrusiveWeakRef;
+
+        struct AdoptTag {};
+        IntrusiveRef(T* pointer, AdoptTag);
+
+        T* ptr;
+    };
+
+    template <typename T>
+    class IntrusiveWeakRef {
+    public:
+        template <typename T2>
+        IntrusiveWeakRef(const IntrusiveRef<T2>& inRef); // NOLINT
+
+        IntrusiveWeakRef(const IntrusiveWeakRef& other); // NOLINT
+        IntrusiveWeakRef(IntrusiveWeakRef&& other) noexcept; // NOLINT
+        IntrusiveWeakRef();
+        ~IntrusiveWeakRef();
+
+        template <typename T2>
+        IntrusiveWeakRef& operator=(const IntrusiveRef<T2>& inRef);
+
+        IntrusiveWeakRef& operator=(const IntrusiveWeakRef& other);
+        IntrusiveWeakRef& operator=(IntrusiveWeakRef&& other) noexcept;
+
+        void Reset();
+        bool Expired() const;
+        IntrusiveRef<T> Lock() const;
+
+    private:
+        T* ptr;
+        Internal::WeakRefBlock* block;
+    };
+
     template <typename T, typename... Args>
     UniqueRef<T> MakeUnique(Args&&... args);
 
     template <typename T, typename... Args>
     SharedRef<T> MakeShared(Args&&... args);
+
+    template <RefCountedType T, typename... Args>
+    IntrusiveRef<T> MakeIntrusive(Args&&... args);
 }
 
 namespace Common {
@@ -444,6 +575,275 @@ namespace Common {
         return ref.lock();
     }
 
+    template <typename T>
+    IntrusiveRef<T>::IntrusiveRef(T* pointer)
+        : ptr(pointer)
+    {
+        if (ptr != nullptr) {
+            ptr->AddRef();
+        }
+    }
+
+    template <typename T>
+    IntrusiveRef<T>::IntrusiveRef(nullptr_t)
+        : ptr(nullptr)
+    {
+    }
+
+    template <typename T>
+    IntrusiveRef<T>::IntrusiveRef(const IntrusiveRef& other)
+        : IntrusiveRef(other.ptr)
+    {
+    }
+
+    template <typename T>
+    IntrusiveRef<T>::IntrusiveRef(IntrusiveRef&& other) noexcept
+        : ptr(std::exchange(other.ptr, nullptr))
+    {
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveRef<T>::IntrusiveRef(const IntrusiveRef<T2>& other)
+        : IntrusiveRef(static_cast<T*>(other.ptr))
+    {
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveRef<T>::IntrusiveRef(IntrusiveRef<T2>&& other) noexcept
+        : ptr(std::exchange(other.ptr, nullptr))
+    {
+    }
+
+    template <typename T>
+    IntrusiveRef<T>::IntrusiveRef(T* pointer, AdoptTag)
+        : ptr(pointer)
+    {
+    }
+
+    template <typename T>
+    IntrusiveRef<T>::IntrusiveRef()
+        : ptr(nullptr)
+    {
+    }
+
+    template <typename T>
+    IntrusiveRef<T>::~IntrusiveRef()
+    {
+        if (ptr != nullptr) {
+            ptr->Release();
+        }
+    }
+
+    template <typename T>
+    IntrusiveRef<T>& IntrusiveRef<T>::operator=(T* pointer)
+    {
+        Reset(pointer);
+        return *this;
+    }
+
+    template <typename T>
+    IntrusiveRef<T>& IntrusiveRef<T>::operator=(const IntrusiveRef& other)
+    {
+        IntrusiveRef temp(other);
+        std::swap(ptr, temp.ptr);
+        return *this;
+    }
+
+    template <typename T>
+    IntrusiveRef<T>& IntrusiveRef<T>::operator=(IntrusiveRef&& other) noexcept
+    {
+        IntrusiveRef temp(std::move(other));
+        std::swap(ptr, temp.ptr);
+        return *this;
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveRef<T>& IntrusiveRef<T>::operator=(const IntrusiveRef<T2>& other)
+    {
+        IntrusiveRef temp(other);
+        std::swap(ptr, temp.ptr);
+        return *this;
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveRef<T>& IntrusiveRef<T>::operator=(IntrusiveRef<T2>&& other) noexcept
+    {
+        IntrusiveRef temp(std::move(other));
+        std::swap(ptr, temp.ptr);
+        return *this;
+    }
+
+    template <typename T>
+    T* IntrusiveRef<T>::operator->() const noexcept
+    {
+        return ptr;
+    }
+
+    template <typename T>
+    T& IntrusiveRef<T>::operator*() const noexcept
+    {
+        return *ptr;
+    }
+
+    template <typename T>
+    bool IntrusiveRef<T>::operator==(nullptr_t) const noexcept
+    {
+        return ptr == nullptr;
+    }
+
+    template <typename T>
+    bool IntrusiveRef<T>::operator!=(nullptr_t) const noexcept
+    {
+        return ptr != nullptr;
+    }
+
+    template <typename T>
+    template <typename T2>
+    bool IntrusiveRef<T>::operator==(const IntrusiveRef<T2>& rhs) const noexcept
+    {
+        return ptr == rhs.ptr;
+    }
+
+    template <typename T>
+    T* IntrusiveRef<T>::Get() const
+    {
+        return ptr;
+    }
+
+    template <typename T>
+    void IntrusiveRef<T>::Reset(T* pointer)
+    {
+        IntrusiveRef temp(pointer);
+        std::swap(ptr, temp.ptr);
+    }
+
+    template <typename T>
+    uint32_t IntrusiveRef<T>::RefCount() const
+    {
+        return ptr == nullptr ? 0 : ptr->RefCount();
+    }
+
+    template <typename T>
+    bool IntrusiveRef<T>::IsUnique() const
+    {
+        return ptr != nullptr && ptr->IsUnique();
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveRef<T2> IntrusiveRef<T>::StaticCast() const
+    {
+        return IntrusiveRef<T2>(static_cast<T2*>(ptr));
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveRef<T2> IntrusiveRef<T>::DynamicCast() const
+    {
+        return IntrusiveRef<T2>(dynamic_cast<T2*>(ptr));
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveRef<T2> IntrusiveRef<T>::ReinterpretCast() const
+    {
+        return IntrusiveRef<T2>(reinterpret_cast<T2*>(ptr));
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveWeakRef<T>::IntrusiveWeakRef(const IntrusiveRef<T2>& inRef)
+        : ptr(static_cast<T*>(inRef.Get()))
+        , block(ptr == nullptr ? nullptr : ptr->AcquireWeakBlock())
+    {
+        if (block != nullptr) {
+            block->AddRef();
+        }
+    }
+
+    template <typename T>
+    IntrusiveWeakRef<T>::IntrusiveWeakRef(const IntrusiveWeakRef& other)
+        : ptr(other.ptr)
+        , block(other.block)
+    {
+        if (block != nullptr) {
+            block->AddRef();
+        }
+    }
+
+    template <typename T>
+    IntrusiveWeakRef<T>::IntrusiveWeakRef(IntrusiveWeakRef&& other) noexcept
+        : ptr(std::exchange(other.ptr, nullptr))
+        , block(std::exchange(other.block, nullptr))
+    {
+    }
+
+    template <typename T>
+    IntrusiveWeakRef<T>::IntrusiveWeakRef()
+        : ptr(nullptr)
+        , block(nullptr)
+    {
+    }
+
+    template <typename T>
+    IntrusiveWeakRef<T>::~IntrusiveWeakRef()
+    {
+        Reset();
+    }
+
+    template <typename T>
+    template <typename T2>
+    IntrusiveWeakRef<T>& IntrusiveWeakRef<T>::operator=(const IntrusiveRef<T2>& inRef)
+    {
+        return *this = IntrusiveWeakRef(inRef);
+    }
+
+    template <typename T>
+    IntrusiveWeakRef<T>& IntrusiveWeakRef<T>::operator=(const IntrusiveWeakRef& other)
+    {
+        return *this = IntrusiveWeakRef(other);
+    }
+
+    template <typename T>
+    IntrusiveWeakRef<T>& IntrusiveWeakRef<T>::operator=(IntrusiveWeakRef&& other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            ptr = std::exchange(other.ptr, nullptr);
+            block = std::exchange(other.block, nullptr);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    void IntrusiveWeakRef<T>::Reset()
+    {
+        if (block != nullptr) {
+            block->Release();
+        }
+        ptr = nullptr;
+        block = nullptr;
+    }
+
+    template <typename T>
+    bool IntrusiveWeakRef<T>::Expired() const
+    {
+        return block == nullptr || block->Expired();
+    }
+
+    template <typename T>
+    IntrusiveRef<T> IntrusiveWeakRef<T>::Lock() const
+    {
+        if (block == nullptr || !block->TryLock()) {
+            return nullptr;
+        }
+        return IntrusiveRef<T>(ptr, typename IntrusiveRef<T>::AdoptTag {});
+    }
+
     template <typename T, typename... Args>
     UniqueRef<T> MakeUnique(Args && ... args)
     {
@@ -453,6 +853,17 @@ namespace Common {
     template <typename T, typename... Args>
     SharedRef<T> MakeShared(Args && ... args)
     {
-        return Common::SharedRef<T>(new T(std::forward<Args>(args)...));
+        if constexpr (PooledObjectType<T>) {
+            // object and control block share one pooled allocation
+            return Common::SharedRef<T>(std::allocate_shared<T>(PooledAllocator<T, T::memoryTag>(), std::forward<Args>(args)...));
+        } else {
+            return Common::SharedRef<T>(new T(std::forward<Args>(args)...));
+        }
+    }
+
+    template <RefCountedType T, typename... Args>
+    IntrusiveRef<T> MakeIntrusive(Args&&... args)
+    {
+        return IntrusiveRef<T>(new T(std::forward<Args>(args)...));
     }
 }
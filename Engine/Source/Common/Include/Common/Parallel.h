@@ -0,0 +1,214 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <type_traits>
+
+#include <Common/Debug.h>
+
+namespace tf {
+    class Executor;
+}
+
+namespace Common {
+    // element count one task processes at least, ranges no larger than grain size run serially in calling thread
+    static constexpr size_t defaultParallelGrainSize = 1024;
+
+    // data parallel algorithms running on a shared taskflow executor, calls nested in parallel tasks run serially,
+    // funcs may be invoked concurrently and must not touch shared state without synchronization
+    size_t ParallelWorkerNum();
+    // Common is linked statically into every shared module, so each module holds its own copy of Common statics. the process
+    // wide executor is owned by Core and installed into each module by Core::InstallSharedExecutors(), a module not
+    // installed yet (e.g. Common tests) falls back to an executor of its own
+    void SetParallelExecutor(tf::Executor* inExecutor);
+
+    // inFunc(size_t index) for each index in [inBegin, inEnd)
+    template <typename F> void ParallelFor(size_t inBegin, size_t inEnd, F&& inFunc, size_t inGrainSize = defaultParallelGrainSize);
+    // inFunc(element) for each element in [inFirst, inLast)
+    template <std::random_access_iterator It, typename F> void ParallelForEach(It inFirst, It inLast, F&& inFunc, size_t inGrainSize = defaultParallelGrainSize);
+    // not stable, chunks are sorted in parallel then merged pairwise
+    template <std::random_access_iterator It, typename Compare = std::less<>> void ParallelSort(It inFirst, It inLast, Compare inCompare = {}, size_t inGrainSize = defaultParallelGrainSize);
+    // inOp must be associative, chunk results are combined in order so it is not required to be commutative
+    template <std::random_access_iterator It, typename T, typename Op = std::plus<>> T ParallelReduce(It inFirst, It inLast, T inInit, Op inOp = {}, size_t inGrainSize = defaultParallelGrainSize);
+    // inclusive scan, inOp must be associative, inOut may be equal to inFirst
+    template <std::random_access_iterator InIt, std::random_access_iterator OutIt, typename Op = std::plus<>> OutIt ParallelScan(InIt inFirst, InIt inLast, OutIt inOut, Op inOp = {}, size_t inGrainSize = defaultParallelGrainSize);
+}
+
+namespace Common::Internal {
+    using ParallelChunkFunc = void(*)(void*, size_t);
+
+    struct ParallelChunks {
+        size_t num;
+        size_t size;
+    };
+
+    // num is 1 when the range should be processed serially
+    ParallelChunks ComputeParallelChunks(size_t inCount, size_t inGrainSize);
+    // invoke inFunc(inContext, chunkIndex) for each chunk on shared executor and wait all of them
+    void ParallelRunChunks(size_t inChunkNum, ParallelChunkFunc inFunc, void* inContext);
+
+    template <typename F>
+    void ParallelRun(size_t inChunkNum, F& inFunc)
+    {
+        ParallelRunChunks(inChunkNum, [](void* inContext, size_t inChunkIndex) -> void {
+            (*static_cast<F*>(inContext))(inChunkIndex);
+        }, &inFunc);
+    }
+}
+
+namespace Common {
+    template <typename F>
+    void ParallelFor(size_t inBegin, size_t inEnd, F&& inFunc, size_t inGrainSize)
+    {
+        if (inEnd <= inBegin) {
+            return;
+        }
+
+        const auto count = inEnd - inBegin;
+        const auto [chunkNum, chunkSize] = Internal::ComputeParallelChunks(count, inGrainSize);
+        if (chunkNum == 1) {
+            for (auto i = inBegin; i < inEnd; i++) {
+                inFunc(i);
+            }
+            return;
+        }
+
+        auto chunkFunc = [&](size_t inChunkIndex) -> void {
+            const auto chunkBegin = inBegin + inChunkIndex * chunkSize;
+            const auto chunkEnd = std::min(chunkBegin + chunkSize, inEnd);
+            for (auto i = chunkBegin; i < chunkEnd; i++) {
+                inFunc(i);
+            }
+        };
+        Internal::ParallelRun(chunkNum, chunkFunc);
+    }
+
+    template <std::random_access_iterator It, typename F>
+    void ParallelForEach(It inFirst, It inLast, F&& inFunc, size_t inGrainSize)
+    {
+        ParallelFor(0, static_cast<size_t>(std::distance(inFirst, inLast)), [&](size_t inIndex) -> void {
+            inFunc(inFirst[inIndex]);
+        }, inGrainSize);
+    }
+
+    template <std::random_access_iterator It, typename Compare>
+    void ParallelSort(It inFirst, It inLast, Compare inCompare, size_t inGrainSize)
+    {
+        const auto count = static_cast<size_t>(std::distance(inFirst, inLast));
+        const auto [chunkNum, chunkSize] = Internal::ComputeParallelChunks(count, inGrainSize);
+        if (chunkNum == 1) {
+            std::sort(inFirst, inLast, inCompare);
+            return;
+        }
+
+        auto sortFunc = [&](size_t inChunkIndex) -> void {
+            const auto chunkBegin = inChunkIndex * chunkSize;
+            const auto chunkEnd = std::min(chunkBegin + chunkSize, count);
+            std::sort(inFirst + chunkBegin, inFirst + chunkEnd, inCompare);
+        };
+        Internal::ParallelRun(chunkNum, sortFunc);
+
+        for (size_t width = chunkSize; width < count; width *= 2) {
+            const auto mergeNum = (count + width * 2 - 1) / (width * 2);
+            auto mergeFunc = [&](size_t inMergeIndex) -> void {
+                const auto begin = inMergeIndex * width * 2;
+                const auto middle = std::min(begin + width, count);
+                const auto end = std::min(begin + width * 2, count);
+                std::inplace_merge(inFirst + begin, inFirst + middle, inFirst + end, inCompare);
+            };
+            if (mergeNum == 1) {
+                mergeFunc(0);
+            } else {
+                Internal::ParallelRun(mergeNum, mergeFunc);
+            }
+        }
+    }
+
+    template <std::random_access_iterator It, typename T, typename Op>
+    T ParallelReduce(It inFirst, It inLast, T inInit, Op inOp, size_t inGrainSize)
+    {
+        const auto count = static_cast<size_t>(std::distance(inFirst, inLast));
+        const auto [chunkNum, chunkSize] = Internal::ComputeParallelChunks(count, inGrainSize);
+        if (chunkNum == 1) {
+            return std::accumulate(inFirst, inLast, std::move(inInit), inOp);
+        }
+
+        std::vector<std::optional<T>> partials(chunkNum);
+        auto chunkFunc = [&](size_t inChunkIndex) -> void {
+            const auto chunkBegin = inChunkIndex * chunkSize;
+            const auto chunkEnd = std::min(chunkBegin + chunkSize, count);
+            T partial = inFirst[chunkBegin];
+            for (auto i = chunkBegin + 1; i < chunkEnd; i++) {
+                partial = inOp(std::move(partial), inFirst[i]);
+            }
+            partials[inChunkIndex].emplace(std::move(partial));
+        };
+        Internal::ParallelRun(chunkNum, chunkFunc);
+
+        T result = std::move(inInit);
+        for (auto& partial : partials) {
+            result = inOp(std::move(result), std::move(partial.value()));
+        }
+        return result;
+    }
+
+    template <std::random_access_iterator InIt, std::random_access_iterator OutIt, typename Op>
+    OutIt ParallelScan(InIt inFirst, InIt inLast, OutIt inOut, Op inOp, size_t inGrainSize)
+    {
+        using ValueType = std::iter_value_t<OutIt>;
+
+        // accumulate in output value type, std::inclusive_scan accumulates in input value type which may overflow
+        const auto scanRange = [&](size_t inBegin, size_t inEnd) -> void {
+            if (inBegin == inEnd) {
+                return;
+            }
+            ValueType sum = inFirst[inBegin];
+            inOut[inBegin] = sum;
+            for (auto i = inBegin + 1; i < inEnd; i++) {
+                sum = inOp(std::move(sum), inFirst[i]);
+                inOut[i] = sum;
+            }
+        };
+
+        const auto count = static_cast<size_t>(std::distance(inFirst, inLast));
+        const auto [chunkNum, chunkSize] = Internal::ComputeParallelChunks(count, inGrainSize);
+        if (chunkNum == 1) {
+            scanRange(0, count);
+            return inOut + count;
+        }
+
+        // pass 1: scan each chunk locally
+        auto scanFunc = [&](size_t inChunkIndex) -> void {
+            const auto chunkBegin = inChunkIndex * chunkSize;
+            scanRange(chunkBegin, std::min(chunkBegin + chunkSize, count));
+        };
+        Internal::ParallelRun(chunkNum, scanFunc);
+
+        // prefix of chunk sums, carries[i] is the sum of all chunks before chunk i + 1
+        std::vector<std::optional<ValueType>> carries(chunkNum - 1);
+        for (size_t i = 0; i < chunkNum - 1; i++) {
+            const ValueType& chunkSum = inOut[std::min((i + 1) * chunkSize, count) - 1];
+            carries[i].emplace(i == 0 ? chunkSum : inOp(carries[i - 1].value(), chunkSum));
+        }
+
+        // pass 2: apply carries to all chunks except the first one
+        auto applyFunc = [&](size_t inChunkIndex) -> void {
+            const auto chunkBegin = (inChunkIndex + 1) * chunkSize;
+            const auto chunkEnd = std::min(chunkBegin + chunkSize, count);
+            const ValueType& carry = carries[inChunkIndex].value();
+            for (auto i = chunkBegin; i < chunkEnd; i++) {
+                inOut[i] = inOp(carry, inOut[i]);
+            }
+        };
+        Internal::ParallelRun(chunkNum - 1, applyFunc);
+        return inOut + count;
+    }
+}
@@ -5,8 +5,11 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <algorithm>
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <optional>
 #include <array>
 #include <vector>
@@ -16,64 +19,202 @@
 #include <set>
 #include <map>
 #include <filesystem>
+#include <span>
 
 #include <rapidjson/document.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/memorystream.h>
 
 #include <Common/Utility.h>
 #include <Common/Debug.h>
 #include <Common/Hash.h>
 #include <Common/String.h>
+#include <Common/File.h>
 
 namespace Common {
+    // how sizes written ahead of their contents are produced, both modes produce the same bytes
+    // seek: placeholders are patched after contents are written, requires a random access stream
+    // sizePass: outermost framed value is measured by a counting pass first, writing becomes a pure append
+    enum class SerializeFraming : uint8_t {
+        seek,
+        sizePass,
+        max
+    };
+
+    // how integers wider than 8 bits, sizes, counts and field headers are written
+    // fixed: native width, varint: LEB128 (zigzag for signed integers), framed sizes are then only known after a size
+    // pass, so varint streams always use sizePass framing. arrays of arithmetic values keep fixed width in both
+    // encodings so that they stay a single bulk copy
+    enum class SerializeIntEncoding : uint8_t {
+        fixed,
+        varint,
+        max
+    };
+
+    class SerializeSchemaTable;
+
     class BinarySerializeStream {
     public:
         NonCopyable(BinarySerializeStream)
         virtual ~BinarySerializeStream();
 
         template <CppArithmetic T> void Write(const T& value);
+        // write count contiguous values, one single write when stream endian is native endian
+        template <CppArithmetic T> void WriteBulk(const T* data, size_t count);
+        // write integer with IntEncoding(), returns bytes written
+        template <CppIntegralNonBool T> size_t WriteInteger(const T& value);
         virtual void Seek(int64_t offset) = 0;
         virtual size_t Loc() = 0;
         virtual std::endian Endian() = 0;
+        virtual SerializeFraming Framing();
+        SerializeIntEncoding IntEncoding() const;
+        void SetIntEncoding(SerializeIntEncoding inEncoding);
+        SerializeSchemaTable* SchemaTable() const;
+        void SetSchemaTable(SerializeSchemaTable* inSchemaTable);
 
     protected:
         BinarySerializeStream();
 
         virtual void WriteInternal(const void* data, size_t size) = 0;
+
+    private:
+        friend class FrameSizeSlots;
+        template <typename F> friend size_t SerializeFramed(BinarySerializeStream& stream, F&& func);
+
+        enum class FrameSizeState : uint8_t {
+            none,
+            recording,
+            replaying,
+            max
+        };
+
+        SerializeIntEncoding intEncoding;
+        SerializeSchemaTable* schemaTable;
+        FrameSizeState frameSizeState;
+        size_t frameSizeCursor;
+        std::vector<uint64_t> frameSizes;
     };
 
+    // sizes of framed contents which are written ahead of the contents
+    class FrameSizeSlots {
+    public:
+        NonCopyable(FrameSizeSlots)
+        NonMovable(FrameSizeSlots)
+        FrameSizeSlots(BinarySerializeStream& inStream, size_t inCount);
+
+        void Set(size_t inIndex, uint64_t inSize);
+        // must be called once contents are written, inContentSize is the bytes written after slots
+        void Commit(size_t inContentSize);
+        // with varint encoding the size depends on slot values, so it is only valid after all slots are set
+        size_t SlotsSize() const;
+
+    private:
+        BinarySerializeStream& stream;
+        size_t count;
+        size_t begin;
+        std::vector<uint64_t> sizes;
+    };
+
+    // serializers writing sizes ahead of contents wrap their work in it, for a sizePass stream the outermost call
+    // runs func(BinarySerializeStream&) against a size counter to record all frame sizes before writing to the stream
+    template <typename F> size_t SerializeFramed(BinarySerializeStream& stream, F&& func);
+
     class BinaryDeserializeStream {
     public:
         NonCopyable(BinaryDeserializeStream);
         virtual ~BinaryDeserializeStream();
 
         template <CppArithmetic T> void Read(T& value);
+        // read count contiguous values, one single read when stream endian is native endian
+        template <CppArithmetic T> void ReadBulk(T* data, size_t count);
+        // read integer with IntEncoding(), returns bytes read
+        template <CppIntegralNonBool T> size_t ReadInteger(T& value);
         virtual void Seek(int64_t offset) = 0;
         virtual size_t Loc() = 0;
+        virtual size_t Size() = 0;
         virtual std::endian Endian() = 0;
+        SerializeIntEncoding IntEncoding() const;
+        void SetIntEncoding(SerializeIntEncoding inEncoding);
+        const SerializeSchemaTable* SchemaTable() const;
+        void SetSchemaTable(const SerializeSchemaTable* inSchemaTable);
 
     protected:
         BinaryDeserializeStream();
 
         virtual void ReadInternal(void* data, size_t size) = 0;
+
+    private:
+        SerializeIntEncoding intEncoding;
+        const SerializeSchemaTable* schemaTable;
+    };
+
+    // layouts of reflected classes recorded once per stream, objects refer to their layout by index instead of
+    // repeating class and field names, fields are still matched by name on load so layout changes stay tolerated
+    class SerializeSchemaTable {
+    public:
+        struct Schema {
+            std::string name;
+            std::vector<std::string> fieldNames;
+            // reader side cache filled by the serializer owning the layout, field handles indexed like fieldNames
+            mutable std::vector<const void*> resolvedFields;
+        };
+
+        NonCopyable(SerializeSchemaTable)
+        SerializeSchemaTable();
+
+        // inBuilder() -> Schema is only called when no schema named inName is registered yet
+        template <typename F> uint32_t FindOrAdd(const std::string& inName, F&& inBuilder);
+        const Schema* Find(uint32_t inIndex) const;
+        size_t Num() const;
+        size_t Serialize(BinarySerializeStream& inStream) const;
+        size_t Deserialize(BinaryDeserializeStream& inStream);
+
+    private:
+        std::vector<Schema> schemas;
+        std::unordered_map<std::string, uint32_t> indices;
     };
 
+    // optional header at the beginning of a serialized payload which records its integer encoding, always written
+    // with fixed encoding. writing it applies inEncoding to inStream, reading it applies the recorded encoding, when
+    // no header presents the stream is left untouched with fixed encoding so that old payloads are still readable.
+    // with inSchemaTable reflected objects are written against it, WriteSerializeFooter() must then be the last write
+    // to append the table, reading such payload requires outSchemaTable and the payload to end with the stream
+    size_t WriteSerializeHeader(BinarySerializeStream& inStream, SerializeIntEncoding inEncoding, SerializeSchemaTable* inSchemaTable = nullptr);
+    size_t WriteSerializeFooter(BinarySerializeStream& inStream);
+    bool ReadSerializeHeader(BinaryDeserializeStream& inStream, SerializeSchemaTable* outSchemaTable = nullptr);
+
+    static constexpr size_t defaultFileStreamBufferSize = 1 << 20;
+
+    // writes are gathered in a large block and flushed when they leave it, seeking back inside the block
+    // (e.g. patching field headers) never touches the file
     template <std::endian E = std::endian::little>
     class BinaryFileSerializeStream final : public BinarySerializeStream {
     public:
         NonCopyable(BinaryFileSerializeStream)
-        explicit BinaryFileSerializeStream(const std::string& inFileName);
+        explicit BinaryFileSerializeStream(const std::string& inFileName, size_t inBufferSize = defaultFileStreamBufferSize);
         ~BinaryFileSerializeStream() override;
 
         void Seek(int64_t offset) override;
         size_t Loc() override;
         std::endian Endian() override;
+        void Flush();
         void Close();
 
     protected:
         void WriteInternal(const void* data, size_t size) override;
 
     private:
+        bool CanBuffer(size_t size) const;
+        void WriteFile(size_t offset, const void* data, size_t size);
+
         std::ofstream file;
+        std::vector<uint8_t> buffer;
+        size_t bufferBegin;
+        size_t bufferSize;
+        size_t pointer;
+        size_t filePointer;
+        size_t fileSize;
     };
 
     template <std::endian E = std::endian::little>
@@ -85,6 +226,7 @@ namespace Common {
 
         void Seek(int64_t offset) override;
         size_t Loc() override;
+        size_t Size() override;
         std::endian Endian() override;
         void Close();
 
@@ -96,6 +238,30 @@ namespace Common {
         size_t fileSize;
     };
 
+    // zero copy deserialize stream reading from a memory mapping of the whole file
+    template <std::endian E = std::endian::little>
+    class MappedFileDeserializeStream final : public BinaryDeserializeStream {
+    public:
+        NonCopyable(MappedFileDeserializeStream)
+        explicit MappedFileDeserializeStream(const std::string& inFileName);
+        ~MappedFileDeserializeStream() override;
+
+        void Seek(int64_t offset) override;
+        size_t Loc() override;
+        size_t Size() override;
+        std::endian Endian() override;
+        // view of next size bytes in mapping without copying, valid until stream closed, endian is not converted
+        std::span<const uint8_t> ReadView(size_t size);
+        void Close();
+
+    protected:
+        void ReadInternal(void* data, size_t size) override;
+
+    private:
+        MappedFile file;
+        size_t pointer;
+    };
+
     template <std::endian E = std::endian::little>
     class MemorySerializeStream final : public BinarySerializeStream {
     public:
@@ -124,6 +290,7 @@ namespace Common {
         void Seek(int64_t offset) override;
         std::endian Endian() override;
         size_t Loc() override;
+        size_t Size() override;
 
     protected:
         void ReadInternal(void* data, size_t size) override;
@@ -133,6 +300,133 @@ namespace Common {
         const std::vector<uint8_t>& bytes;
     };
 
+    // writes nothing, used to measure serialized size
+    class SizeCounterSerializeStream final : public BinarySerializeStream {
+    public:
+        NonCopyable(SizeCounterSerializeStream)
+        SizeCounterSerializeStream();
+        ~SizeCounterSerializeStream() override;
+
+        void Seek(int64_t offset) override;
+        size_t Loc() override;
+        std::endian Endian() override;
+        size_t Size() const;
+
+    protected:
+        void WriteInternal(const void* data, size_t size) override;
+
+    private:
+        size_t pointer;
+        size_t totalSize;
+    };
+
+    // append only stream over a std::ostream (pipes, sockets, compressors), seeking back is not supported
+    template <std::endian E = std::endian::little>
+    class OStreamSerializeStream final : public BinarySerializeStream {
+    public:
+        NonCopyable(OStreamSerializeStream)
+        explicit OStreamSerializeStream(std::ostream& inStream);
+        ~OStreamSerializeStream() override;
+
+        void Seek(int64_t offset) override;
+        size_t Loc() override;
+        std::endian Endian() override;
+        SerializeFraming Framing() override;
+
+    protected:
+        void WriteInternal(const void* data, size_t size) override;
+
+    private:
+        std::ostream& stream;
+        size_t pointer;
+    };
+
+    static constexpr size_t defaultCompressBlockSize = 256 * 1024;
+
+    // payload is split into fixed size blocks which are lz compressed independently on worker threads and appended
+    // to inner stream followed by a seek table, endian follows inner stream, Close() (or destruction) must happen
+    // before inner stream is closed, seeking back is only supported inside the block not compressed yet
+    class CompressedSerializeStream final : public BinarySerializeStream {
+    public:
+        NonCopyable(CompressedSerializeStream)
+        explicit CompressedSerializeStream(BinarySerializeStream& inStream, size_t inBlockSize = defaultCompressBlockSize);
+        ~CompressedSerializeStream() override;
+
+        void Seek(int64_t offset) override;
+        size_t Loc() override;
+        std::endian Endian() override;
+        SerializeFraming Framing() override;
+        void Close();
+
+    protected:
+        void WriteInternal(const void* data, size_t size) override;
+
+    private:
+        struct BlockInfo {
+            uint64_t offset;
+            uint32_t compressedSize;
+            uint32_t rawSize;
+        };
+
+        void SubmitBlock();
+        void FlushBlocks();
+
+        BinarySerializeStream& stream;
+        size_t blockSize;
+        size_t streamBegin;
+        size_t pointer;
+        size_t blockPointer;
+        size_t blockUsed;
+        std::vector<uint8_t> block;
+        std::vector<std::vector<uint8_t>> pendingBlocks;
+        std::vector<BlockInfo> blockInfos;
+        bool closed;
+    };
+
+    // reads streams written by CompressedSerializeStream, which must span to the end of inStream, blocks are located
+    // through seek table so seeking is random access, blocks are decompressed in batches on worker threads
+    class CompressedDeserializeStream final : public BinaryDeserializeStream {
+    public:
+        NonCopyable(CompressedDeserializeStream)
+        explicit CompressedDeserializeStream(BinaryDeserializeStream& inStream);
+        ~CompressedDeserializeStream() override;
+
+        // check magic at current location of inStream without consuming it
+        static bool IsCompressed(BinaryDeserializeStream& inStream);
+
+        // false on a bad header or seek table, also turns false once a read hits a corrupt or truncated block, such
+        // reads yield zeros instead of asserting so owner can check it after deserializing and reject the data
+        bool IsValid() const;
+        void Seek(int64_t offset) override;
+        size_t Loc() override;
+        size_t Size() override;
+        std::endian Endian() override;
+
+    protected:
+        void ReadInternal(void* data, size_t size) override;
+
+    private:
+        struct BlockInfo {
+            uint64_t offset;
+            uint32_t compressedSize;
+            uint32_t rawSize;
+        };
+
+        void Fail(uint8_t* data, size_t size);
+        const std::vector<uint8_t>& GetBlock(size_t index);
+        void DecompressBatch(size_t firstIndex);
+
+        BinaryDeserializeStream& stream;
+        size_t streamBegin;
+        size_t blockSize;
+        size_t rawSize;
+        size_t pointer;
+        bool valid;
+        std::vector<BlockInfo> blockInfos;
+        size_t batchBegin;
+        std::vector<std::vector<uint8_t>> batchBlocks;
+    };
+
     template <typename T> struct Serializer {};
     template <typename T> concept Serializable = requires(T inValue, BinarySerializeStream& serializeStream, BinaryDeserializeStream& deserializeStream)
     {
@@ -146,6 +440,130 @@ namespace Common {
     template <typename T> size_t Serialize(BinarySerializeStream& inStream, const T& inValue);
     template <typename T> std::pair<bool, size_t> Deserialize(BinaryDeserializeStream& inStream, T& inValue);
 
+    // output adapter of JsonWriter, bytes are collected in buffer and flushed to ostream in blocks when it present
+    class JsonOutputStream {
+    public:
+        using Ch = char;
+
+        NonCopyable(JsonOutputStream)
+        explicit JsonOutputStream(std::ostream* inStream);
+
+        void Put(Ch c);
+        void Flush();
+        std::string_view Str() const;
+
+    private:
+        static constexpr size_t flushSize = 64 * 1024;
+
+        std::ostream* stream;
+        std::string buffer;
+    };
+
+    // streaming json writer, emits json text directly without building a rapidjson::Document
+    class JsonWriter {
+    public:
+        NonCopyable(JsonWriter)
+        // write to internal buffer, result is available from Str()
+        JsonWriter();
+        // write to inStream, buffered bytes are flushed on destruction or Flush()
+        explicit JsonWriter(std::ostream& inStream);
+        ~JsonWriter();
+
+        void Null();
+        void Bool(bool inValue);
+        void Int(int32_t inValue);
+        void Uint(uint32_t inValue);
+        void Int64(int64_t inValue);
+        void Uint64(uint64_t inValue);
+        void Double(double inValue);
+        void String(std::string_view inValue);
+        void Key(std::string_view inKey);
+        void StartObject();
+        void EndObject();
+        void StartArray();
+        void EndArray();
+
+        bool IsComplete() const;
+        void Flush();
+        std::string_view Str() const;
+
+    private:
+        JsonOutputStream stream;
+        rapidjson::Writer<JsonOutputStream> writer;
+    };
+
+    enum class JsonTokenType : uint8_t {
+        null,
+        boolean,
+        number,
+        string,
+        key,
+        startObject,
+        endObject,
+        startArray,
+        endArray,
+        end,
+        error,
+        max
+    };
+
+    // streaming pull json reader based on rapidjson iterative parser, only the current token is kept in memory.
+    // value readers consume current token and return true when it has the required type, otherwise the whole value
+    // is skipped and false is returned, which matches the dom deserializers that ignore mismatched values
+    class JsonReader {
+    public:
+        NonCopyable(JsonReader)
+        // inJson must outlive the reader, files can be read through MappedFile without copying
+        explicit JsonReader(std::string_view inJson);
+        ~JsonReader();
+
+        JsonTokenType Peek() const;
+        bool HasError() const;
+
+        bool ReadNull();
+        bool ReadBool(bool& outValue);
+        bool ReadInt(int32_t& outValue);
+        bool ReadUint(uint32_t& outValue);
+        bool ReadInt64(int64_t& outValue);
+        bool ReadUint64(uint64_t& outValue);
+        // accepts both integer and floating point numbers
+        bool ReadDouble(double& outValue);
+        bool ReadString(std::string& outValue);
+
+        bool StartObject();
+        // false when object ends, outKey is valid until next read
+        bool NextKey(std::string_view& outKey);
+        bool StartArray();
+        // false when array ends
+        bool NextElement();
+        // skip current value include all its children
+        void Skip();
+
+    private:
+        struct Handler;
+
+        enum NumberFlag : uint8_t {
+            numberInt = 0x1,
+            numberUint = 0x2,
+            numberInt64 = 0x4,
+            numberUint64 = 0x8
+        };
+
+        void Next();
+
+        rapidjson::MemoryStream stream;
+        rapidjson::Reader reader;
+        JsonTokenType tokenType;
+        bool boolValue;
+        uint8_t numberFlags;
+        int64_t int64Value;
+        uint64_t uint64Value;
+        double doubleValue;
+        std::string stringValue;
+        // keys are stored apart from string values, so key is still valid when reading value of it
+        std::string keyValue;
+    };
+
     template <typename T> struct JsonSerializer {};
     template <typename T> concept JsonSerializable = requires(
         const T& inValue, T& outValue,
@@ -156,8 +574,18 @@ namespace Common {
         JsonSerializer<T>::JsonDeserialize(inJsonValue, outValue);
     };
 
+    // streaming path of JsonSerializer, JsonWrite() must emit the same json as JsonSerialize() with rapidjson::Writer
+    template <typename T> concept JsonStreamSerializable = requires(
+        const T& inValue, T& outValue, JsonWriter& inWriter, JsonReader& inReader)
+    {
+        JsonSerializer<T>::JsonWrite(inWriter, inValue);
+        JsonSerializer<T>::JsonRead(inReader, outValue);
+    };
+
     template <typename T> void JsonSerialize(rapidjson::Value& outJsonValue, rapidjson::Document::AllocatorType& inAllocator, const T& inValue);
     template <typename T> void JsonDeserialize(const rapidjson::Value& inJsonValue, T& outValue);
+    template <typename T> void JsonWrite(JsonWriter& inWriter, const T& inValue);
+    template <typename T> void JsonRead(JsonReader& inReader, T& outValue);
 }
 
 #define IMPL_BASIC_TYPE_SERIALIZER(typeName) \
@@ -178,25 +606,98 @@ namespace Common {
         } \
     }; \
 
+#define IMPL_INTEGER_TYPE_SERIALIZER(typeName) \
+    template <> \
+    struct Serializer<typeName> { \
+        static constexpr size_t typeId = HashUtils::StrCrc32(#typeName); \
+        \
+        static size_t Serialize(BinarySerializeStream& stream, const typeName& value) \
+        { \
+            return stream.WriteInteger<typeName>(value); \
+        } \
+        \
+        static size_t Deserialize(BinaryDeserializeStream& stream, typeName& value) \
+        { \
+            return stream.ReadInteger<typeName>(value); \
+        } \
+    }; \
+
 namespace Common::Internal {
-    inline std::vector<uint8_t> SwapEndian(const void* data, const size_t size)
+    inline void SwapEndianInplace(void* data, size_t size)
     {
-        std::vector<uint8_t> result;
-        result.resize(size);
+        auto* bytes = static_cast<uint8_t*>(data);
+        for (auto i = 0; i < size / 2; i++) {
+            std::swap(bytes[i], bytes[size - 1 - i]);
+        }
+    }
 
-        const auto* bytes = static_cast<const uint8_t*>(data);
-        for (auto i = 0; i < size; i++) {
-            result[i] = bytes[size - 1 - i];
+    template <size_t Size> struct ByteSwapUInt {};
+    template <> struct ByteSwapUInt<2> { using Type = uint16_t; };
+    template <> struct ByteSwapUInt<4> { using Type = uint32_t; };
+    template <> struct ByteSwapUInt<8> { using Type = uint64_t; };
+
+    // shift based swap, compilers turn it into bswap and vectorize it when applied in a loop
+    template <CppArithmetic T>
+    T ByteSwap(T value)
+    {
+        if constexpr (sizeof(T) == 1) {
+            return value;
+        } else if constexpr (requires { typename ByteSwapUInt<sizeof(T)>::Type; }) {
+            using UInt = typename ByteSwapUInt<sizeof(T)>::Type;
+
+            UInt bits;
+            memcpy(&bits, &value, sizeof(T));
+            UInt swapped = 0;
+            for (auto i = 0; i < sizeof(T); i++) {
+                swapped = static_cast<UInt>(swapped << 8) | static_cast<UInt>(bits & 0xff);
+                bits >>= 8;
+            }
+            memcpy(&value, &swapped, sizeof(T));
+            return value;
+        } else {
+            SwapEndianInplace(&value, sizeof(T));
+            return value;
         }
-        return result;
     }
 
-    inline void SwapEndianInplace(void* data, size_t size)
+    template <CppArithmetic T>
+    void ByteSwapInplace(T* data, size_t count)
     {
-        auto* bytes = static_cast<uint8_t*>(data);
-        for (auto i = 0; i < size / 2; i++) {
-            std::swap(bytes[i], bytes[size - 1 - i]);
+        for (auto i = 0; i < count; i++) {
+            data[i] = ByteSwap(data[i]);
+        }
+    }
+
+    static constexpr size_t maxVarIntSize = 10;
+
+    constexpr size_t VarIntSize(uint64_t value)
+    {
+        size_t size = 1;
+        for (; value >= 0x80; value >>= 7) {
+            size++;
+        }
+        return size;
+    }
+
+    inline size_t EncodeVarInt(uint64_t value, uint8_t* outBytes)
+    {
+        size_t size = 0;
+        for (; value >= 0x80; value >>= 7) {
+            outBytes[size++] = static_cast<uint8_t>(value | 0x80);
         }
+        outBytes[size++] = static_cast<uint8_t>(value);
+        return size;
+    }
+
+    // map signed to unsigned so that small negative values stay small: 0, -1, 1, -2 ... -> 0, 1, 2, 3 ...
+    constexpr uint64_t ZigZagEncode(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    constexpr int64_t ZigZagDecode(uint64_t value)
+    {
+        return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
     }
 }
 
@@ -207,28 +708,153 @@ namespace Common {
         if (std::endian::native == Endian()) {
             WriteInternal(&value, sizeof(T));
         } else {
-            const auto swapped = Internal::SwapEndian(&value, sizeof(T));
-            WriteInternal(reinterpret_cast<const char*>(swapped.data()), static_cast<std::streamsize>(swapped.size()));
+            const T swapped = Internal::ByteSwap(value);
+            WriteInternal(&swapped, sizeof(T));
         }
     }
 
+    template <CppArithmetic T>
+    void BinarySerializeStream::WriteBulk(const T* data, size_t count)
+    {
+        if (count == 0) {
+            return;
+        }
+        if (sizeof(T) == 1 || std::endian::native == Endian()) {
+            WriteInternal(data, count * sizeof(T));
+            return;
+        }
+
+        // swap through a fixed stack buffer, source data is not modified and no heap memory is allocated
+        static constexpr size_t chunkCount = 4096 / sizeof(T);
+        std::array<T, chunkCount> chunk; // NOLINT
+        for (size_t offset = 0; offset < count; offset += chunkCount) {
+            const auto num = std::min(chunkCount, count - offset);
+            for (auto i = 0; i < num; i++) {
+                chunk[i] = Internal::ByteSwap(data[offset + i]);
+            }
+            WriteInternal(chunk.data(), num * sizeof(T));
+        }
+    }
+
+    template <CppIntegralNonBool T>
+    size_t BinarySerializeStream::WriteInteger(const T& value)
+    {
+        if (sizeof(T) == 1 || intEncoding == SerializeIntEncoding::fixed) {
+            Write<T>(value);
+            return sizeof(T);
+        }
+
+        uint64_t bits;
+        if constexpr (CppSigned<T>) {
+            bits = Internal::ZigZagEncode(static_cast<int64_t>(value));
+        } else {
+            bits = static_cast<uint64_t>(value);
+        }
+        std::array<uint8_t, Internal::maxVarIntSize> bytes; // NOLINT
+        const auto size = Internal::EncodeVarInt(bits, bytes.data());
+        WriteInternal(bytes.data(), size);
+        return size;
+    }
+
     template <CppArithmetic T>
     void BinaryDeserializeStream::Read(T& value)
     {
         ReadInternal(&value, sizeof(T));
         if (std::endian::native != Endian()) {
-            Internal::SwapEndianInplace(&value, sizeof(T));
+            value = Internal::ByteSwap(value);
+        }
+    }
+
+    template <CppArithmetic T>
+    void BinaryDeserializeStream::ReadBulk(T* data, size_t count)
+    {
+        if (count == 0) {
+            return;
+        }
+        ReadInternal(data, count * sizeof(T));
+        if (sizeof(T) > 1 && std::endian::native != Endian()) {
+            Internal::ByteSwapInplace(data, count);
+        }
+    }
+
+    template <CppIntegralNonBool T>
+    size_t BinaryDeserializeStream::ReadInteger(T& value)
+    {
+        if (sizeof(T) == 1 || intEncoding == SerializeIntEncoding::fixed) {
+            Read<T>(value);
+            return sizeof(T);
+        }
+
+        uint64_t bits = 0;
+        size_t size = 0;
+        for (uint8_t byte = 0x80; (byte & 0x80) != 0 && size < Internal::maxVarIntSize; size++) {
+            ReadInternal(&byte, 1);
+            bits |= static_cast<uint64_t>(byte & 0x7f) << (size * 7);
         }
+        if constexpr (CppSigned<T>) {
+            value = static_cast<T>(Internal::ZigZagDecode(bits));
+        } else {
+            value = static_cast<T>(bits);
+        }
+        return size;
+    }
+
+    template <typename F>
+    size_t SerializeFramed(BinarySerializeStream& stream, F&& func)
+    {
+        const bool needSizePass = stream.Framing() == SerializeFraming::sizePass || stream.IntEncoding() == SerializeIntEncoding::varint;
+        if (stream.frameSizeState != BinarySerializeStream::FrameSizeState::none || !needSizePass) {
+            return func(stream);
+        }
+
+        SizeCounterSerializeStream counter;
+        counter.SetIntEncoding(stream.IntEncoding());
+        counter.SetSchemaTable(stream.SchemaTable());
+        counter.frameSizeState = BinarySerializeStream::FrameSizeState::recording;
+        func(counter);
+
+        stream.frameSizeState = BinarySerializeStream::FrameSizeState::replaying;
+        stream.frameSizeCursor = 0;
+        stream.frameSizes = std::move(counter.frameSizes);
+        const auto result = func(stream);
+        Assert(stream.frameSizeCursor == stream.frameSizes.size());
+
+        stream.frameSizeState = BinarySerializeStream::FrameSizeState::none;
+        stream.frameSizes.clear();
+        return result;
+    }
+
+    template <typename F>
+    uint32_t SerializeSchemaTable::FindOrAdd(const std::string& inName, F&& inBuilder)
+    {
+        if (const auto iter = indices.find(inName);
+            iter != indices.end()) {
+            return iter->second;
+        }
+
+        const auto index = static_cast<uint32_t>(schemas.size());
+        schemas.emplace_back(inBuilder());
+        Assert(schemas.back().name == inName);
+        indices.emplace(inName, index);
+        return index;
     }
 
     template <std::endian E>
-    BinaryFileSerializeStream<E>::BinaryFileSerializeStream(const std::string& inFileName)
+    BinaryFileSerializeStream<E>::BinaryFileSerializeStream(const std::string& inFileName, size_t inBufferSize)
+        : buffer(std::max(inBufferSize, static_cast<size_t>(1)))
+        , bufferBegin(0)
+        , bufferSize(0)
+        , pointer(0)
+        , filePointer(0)
+        , fileSize(0)
     {
         if (const auto parent_path = std::filesystem::path(inFileName).parent_path();
             !std::filesystem::exists(parent_path)) {
             std::filesystem::create_directories(parent_path);
         }
-        file = std::ofstream(inFileName, std::ios::binary);
+        // stream is buffered by ourselves, let file buffer go
+        file.rdbuf()->pubsetbuf(nullptr, 0);
+        file.open(inFileName, std::ios::binary);
     }
 
     template <std::endian E>
@@ -240,19 +866,69 @@ namespace Common {
     template <std::endian E>
     void BinaryFileSerializeStream<E>::WriteInternal(const void* data, const size_t size)
     {
+        if (size >= buffer.size()) {
+            Flush();
+            WriteFile(pointer, data, size);
+            pointer += size;
+            return;
+        }
+        if (!CanBuffer(size)) {
+            Flush();
+            bufferBegin = pointer;
+        }
+
+        const auto offset = pointer - bufferBegin;
+        if (offset > bufferSize) {
+            // skipped bytes are beyond the end of file, fill them with zero as the file system would do
+            memset(buffer.data() + bufferSize, 0, offset - bufferSize);
+        }
+        memcpy(buffer.data() + offset, data, size);
+        bufferSize = std::max(bufferSize, offset + size);
+        pointer += size;
+    }
+
+    template <std::endian E>
+    bool BinaryFileSerializeStream<E>::CanBuffer(size_t size) const
+    {
+        const auto bufferEnd = bufferBegin + bufferSize;
+        if (pointer < bufferBegin || pointer + size > bufferBegin + buffer.size()) {
+            return false;
+        }
+        // a gap between buffered bytes and pointer can only be zero filled when it has never been written to file
+        return pointer <= bufferEnd || bufferEnd >= fileSize;
+    }
+
+    template <std::endian E>
+    void BinaryFileSerializeStream<E>::WriteFile(size_t offset, const void* data, size_t size)
+    {
+        if (filePointer != offset) {
+            file.seekp(static_cast<std::streamoff>(offset), std::ios::beg);
+        }
         file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        filePointer = offset + size;
+        fileSize = std::max(fileSize, filePointer);
+    }
+
+    template <std::endian E>
+    void BinaryFileSerializeStream<E>::Flush()
+    {
+        if (bufferSize == 0) {
+            return;
+        }
+        WriteFile(bufferBegin, buffer.data(), bufferSize);
+        bufferSize = 0;
     }
 
     template <std::endian E>
     void BinaryFileSerializeStream<E>::Seek(int64_t offset)
     {
-        file.seekp(offset, std::ios::cur);
+        pointer += offset;
     }
 
     template <std::endian E>
     size_t BinaryFileSerializeStream<E>::Loc()
     {
-        return file.tellp();
+        return pointer;
     }
 
     template <std::endian E>
@@ -267,6 +943,7 @@ namespace Common {
         if (!file.is_open()) {
             return;
         }
+        Flush();
         try {
             file.close();
         } catch (const std::exception&) {
@@ -308,6 +985,12 @@ namespace Common {
         return file.tellg();
     }
 
+    template <std::endian E>
+    size_t BinaryFileDeserializeStream<E>::Size()
+    {
+        return fileSize;
+    }
+
     template <std::endian E>
     std::endian BinaryFileDeserializeStream<E>::Endian()
     {
@@ -327,6 +1010,115 @@ namespace Common {
         }
     }
 
+    template <std::endian E>
+    MappedFileDeserializeStream<E>::MappedFileDeserializeStream(const std::string& inFileName)
+        : file(inFileName)
+        , pointer(0)
+    {
+    }
+
+    template <std::endian E>
+    MappedFileDeserializeStream<E>::~MappedFileDeserializeStream()
+    {
+        Close();
+    }
+
+    template <std::endian E>
+    void MappedFileDeserializeStream<E>::ReadInternal(void* data, const size_t size)
+    {
+        const auto newPointer = pointer + size;
+        Assert(newPointer <= file.Size());
+        memcpy(data, file.Data() + pointer, size);
+        pointer = newPointer;
+    }
+
+    template <std::endian E>
+    std::span<const uint8_t> MappedFileDeserializeStream<E>::ReadView(size_t size)
+    {
+        const auto newPointer = pointer + size;
+        Assert(newPointer <= file.Size());
+        const std::span<const uint8_t> result(file.Data() + pointer, size);
+        pointer = newPointer;
+        return result;
+    }
+
+    template <std::endian E>
+    void MappedFileDeserializeStream<E>::Seek(int64_t offset)
+    {
+        pointer += offset;
+    }
+
+    template <std::endian E>
+    size_t MappedFileDeserializeStream<E>::Loc()
+    {
+        return pointer;
+    }
+
+    template <std::endian E>
+    size_t MappedFileDeserializeStream<E>::Size()
+    {
+        return file.Size();
+    }
+
+    template <std::endian E>
+    std::endian MappedFileDeserializeStream<E>::Endian()
+    {
+        return E;
+    }
+
+    template <std::endian E>
+    void MappedFileDeserializeStream<E>::Close()
+    {
+        file.Close();
+    }
+
+    template <std::endian E>
+    OStreamSerializeStream<E>::OStreamSerializeStream(std::ostream& inStream)
+        : stream(inStream)
+        , pointer(0)
+    {
+    }
+
+    template <std::endian E>
+    OStreamSerializeStream<E>::~OStreamSerializeStream() = default;
+
+    template <std::endian E>
+    void OStreamSerializeStream<E>::WriteInternal(const void* data, const size_t size)
+    {
+        stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        pointer += size;
+    }
+
+    template <std::endian E>
+    void OStreamSerializeStream<E>::Seek(int64_t offset)
+    {
+        Assert(offset >= 0);
+        static constexpr std::array<char, 64> zeros {};
+        for (auto remain = static_cast<size_t>(offset); remain > 0;) {
+            const auto num = std::min(remain, zeros.size());
+            WriteInternal(zeros.data(), num);
+            remain -= num;
+        }
+    }
+
+    template <std::endian E>
+    size_t OStreamSerializeStream<E>::Loc()
+    {
+        return pointer;
+    }
+
+    template <std::endian E>
+    std::endian OStreamSerializeStream<E>::Endian()
+    {
+        return E;
+    }
+
+    template <std::endian E>
+    SerializeFraming OStreamSerializeStream<E>::Framing()
+    {
+        return SerializeFraming::sizePass;
+    }
+
     template <std::endian E>
     MemorySerializeStream<E>::MemorySerializeStream(std::vector<uint8_t>& inBytes, const size_t pointerBegin)
         : pointer(pointerBegin)
@@ -402,6 +1194,12 @@ namespace Common {
         return pointer;
     }
 
+    template <std::endian E>
+    size_t MemoryDeserializeStream<E>::Size()
+    {
+        return bytes.size();
+    }
+
     template <std::endian E>
     std::endian MemoryDeserializeStream<E>::Endian()
     {
@@ -450,71 +1248,116 @@ namespace Common {
         }
     }
 
+    template <typename T>
+    void JsonWrite(JsonWriter& inWriter, const T& inValue)
+    {
+        if constexpr (JsonStreamSerializable<T>) {
+            JsonSerializer<T>::JsonWrite(inWriter, inValue);
+        } else {
+            QuickFailWithReason("your type is not support json stream serialization");
+        }
+    }
+
+    template <typename T>
+    void JsonRead(JsonReader& inReader, T& outValue)
+    {
+        if constexpr (JsonStreamSerializable<T>) {
+            JsonSerializer<T>::JsonRead(inReader, outValue);
+        } else {
+            QuickFailWithReason("your type is not support json stream serialization");
+        }
+    }
+
     template <Serializable T>
     struct FieldSerializer {
         struct Header {
             size_t typeId;
             size_t contentSize;
 
-            void Serialize(BinarySerializeStream& stream) const
+            // type ids are crc32 based, only low 32 bits are kept with varint encoding which spends 5 bytes on them
+            static size_t WireTypeId(SerializeIntEncoding encoding, size_t typeId)
             {
+                return encoding == SerializeIntEncoding::varint ? static_cast<uint32_t>(typeId) : typeId;
+            }
+
+            static size_t SerializeTypeId(BinarySerializeStream& stream, size_t typeId)
+            {
+                if (stream.IntEncoding() == SerializeIntEncoding::varint) {
+                    stream.Write<uint32_t>(static_cast<uint32_t>(typeId));
+                    return sizeof(uint32_t);
+                }
                 stream.Write<uint64_t>(static_cast<uint64_t>(typeId));
-                stream.Write<uint64_t>(static_cast<uint64_t>(contentSize));
+                return sizeof(uint64_t);
+            }
+
+            size_t Serialize(BinarySerializeStream& stream) const
+            {
+                return SerializeTypeId(stream, typeId) + stream.WriteInteger<uint64_t>(static_cast<uint64_t>(contentSize));
             }
 
-            void Deserialize(BinaryDeserializeStream& stream)
+            size_t Deserialize(BinaryDeserializeStream& stream)
             {
-                uint64_t tempTypeId;
-                stream.Read<uint64_t>(tempTypeId);
-                typeId = static_cast<size_t>(tempTypeId);
+                size_t deserialized = 0;
+                if (stream.IntEncoding() == SerializeIntEncoding::varint) {
+                    uint32_t tempTypeId;
+                    stream.Read<uint32_t>(tempTypeId);
+                    typeId = tempTypeId;
+                    deserialized += sizeof(uint32_t);
+                } else {
+                    uint64_t tempTypeId;
+                    stream.Read<uint64_t>(tempTypeId);
+                    typeId = static_cast<size_t>(tempTypeId);
+                    deserialized += sizeof(uint64_t);
+                }
 
                 uint64_t tempContentSize;
-                stream.Read<uint64_t>(tempContentSize);
+                deserialized += stream.ReadInteger<uint64_t>(tempContentSize);
                 contentSize = static_cast<size_t>(tempContentSize);
+                return deserialized;
             }
         };
 
         static size_t Serialize(BinarySerializeStream& stream, const T& value)
         {
-            Header header;
-            header.typeId = Serializer<T>::typeId;
-
-            stream.Seek(sizeof(Header));
-            header.contentSize = Serializer<T>::Serialize(stream, value);
-            stream.Seek(-static_cast<int64_t>(sizeof(Header)) - static_cast<int64_t>(header.contentSize));
-            header.Serialize(stream);
-            stream.Seek(header.contentSize);
-            return sizeof(Header) + header.contentSize;
+            return SerializeFramed(stream, [&](BinarySerializeStream& framedStream) -> size_t {
+                // same layout as Header
+                const auto typeIdSize = Header::SerializeTypeId(framedStream, Serializer<T>::typeId);
+                FrameSizeSlots contentSize(framedStream, 1);
+                const auto size = Serializer<T>::Serialize(framedStream, value);
+                contentSize.Set(0, size);
+                contentSize.Commit(size);
+                return typeIdSize + contentSize.SlotsSize() + size;
+            });
         }
 
         static std::pair<bool, size_t> Deserialize(BinaryDeserializeStream& stream, T& value)
         {
             Header header {};
-            header.Deserialize(stream);
+            const auto headerSize = header.Deserialize(stream);
 
-            if (header.typeId != Serializer<T>::typeId) {
+            if (header.typeId != Header::WireTypeId(stream.IntEncoding(), Serializer<T>::typeId)) {
                 stream.Seek(header.contentSize);
-                return { false, sizeof(Header) };
+                return { false, headerSize };
             }
 
             size_t deserializedSize = Serializer<T>::Deserialize(stream, value);
             if (deserializedSize != header.contentSize) {
                 stream.Seek(header.contentSize - deserializedSize);
-                return { false, sizeof(Header) + deserializedSize };
+                return { false, headerSize + deserializedSize };
             }
-            return { true, sizeof(Header) + header.contentSize };
+            return { true, headerSize + header.contentSize };
         }
     };
 
     IMPL_BASIC_TYPE_SERIALIZER(bool)
-    IMPL_BASIC_TYPE_SERIALIZER(int8_t)
-    IMPL_BASIC_TYPE_SERIALIZER(uint8_t)
-    IMPL_BASIC_TYPE_SERIALIZER(int16_t)
-    IMPL_BASIC_TYPE_SERIALIZER(uint16_t)
-    IMPL_BASIC_TYPE_SERIALIZER(int32_t)
-    IMPL_BASIC_TYPE_SERIALIZER(uint32_t)
-    IMPL_BASIC_TYPE_SERIALIZER(int64_t)
-    IMPL_BASIC_TYPE_SERIALIZER(uint64_t)
+    IMPL_INTEGER_TYPE_SERIALIZER(int8_t)
+    IMPL_INTEGER_TYPE_SERIALIZER(uint8_t)
+    IMPL_INTEGER_TYPE_SERIALIZER(int16_t)
+    IMPL_INTEGER_TYPE_SERIALIZER(uint16_t)
+    IMPL_INTEGER_TYPE_SERIALIZER(int32_t)
+    IMPL_INTEGER_TYPE_SERIALIZER(uint32_t)
+    IMPL_INTEGER_TYPE_SERIALIZER(int64_t)
+    IMPL_INTEGER_TYPE_SERIALIZER(uint64_t)
     IMPL_BASIC_TYPE_SERIALIZER(float)
     IMPL_BASIC_TYPE_SERIALIZER(double)
 
@@ -529,10 +1372,7 @@ namespace Common {
             const uint64_t size = value.size();
             serialized += Serializer<uint64_t>::Serialize(stream, size);
 
-            const auto* data = reinterpret_cast<const uint8_t*>(value.data());
-            for (auto i = 0; i < size; i++) {
-                stream.Write<uint8_t>(data[i]);
-            }
+            stream.WriteBulk<uint8_t>(reinterpret_cast<const uint8_t*>(value.data()), size);
 
             serialized += size;
             return serialized;
@@ -546,10 +1386,7 @@ namespace Common {
             deserialized += Serializer<uint64_t>::Deserialize(stream, size);
 
             value.resize(size);
-            auto* data = reinterpret_cast<uint8_t*>(value.data());
-            for (auto i = 0; i < size; i++) {
-                stream.Read<uint8_t>(data[i]);
-            }
+            stream.ReadBulk<uint8_t>(reinterpret_cast<uint8_t*>(value.data()), size);
 
             deserialized += size;
             return deserialized;
@@ -570,8 +1407,18 @@ namespace Common {
             serialized += Serializer<uint64_t>::Serialize(stream, size);
 
             const auto* data = static_cast<const std::wstring::value_type*>(value.data());
-            for (auto i = 0; i < size; i++) {
-                stream.Write<uint32_t>(static_cast<uint32_t>(data[i]));
+            if constexpr (sizeof(std::wstring::value_type) == sizeof(uint32_t)) {
+                stream.WriteBulk<std::wstring::value_type>(data, size);
+            } else {
+                // widen to uint32_t chunk by chunk
+                std::array<uint32_t, 1024> chunk; // NOLINT
+                for (size_t offset = 0; offset < size; offset += chunk.size()) {
+                    const auto num = std::min(chunk.size(), static_cast<size_t>(size - offset));
+                    for (auto i = 0; i < num; i++) {
+                        chunk[i] = static_cast<uint32_t>(data[offset + i]);
+                    }
+                    stream.WriteBulk<uint32_t>(chunk.data(), num);
+                }
             }
 
             serialized += size * sizeof(uint32_t);
@@ -587,10 +1434,17 @@ namespace Common {
 
             value.resize(size);
             auto* data = static_cast<std::wstring::value_type*>(value.data());
-            for (auto i = 0; i < size; i++) {
-                uint32_t tempValue;
-                stream.Read<uint32_t>(tempValue);
-                data[i] = static_cast<std::wstring::value_type>(tempValue);
+            if constexpr (sizeof(std::wstring::value_type) == sizeof(uint32_t)) {
+                stream.ReadBulk<std::wstring::value_type>(data, size);
+            } else {
+                std::array<uint32_t, 1024> chunk; // NOLINT
+                for (size_t offset = 0; offset < size; offset += chunk.size()) {
+                    const auto num = std::min(chunk.size(), static_cast<size_t>(size - offset));
+                    stream.ReadBulk<uint32_t>(chunk.data(), num);
+                    for (auto i = 0; i < num; i++) {
+                        data[offset + i] = static_cast<std::wstring::value_type>(chunk[i]);
+                    }
+                }
             }
 
             deserialized += size * sizeof(uint32_t);
@@ -672,8 +1526,13 @@ namespace Common {
             const uint64_t size = value.size();
             serialized += Serializer<uint64_t>::Serialize(stream, size);
 
-            for (const auto& element : value) {
-                serialized += Serializer<T>::Serialize(stream, element);
+            if constexpr (CppArithmeticNonBool<T>) {
+                stream.WriteBulk<T>(value.data(), N);
+                serialized += N * sizeof(T);
+            } else {
+                for (const auto& element : value) {
+                    serialized += Serializer<T>::Serialize(stream, element);
+                }
             }
             return serialized;
         }
@@ -692,10 +1551,15 @@ namespace Common {
                 return deserialized;
             }
 
-            for (auto i = 0; i < size; i++) {
-                T element;
-                deserialized += Serializer<T>::Deserialize(stream, element);
-                value[i] = std::move(element);
+            if constexpr (CppArithmeticNonBool<T>) {
+                stream.ReadBulk<T>(value.data(), N);
+                deserialized += N * sizeof(T);
+            } else {
+                for (auto i = 0; i < size; i++) {
+                    T element;
+                    deserialized += Serializer<T>::Deserialize(stream, element);
+                    value[i] = std::move(element);
+                }
             }
             return deserialized;
         }
@@ -714,8 +1578,13 @@ namespace Common {
             const uint64_t size = value.size();
             serialized += Serializer<uint64_t>::Serialize(stream, size);
 
-            for (auto i = 0; i < size; i++) {
-                serialized += Serializer<T>::Serialize(stream, value[i]);
+            if constexpr (CppArithmeticNonBool<T>) {
+                stream.WriteBulk<T>(value.data(), size);
+                serialized += size * sizeof(T);
+            } else {
+                for (auto i = 0; i < size; i++) {
+                    serialized += Serializer<T>::Serialize(stream, value[i]);
+                }
             }
             return serialized;
         }
@@ -728,11 +1597,17 @@ namespace Common {
             uint64_t size;
             deserialized += Serializer<uint64_t>::Deserialize(stream, size);
 
-            value.reserve(size);
-            for (auto i = 0; i < size; i++) {
-                T element;
-                deserialized += Serializer<T>::Deserialize(stream, element);
-                value.emplace_back(std::move(element));
+            if constexpr (CppArithmeticNonBool<T>) {
+                value.resize(size);
+                stream.ReadBulk<T>(value.data(), size);
+                deserialized += size * sizeof(T);
+            } else {
+                value.reserve(size);
+                for (auto i = 0; i < size; i++) {
+                    T element;
+                    deserialized += Serializer<T>::Deserialize(stream, element);
+                    value.emplace_back(std::move(element));
+                }
             }
             return deserialized;
         }
@@ -972,6 +1847,16 @@ namespace Common {
             }
             outValue = inJsonValue.GetBool();
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const bool& inValue)
+        {
+            inWriter.Bool(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, bool& outValue)
+        {
+            inReader.ReadBool(outValue);
+        }
     };
 
     template <>
@@ -988,6 +1873,19 @@ namespace Common {
             }
             outValue = static_cast<int8_t>(inJsonValue.GetInt());
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const int8_t& inValue)
+        {
+            inWriter.Int(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, int8_t& outValue)
+        {
+            int32_t value;
+            if (inReader.ReadInt(value)) {
+                outValue = static_cast<int8_t>(value);
+            }
+        }
     };
 
     template <>
@@ -1004,6 +1902,19 @@ namespace Common {
             }
             outValue = static_cast<uint8_t>(inJsonValue.GetUint());
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const uint8_t& inValue)
+        {
+            inWriter.Uint(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, uint8_t& outValue)
+        {
+            uint32_t value;
+            if (inReader.ReadUint(value)) {
+                outValue = static_cast<uint8_t>(value);
+            }
+        }
     };
 
     template <>
@@ -1020,6 +1931,19 @@ namespace Common {
             }
             outValue = static_cast<int16_t>(inJsonValue.GetInt());
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const int16_t& inValue)
+        {
+            inWriter.Int(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, int16_t& outValue)
+        {
+            int32_t value;
+            if (inReader.ReadInt(value)) {
+                outValue = static_cast<int16_t>(value);
+            }
+        }
     };
 
     template <>
@@ -1036,6 +1960,19 @@ namespace Common {
             }
             outValue = static_cast<uint16_t>(inJsonValue.GetUint());
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const uint16_t& inValue)
+        {
+            inWriter.Uint(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, uint16_t& outValue)
+        {
+            uint32_t value;
+            if (inReader.ReadUint(value)) {
+                outValue = static_cast<uint16_t>(value);
+            }
+        }
     };
 
     template <>
@@ -1052,6 +1989,16 @@ namespace Common {
             }
             outValue = inJsonValue.GetInt();
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const int32_t& inValue)
+        {
+            inWriter.Int(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, int32_t& outValue)
+        {
+            inReader.ReadInt(outValue);
+        }
     };
 
     template <>
@@ -1068,6 +2015,16 @@ namespace Common {
             }
             outValue = inJsonValue.GetUint();
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const uint32_t& inValue)
+        {
+            inWriter.Uint(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, uint32_t& outValue)
+        {
+            inReader.ReadUint(outValue);
+        }
     };
 
     template <>
@@ -1084,6 +2041,16 @@ namespace Common {
             }
             outValue = inJsonValue.GetInt64();
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const int64_t& inValue)
+        {
+            inWriter.Int64(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, int64_t& outValue)
+        {
+            inReader.ReadInt64(outValue);
+        }
     };
 
     template <>
@@ -1100,6 +2067,16 @@ namespace Common {
             }
             outValue = inJsonValue.GetUint64();
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const uint64_t& inValue)
+        {
+            inWriter.Uint64(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, uint64_t& outValue)
+        {
+            inReader.ReadUint64(outValue);
+        }
     };
 
     template <>
@@ -1116,6 +2093,19 @@ namespace Common {
             }
             outValue = inJsonValue.GetFloat();
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const float& inValue)
+        {
+            inWriter.Double(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, float& outValue)
+        {
+            double value;
+            if (inReader.ReadDouble(value)) {
+                outValue = static_cast<float>(value);
+            }
+        }
     };
 
     template <>
@@ -1132,6 +2122,16 @@ namespace Common {
             }
             outValue = inJsonValue.GetDouble();
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const double& inValue)
+        {
+            inWriter.Double(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, double& outValue)
+        {
+            inReader.ReadDouble(outValue);
+        }
     };
 
     template <>
@@ -1148,6 +2148,16 @@ namespace Common {
             }
             outValue = std::string(inJsonValue.GetString(), inJsonValue.GetStringLength());
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::string& inValue)
+        {
+            inWriter.String(inValue);
+        }
+
+        static void JsonRead(JsonReader& inReader, std::string& outValue)
+        {
+            inReader.ReadString(outValue);
+        }
     };
 
     template <>
@@ -1165,6 +2175,19 @@ namespace Common {
             }
             outValue = StringUtils::ToWideString(std::string(inJsonValue.GetString(), inJsonValue.GetStringLength()));
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::wstring& inValue)
+        {
+            inWriter.String(StringUtils::ToByteString(inValue));
+        }
+
+        static void JsonRead(JsonReader& inReader, std::wstring& outValue)
+        {
+            std::string value;
+            if (inReader.ReadString(value)) {
+                outValue = StringUtils::ToWideString(value);
+            }
+        }
     };
 
     template <JsonSerializable T>
@@ -1188,6 +2211,27 @@ namespace Common {
                 outValue = std::move(value);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::optional<T>& inValue)
+        {
+            if (inValue.has_value()) {
+                JsonSerializer<T>::JsonWrite(inWriter, inValue.value());
+            } else {
+                inWriter.Null();
+            }
+        }
+
+        static void JsonRead(JsonReader& inReader, std::optional<T>& outValue)
+        {
+            if (inReader.Peek() == JsonTokenType::null) {
+                inReader.ReadNull();
+                outValue = {};
+            } else {
+                T value;
+                JsonSerializer<T>::JsonRead(inReader, value);
+                outValue = std::move(value);
+            }
+        }
     };
 
     template <JsonSerializable K, JsonSerializable V>
@@ -1218,6 +2262,33 @@ namespace Common {
                 JsonSerializer<V>::JsonDeserialize(inJsonValue["value"], outValue.second);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::pair<K, V>& inValue)
+        {
+            inWriter.StartObject();
+            inWriter.Key("key");
+            JsonSerializer<K>::JsonWrite(inWriter, inValue.first);
+            inWriter.Key("value");
+            JsonSerializer<V>::JsonWrite(inWriter, inValue.second);
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::pair<K, V>& outValue)
+        {
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (key == "key") {
+                    JsonSerializer<K>::JsonRead(inReader, outValue.first);
+                } else if (key == "value") {
+                    JsonSerializer<V>::JsonRead(inReader, outValue.second);
+                } else {
+                    inReader.Skip();
+                }
+            }
+        }
     };
 
     template <JsonSerializable T, size_t N>
@@ -1248,6 +2319,44 @@ namespace Common {
                 outValue[i] = std::move(element);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::array<T, N>& inValue)
+        {
+            inWriter.StartArray();
+            for (const auto& element : inValue) {
+                JsonSerializer<T>::JsonWrite(inWriter, element);
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::array<T, N>& outValue)
+        {
+            for (auto& element : outValue) {
+                element = T();
+            }
+
+            if (!inReader.StartArray()) {
+                return;
+            }
+            size_t count = 0;
+            while (inReader.NextElement()) {
+                if (count < N) {
+                    T element;
+                    JsonSerializer<T>::JsonRead(inReader, element);
+                    outValue[count] = std::move(element);
+                } else {
+                    inReader.Skip();
+                }
+                count++;
+            }
+
+            // size is unknown before whole array is read, reset to default like dom path when size mismatch
+            if (count != N) {
+                for (auto& element : outValue) {
+                    element = T();
+                }
+            }
+        }
     };
 
     template <JsonSerializable T>
@@ -1277,6 +2386,29 @@ namespace Common {
                 outValue.emplace_back(std::move(element));
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::vector<T>& inValue)
+        {
+            inWriter.StartArray();
+            for (const auto& element : inValue) {
+                JsonSerializer<T>::JsonWrite(inWriter, element);
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::vector<T>& outValue)
+        {
+            outValue.clear();
+
+            if (!inReader.StartArray()) {
+                return;
+            }
+            while (inReader.NextElement()) {
+                T element;
+                JsonSerializer<T>::JsonRead(inReader, element);
+                outValue.emplace_back(std::move(element));
+            }
+        }
     };
 
     template <JsonSerializable T>
@@ -1305,6 +2437,29 @@ namespace Common {
                 outValue.emplace_back(std::move(element));
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::list<T>& inValue)
+        {
+            inWriter.StartArray();
+            for (const auto& element : inValue) {
+                JsonSerializer<T>::JsonWrite(inWriter, element);
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::list<T>& outValue)
+        {
+            outValue.clear();
+
+            if (!inReader.StartArray()) {
+                return;
+            }
+            while (inReader.NextElement()) {
+                T element;
+                JsonSerializer<T>::JsonRead(inReader, element);
+                outValue.emplace_back(std::move(element));
+            }
+        }
     };
 
     template <JsonSerializable T>
@@ -1334,6 +2489,29 @@ namespace Common {
                 outValue.emplace(std::move(element));
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::unordered_set<T>& inValue)
+        {
+            inWriter.StartArray();
+            for (const auto& element : inValue) {
+                JsonSerializer<T>::JsonWrite(inWriter, element);
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::unordered_set<T>& outValue)
+        {
+            outValue.clear();
+
+            if (!inReader.StartArray()) {
+                return;
+            }
+            while (inReader.NextElement()) {
+                T element;
+                JsonSerializer<T>::JsonRead(inReader, element);
+                outValue.emplace(std::move(element));
+            }
+        }
     };
 
     template <JsonSerializable T>
@@ -1362,6 +2540,29 @@ namespace Common {
                 outValue.emplace(std::move(element));
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::set<T>& inValue)
+        {
+            inWriter.StartArray();
+            for (const auto& element : inValue) {
+                JsonSerializer<T>::JsonWrite(inWriter, element);
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::set<T>& outValue)
+        {
+            outValue.clear();
+
+            if (!inReader.StartArray()) {
+                return;
+            }
+            while (inReader.NextElement()) {
+                T element;
+                JsonSerializer<T>::JsonRead(inReader, element);
+                outValue.emplace(std::move(element));
+            }
+        }
     };
 
     template <JsonSerializable K, JsonSerializable V>
@@ -1391,6 +2592,29 @@ namespace Common {
                 outValue.emplace(std::move(pair));
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::unordered_map<K, V>& inValue)
+        {
+            inWriter.StartArray();
+            for (const auto& pair : inValue) {
+                JsonSerializer<std::pair<K, V>>::JsonWrite(inWriter, pair);
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::unordered_map<K, V>& outValue)
+        {
+            outValue.clear();
+
+            if (!inReader.StartArray()) {
+                return;
+            }
+            while (inReader.NextElement()) {
+                std::pair<K, V> pair;
+                JsonSerializer<std::pair<K, V>>::JsonRead(inReader, pair);
+                outValue.emplace(std::move(pair));
+            }
+        }
     };
 
     template <JsonSerializable K, JsonSerializable V>
@@ -1419,6 +2643,29 @@ namespace Common {
                 outValue.emplace(std::move(pair));
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::map<K, V>& inValue)
+        {
+            inWriter.StartArray();
+            for (const auto& pair : inValue) {
+                JsonSerializer<std::pair<K, V>>::JsonWrite(inWriter, pair);
+            }
+            inWriter.EndArray();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::map<K, V>& outValue)
+        {
+            outValue.clear();
+
+            if (!inReader.StartArray()) {
+                return;
+            }
+            while (inReader.NextElement()) {
+                std::pair<K, V> pair;
+                JsonSerializer<std::pair<K, V>>::JsonRead(inReader, pair);
+                outValue.emplace(std::move(pair));
+            }
+        }
     };
 
     template <JsonSerializable... T>
@@ -1466,5 +2713,50 @@ namespace Common {
             }
             JsonDeserializeInternal(inJsonValue, outValue, std::make_index_sequence<sizeof...(T)>());
         }
+
+        template <size_t... I>
+        static void JsonWriteInternal(JsonWriter& inWriter, const std::tuple<T...>& inValue, std::index_sequence<I...>)
+        {
+            std::initializer_list<int> { ([&]() -> void {
+                inWriter.Key(std::to_string(I));
+                JsonSerializer<T>::JsonWrite(inWriter, std::get<I>(inValue));
+            }(), 0)... };
+        }
+
+        template <size_t... I>
+        static void JsonReadInternal(JsonReader& inReader, std::string_view inKey, std::tuple<T...>& outValue, std::index_sequence<I...>)
+        {
+            const bool matched = ([&]() -> bool {
+                if (inKey != std::to_string(I)) {
+                    return false;
+                }
+                JsonSerializer<T>::JsonRead(inReader, std::get<I>(outValue));
+                return true;
+            }() || ...);
+
+            if (!matched) {
+                inReader.Skip();
+            }
+        }
+
+        static void JsonWrite(JsonWriter& inWriter, const std::tuple<T...>& inValue)
+        {
+            inWriter.StartObject();
+            JsonWriteInternal(inWriter, inValue, std::make_index_sequence<sizeof...(T)>());
+            inWriter.EndObject();
+        }
+
+        static void JsonRead(JsonReader& inReader, std::tuple<T...>& outValue)
+        {
+            outValue = {};
+
+            if (!inReader.StartObject()) {
+                return;
+            }
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                JsonReadInternal(inReader, key, outValue, std::make_index_sequence<sizeof...(T)>());
+            }
+        }
     };
 }
@@ -0,0 +1,332 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <variant>
+#include <optional>
+#include <functional>
+#include <type_traits>
+#include <condition_variable>
+
+#include <Common/Concurrent.h>
+#include <Common/Debug.h>
+
+namespace Common {
+    template <typename T> class TaskFuture;
+
+    // shared task executor, tasks submitted to executor should never block on other tasks, use Then/WhenAll to express dependencies instead
+    class TaskExecutor {
+    public:
+        // sized to hardware concurrency. Common is linked statically into every shared module, the process wide instance is
+        // owned by Core and installed into each module by Core::InstallSharedExecutors(), a module not installed yet
+        // (e.g. Common tests) falls back to an executor of its own
+        static TaskExecutor& Shared();
+        static void SetShared(TaskExecutor* inExecutor);
+
+        TaskExecutor(const std::string& inName, uint8_t inThreadNum);
+        ~TaskExecutor();
+        NonCopyable(TaskExecutor)
+        NonMovable(TaskExecutor)
+
+        template <typename F> auto Async(F&& inTask);
+        template <typename F> void Dispatch(F&& inTask);
+        uint8_t ThreadNum() const;
+
+    private:
+        ThreadPool threadPool;
+    };
+
+    namespace Internal {
+        template <typename T>
+        using TaskValueType = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+        template <typename T>
+        class TaskState {
+        public:
+            TaskState();
+
+            template <typename... V> void SetValue(V&&... inValue);
+            // continuation will be invoked in the thread which complete the task, or immediately if task already completed
+            void AddContinuation(std::function<void()>&& inContinuation);
+            void Wait();
+            bool Ready();
+            const TaskValueType<T>& Value() const;
+
+        private:
+            std::mutex mutex;
+            std::condition_variable condition;
+            bool ready;
+            std::optional<TaskValueType<T>> value;
+            std::vector<std::function<void()>> continuations;
+        };
+
+        template <typename T, typename F, typename... Args>
+        void FulfillTaskState(TaskState<T>& inState, F& inTask, Args&&... inArgs);
+
+        template <typename F, typename T>
+        struct ContinuationResult {
+            using Type = std::invoke_result_t<F, const T&>;
+        };
+
+        template <typename F>
+        struct ContinuationResult<F, void> {
+            using Type = std::invoke_result_t<F>;
+        };
+    }
+
+    template <typename T>
+    class TaskFuture {
+    public:
+        using ValueType = Internal::TaskValueType<T>;
+
+        TaskFuture();
+        TaskFuture(TaskExecutor& inExecutor, std::shared_ptr<Internal::TaskState<T>> inState);
+
+        // continuation is dispatched to the executor when this task completed, receive const T& or nothing for void task
+        template <typename F> auto Then(F&& inTask) const;
+        bool Valid() const;
+        bool Ready() const;
+        // blocking wait, do not call it inside executor tasks
+        void Wait() const;
+        const ValueType& Get() const;
+        TaskExecutor& Executor() const;
+
+    private:
+        template <typename U> friend class TaskFuture;
+        template <typename U> friend TaskFuture<std::conditional_t<std::is_void_v<U>, void, std::vector<U>>> WhenAll(const std::vector<TaskFuture<U>>& inFutures);
+        template <typename... U> friend TaskFuture<void> WhenAll(const TaskFuture<U>&... inFutures);
+
+        TaskExecutor* executor;
+        std::shared_ptr<Internal::TaskState<T>> state;
+    };
+
+    // fan-in, completed when all the given tasks completed, results are collected in order
+    template <typename T>
+    TaskFuture<std::conditional_t<std::is_void_v<T>, void, std::vector<T>>> WhenAll(const std::vector<TaskFuture<T>>& inFutures);
+
+    // dependency edges between heterogeneous tasks
+    template <typename... T>
+    TaskFuture<void> WhenAll(const TaskFuture<T>&... inFutures);
+}
+
+namespace Common::Internal {
+    template <typename T>
+    TaskState<T>::TaskState()
+        : ready(false)
+    {
+    }
+
+    template <typename T>
+    template <typename... V>
+    void TaskState<T>::SetValue(V&&... inValue)
+    {
+        std::vector<std::function<void()>> continuationsToInvoke;
+        {
+            std::unique_lock lock(mutex);
+            Assert(!ready);
+            value.emplace(std::forward<V>(inValue)...);
+            ready = true;
+            continuationsToInvoke.swap(continuations);
+        }
+        condition.notify_all();
+        for (auto& continuation : continuationsToInvoke) {
+            continuation();
+        }
+    }
+
+    template <typename T>
+    void TaskState<T>::AddContinuation(std::function<void()>&& inContinuation)
+    {
+        {
+            std::unique_lock lock(mutex);
+            if (!ready) {
+                continuations.emplace_back(std::move(inContinuation));
+                return;
+            }
+        }
+        inContinuation();
+    }
+
+    template <typename T>
+    void TaskState<T>::Wait()
+    {
+        std::unique_lock lock(mutex);
+        condition.wait(lock, [this]() -> bool { return ready; });
+    }
+
+    template <typename T>
+    bool TaskState<T>::Ready()
+    {
+        std::unique_lock lock(mutex);
+        return ready;
+    }
+
+    template <typename T>
+    const TaskValueType<T>& TaskState<T>::Value() const
+    {
+        return value.value();
+    }
+
+    template <typename T, typename F, typename... Args>
+    void FulfillTaskState(TaskState<T>& inState, F& inTask, Args&&... inArgs)
+    {
+        if constexpr (std::is_void_v<T>) {
+            std::invoke(inTask, std::forward<Args>(inArgs)...);
+            inState.SetValue();
+        } else {
+            inState.SetValue(std::invoke(inTask, std::forward<Args>(inArgs)...));
+        }
+    }
+}
+
+namespace Common {
+    template <typename F>
+    auto TaskExecutor::Async(F&& inTask)
+    {
+        using RetType = std::invoke_result_t<F>;
+        auto state = std::make_shared<Internal::TaskState<RetType>>();
+        Dispatch([state, task = std::forward<F>(inTask)]() mutable -> void {
+            Internal::FulfillTaskState(*state, task);
+        });
+        return TaskFuture<RetType>(*this, std::move(state));
+    }
+
+    template <typename F>
+    void TaskExecutor::Dispatch(F&& inTask)
+    {
+        threadPool.DispatchTask(std::forward<F>(inTask));
+    }
+
+    template <typename T>
+    TaskFuture<T>::TaskFuture()
+        : executor(nullptr)
+    {
+    }
+
+    template <typename T>
+    TaskFuture<T>::TaskFuture(TaskExecutor& inExecutor, std::shared_ptr<Internal::TaskState<T>> inState)
+        : executor(&inExecutor)
+        , state(std::move(inState))
+    {
+    }
+
+    template <typename T>
+    template <typename F>
+    auto TaskFuture<T>::Then(F&& inTask) const
+    {
+        Assert(Valid());
+        using RetType = typename Internal::ContinuationResult<std::decay_t<F>, T>::Type;
+        auto nextState = std::make_shared<Internal::TaskState<RetType>>();
+        state->AddContinuation([executor = executor, parentState = state, nextState, task = std::forward<F>(inTask)]() mutable -> void {
+            executor->Dispatch([parentState = std::move(parentState), nextState = std::move(nextState), task = std::move(task)]() mutable -> void {
+                if constexpr (std::is_void_v<T>) {
+                    Internal::FulfillTaskState(*nextState, task);
+                } else {
+                    Internal::FulfillTaskState(*nextState, task, parentState->Value());
+                }
+            });
+        });
+        return TaskFuture<RetType>(*executor, std::move(nextState));
+    }
+
+    template <typename T>
+    bool TaskFuture<T>::Valid() const
+    {
+        return state != nullptr;
+    }
+
+    template <typename T>
+    bool TaskFuture<T>::Ready() const
+    {
+        Assert(Valid());
+        return state->Ready();
+    }
+
+    template <typename T>
+    void TaskFuture<T>::Wait() const
+    {
+        Assert(Valid());
+        state->Wait();
+    }
+
+    template <typename T>
+    const typename TaskFuture<T>::ValueType& TaskFuture<T>::Get() const
+    {
+        Wait();
+        return state->Value();
+    }
+
+    template <typename T>
+    TaskExecutor& TaskFuture<T>::Executor() const
+    {
+        Assert(executor != nullptr);
+        return *executor;
+    }
+
+    template <typename T>
+    TaskFuture<std::conditional_t<std::is_void_v<T>, void, std::vector<T>>> WhenAll(const std::vector<TaskFuture<T>>& inFutures)
+    {
+        using RetType = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+        auto& executor = inFutures.empty() ? TaskExecutor::Shared() : inFutures[0].Executor();
+        auto resultState = std::make_shared<Internal::TaskState<RetType>>();
+        if (inFutures.empty()) {
+            resultState->SetValue();
+            return TaskFuture<RetType>(executor, std::move(resultState));
+        }
+
+        std::vector<std::shared_ptr<Internal::TaskState<T>>> states;
+        states.reserve(inFutures.size());
+        for (const auto& future : inFutures) {
+            Assert(future.Valid());
+            states.emplace_back(future.state);
+        }
+
+        auto remaining = std::make_shared<std::atomic<size_t>>(states.size());
+        for (const auto& state : states) {
+            state->AddContinuation([remaining, resultState, states]() -> void {
+                if (remaining->fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    return;
+                }
+                if constexpr (std::is_void_v<T>) {
+                    resultState->SetValue();
+                } else {
+                    std::vector<T> values;
+                    values.reserve(states.size());
+                    for (const auto& s : states) {
+                        values.emplace_back(s->Value());
+                    }
+                    resultState->SetValue(std::move(values));
+                }
+            });
+        }
+        return TaskFuture<RetType>(executor, std::move(resultState));
+    }
+
+    template <typename... T>
+    TaskFuture<void> WhenAll(const TaskFuture<T>&... inFutures)
+    {
+        auto resultState = std::make_shared<Internal::TaskState<void>>();
+        if constexpr (sizeof...(T) == 0) {
+            resultState->SetValue();
+            return TaskFuture<void>(TaskExecutor::Shared(), std::move(resultState));
+        } else {
+            auto& executor = std::get<0>(std::tie(inFutures...)).Executor();
+            auto remaining = std::make_shared<std::atomic<size_t>>(sizeof...(T));
+            auto onCompleted = [remaining, resultState]() -> void {
+                if (remaining->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    resultState->SetValue();
+                }
+            };
+            (Assert(inFutures.Valid()), ...);
+            (inFutures.state->AddContinuation(onCompleted), ...);
+            return TaskFuture<void>(executor, std::move(resultState));
+        }
+    }
+}
@@ -0,0 +1,518 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+#include <Common/Allocator.h>
+
+namespace Common::Internal {
+    // recycles default sized pages between linear allocators
+    class PagePool {
+    public:
+        static constexpr size_t maxCachedPageNum = 256;
+
+        static PagePool& Get()
+        {
+            static PagePool instance;
+            return instance;
+        }
+
+        ~PagePool()
+        {
+            for (auto* page : pages) {
+                ::operator delete(page);
+            }
+        }
+
+        void* Acquire(size_t inSize)
+        {
+            if (inSize == LinearAllocator::defaultPageSize) {
+                std::unique_lock lock(mutex);
+                if (!pages.empty()) {
+                    auto* result = pages.back();
+                    pages.pop_back();
+                    return result;
+                }
+            }
+            return ::operator new(inSize);
+        }
+
+        void Release(void* inPage, size_t inSize)
+        {
+            if (inSize == LinearAllocator::defaultPageSize) {
+                std::unique_lock lock(mutex);
+                if (pages.size() < maxCachedPageNum) {
+                    pages.emplace_back(inPage);
+                    return;
+                }
+            }
+            ::operator delete(inPage);
+        }
+
+    private:
+        PagePool() = default;
+
+        std::mutex mutex;
+        std::vector<void*> pages;
+    };
+}
+
+namespace Common {
+    LinearAllocator::LinearAllocator(size_t inPageSize)
+        : pageSize(inPageSize)
+        , currentPage(nullptr)
+        , freePages(nullptr)
+        , cursor(nullptr)
+        , end(nullptr)
+        , usedBytes(0)
+    {
+        Assert(pageSize > pageHeaderSize);
+    }
+
+    LinearAllocator::~LinearAllocator()
+    {
+        Reset();
+        while (freePages != nullptr) {
+            auto* page = freePages;
+            freePages = page->prev;
+            Internal::PagePool::Get().Release(page, page->size);
+        }
+    }
+
+    void* LinearAllocator::Allocate(size_t inSize, size_t inAlignment)
+    {
+        Assert(inAlignment > 0 && (inAlignment & (inAlignment - 1)) == 0);
+        const auto alignCursor = [&]() -> uint8_t* {
+            return reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(cursor) + inAlignment - 1) & ~(inAlignment - 1));
+        };
+
+        auto* aligned = alignCursor();
+        if (cursor == nullptr || aligned + inSize > end) {
+            AcquirePage(inSize + inAlignment);
+            aligned = alignCursor();
+        }
+        cursor = aligned + inSize;
+        usedBytes += inSize;
+        return aligned;
+    }
+
+    LinearAllocator::Marker LinearAllocator::Mark() const
+    {
+        return { currentPage, cursor, usedBytes };
+    }
+
+    void LinearAllocator::Rewind(const Marker& inMarker)
+    {
+        while (currentPage != inMarker.page) {
+            Assert(currentPage != nullptr);
+            auto* page = currentPage;
+            currentPage = page->prev;
+            ReleasePage(page);
+        }
+        cursor = inMarker.cursor;
+        end = currentPage == nullptr ? nullptr : reinterpret_cast<uint8_t*>(currentPage) + currentPage->size;
+        usedBytes = inMarker.usedBytes;
+    }
+
+    void LinearAllocator::Reset()
+    {
+        Rewind({ nullptr, nullptr, 0 });
+    }
+
+    size_t LinearAllocator::UsedBytes() const
+    {
+        return usedBytes;
+    }
+
+    size_t LinearAllocator::PageSize() const
+    {
+        return pageSize;
+    }
+
+    void LinearAllocator::AcquirePage(size_t inMinDataSize)
+    {
+        Page* page;
+        if (inMinDataSize + pageHeaderSize <= pageSize && freePages != nullptr) {
+            page = freePages;
+            freePages = page->prev;
+        } else {
+            const auto size = std::max(pageSize, inMinDataSize + pageHeaderSize);
+            page = static_cast<Page*>(Internal::PagePool::Get().Acquire(size));
+            page->size = size;
+        }
+        page->prev = currentPage;
+        currentPage = page;
+        cursor = reinterpret_cast<uint8_t*>(page) + pageHeaderSize;
+        end = reinterpret_cast<uint8_t*>(page) + page->size;
+    }
+
+    void LinearAllocator::ReleasePage(Page* inPage)
+    {
+        // keep pages in default size for reuse, oversized pages go back to heap at once
+        if (inPage->size == pageSize) {
+            inPage->prev = freePages;
+            freePages = inPage;
+        } else {
+            Internal::PagePool::Get().Release(inPage, inPage->size);
+        }
+    }
+
+    LinearAllocator& FrameArena::Get()
+    {
+        static thread_local LinearAllocator allocator;
+        return allocator;
+    }
+
+    void* FrameArena::Allocate(size_t inSize, size_t inAlignment)
+    {
+        return Get().Allocate(inSize, inAlignment);
+    }
+
+    void FrameArena::Reset()
+    {
+        Get().Reset();
+    }
+
+    FrameArenaMark::FrameArenaMark()
+        : marker(FrameArena::Get().Mark())
+    {
+    }
+
+    FrameArenaMark::~FrameArenaMark()
+    {
+        FrameArena::Get().Rewind(marker);
+    }
+}
+
+namespace Common::Internal {
+    static constexpr size_t smallObjectClassNum = 16;
+    static constexpr size_t smallObjectSpanSize = 64 * 1024;
+    static constexpr size_t memoryTagNum = static_cast<size_t>(MemoryTag::max);
+
+    static size_t SizeToClass(size_t inSize)
+    {
+        const auto size = std::max<size_t>(inSize, 1);
+        if (size <= 128) {
+            return (size + 15) / 16 - 1;
+        }
+        if (size <= 256) {
+            return 8 + (size - 129) / 32;
+        }
+        return 12 + (size - 257) / 64;
+    }
+
+    static constexpr size_t ClassToSize(size_t inClass)
+    {
+        if (inClass < 8) {
+            return (inClass + 1) * 16;
+        }
+        if (inClass < 12) {
+            return 128 + (inClass - 7) * 32;
+        }
+        return 256 + (inClass - 11) * 64;
+    }
+
+    static constexpr size_t ClassToBatchSize(size_t inClass)
+    {
+        return std::clamp<size_t>(8192 / ClassToSize(inClass), 8, 128);
+    }
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct FreeBatch {
+        FreeBlock* head;
+        size_t count;
+    };
+
+    class CentralFreeList {
+    public:
+        FreeBatch PopBatch(size_t inClass)
+        {
+            auto& bucket = buckets[inClass];
+            std::unique_lock lock(bucket.mutex);
+            if (!bucket.batches.empty()) {
+                const auto result = bucket.batches.back();
+                bucket.batches.pop_back();
+                return result;
+            }
+            if (bucket.partial.count > 0) {
+                return std::exchange(bucket.partial, { nullptr, 0 });
+            }
+
+            // carve a new span, spans are never returned to system
+            const auto size = ClassToSize(inClass);
+            const auto batchSize = ClassToBatchSize(inClass);
+            const auto blockNum = std::max<size_t>(smallObjectSpanSize / size, batchSize);
+            auto* span = static_cast<uint8_t*>(::operator new(blockNum * size));
+
+            FreeBatch result { nullptr, 0 };
+            for (size_t i = 0; i < blockNum; i++) {
+                auto* block = reinterpret_cast<FreeBlock*>(span + i * size);
+                if (result.count < batchSize) {
+                    block->next = result.head;
+                    result.head = block;
+                    result.count++;
+                } else {
+                    PushInternal(bucket, block, batchSize);
+                }
+            }
+            return result;
+        }
+
+        void PushBatch(size_t inClass, const FreeBatch& inBatch)
+        {
+            auto& bucket = buckets[inClass];
+            std::unique_lock lock(bucket.mutex);
+            bucket.batches.emplace_back(inBatch);
+        }
+
+    private:
+        struct Bucket {
+            std::mutex mutex;
+            std::vector<FreeBatch> batches;
+            FreeBatch partial { nullptr, 0 };
+        };
+
+        static void PushInternal(Bucket& inBucket, FreeBlock* inBlock, size_t inBatchSize)
+        {
+            inBlock->next = inBucket.partial.head;
+            inBucket.partial.head = inBlock;
+            if (++inBucket.partial.count == inBatchSize) {
+                inBucket.batches.emplace_back(inBucket.partial);
+                inBucket.partial = { nullptr, 0 };
+            }
+        }
+
+        std::array<Bucket, smallObjectClassNum> buckets;
+    };
+
+    // leaked intentionally, blocks may still be freed during static destruction
+    static CentralFreeList& GetCentralFreeList()
+    {
+        static auto* instance = new CentralFreeList();
+        return *instance;
+    }
+
+    class ThreadCache;
+
+    static thread_local bool threadCacheDestroyed = false;
+
+    // live thread caches and the stats of exited threads
+    class ThreadCacheRegistry {
+    public:
+        static ThreadCacheRegistry& Get()
+        {
+            static auto* instance = new ThreadCacheRegistry();
+            return *instance;
+        }
+
+        void Register(ThreadCache* inCache);
+        void Unregister(ThreadCache* inCache);
+        MemoryTagStats GetStats(MemoryTag inTag);
+
+    private:
+        std::mutex mutex;
+        std::vector<ThreadCache*> caches;
+        std::array<MemoryTagStats, memoryTagNum> retiredStats {};
+    };
+
+    class ThreadCache {
+    public:
+        ThreadCache()
+            : lists()
+        {
+            for (auto& stat : stats) {
+                stat.bytes.store(0, std::memory_order_relaxed);
+                stat.allocations.store(0, std::memory_order_relaxed);
+            }
+            ThreadCacheRegistry::Get().Register(this);
+        }
+
+        ~ThreadCache()
+        {
+            Flush();
+            ThreadCacheRegistry::Get().Unregister(this);
+            threadCacheDestroyed = true;
+        }
+
+        void* Allocate(size_t inClass)
+        {
+            auto& list = lists[inClass];
+            if (list.head == nullptr) {
+                const auto batch = GetCentralFreeList().PopBatch(inClass);
+                list.head = batch.head;
+                list.count = batch.count;
+            }
+            auto* block = list.head;
+            list.head = block->next;
+            list.count--;
+            return block;
+        }
+
+        void Deallocate(void* inPtr, size_t inClass)
+        {
+            auto& list = lists[inClass];
+            auto* block = static_cast<FreeBlock*>(inPtr);
+            block->next = list.head;
+            list.head = block;
+            list.count++;
+
+            // give one batch back to central list, blocks freed by other threads flow back to allocating threads in this way
+            if (const auto batchSize = ClassToBatchSize(inClass);
+                list.count >= batchSize * 2) {
+                FreeBatch batch { list.head, batchSize };
+                auto* tail = list.head;
+                for (size_t i = 1; i < batchSize; i++) {
+                    tail = tail->next;
+                }
+                list.head = tail->next;
+                list.count -= batchSize;
+                tail->next = nullptr;
+                GetCentralFreeList().PushBatch(inClass, batch);
+            }
+        }
+
+        void Flush()
+        {
+            for (size_t i = 0; i < smallObjectClassNum; i++) {
+                auto& list = lists[i];
+                if (list.head != nullptr) {
+                    GetCentralFreeList().PushBatch(i, { list.head, list.count });
+                    list = { nullptr, 0 };
+                }
+            }
+        }
+
+        void Record(MemoryTag inTag, int64_t inBytes, int64_t inAllocations)
+        {
+            // only written by owner thread, no need to use read-modify-write
+            auto& stat = stats[static_cast<size_t>(inTag)];
+            stat.bytes.store(stat.bytes.load(std::memory_order_relaxed) + inBytes, std::memory_order_relaxed);
+            stat.allocations.store(stat.allocations.load(std::memory_order_relaxed) + inAllocations, std::memory_order_relaxed);
+        }
+
+        MemoryTagStats GetStats(MemoryTag inTag) const
+        {
+            const auto& stat = stats[static_cast<size_t>(inTag)];
+            return { stat.bytes.load(std::memory_order_relaxed), stat.allocations.load(std::memory_order_relaxed) };
+        }
+
+    private:
+        struct AtomicStats {
+            std::atomic<int64_t> bytes;
+            std::atomic<int64_t> allocations;
+        };
+
+        std::array<FreeBatch, smallObjectClassNum> lists;
+        std::array<AtomicStats, memoryTagNum> stats;
+    };
+
+    void ThreadCacheRegistry::Register(ThreadCache* inCache)
+    {
+        std::unique_lock lock(mutex);
+        caches.emplace_back(inCache);
+    }
+
+    void ThreadCacheRegistry::Unregister(ThreadCache* inCache)
+    {
+        std::unique_lock lock(mutex);
+        for (size_t i = 0; i < memoryTagNum; i++) {
+            const auto stats = inCache->GetStats(static_cast<MemoryTag>(i));
+            retiredStats[i].bytes += stats.bytes;
+            retiredStats[i].allocations += stats.allocations;
+        }
+        caches.erase(std::find(caches.begin(), caches.end(), inCache));
+    }
+
+    MemoryTagStats ThreadCacheRegistry::GetStats(MemoryTag inTag)
+    {
+        std::unique_lock lock(mutex);
+        auto result = retiredStats[static_cast<size_t>(inTag)];
+        for (const auto* cache : caches) {
+            const auto stats = cache->GetStats(inTag);
+            result.bytes += stats.bytes;
+            result.allocations += stats.allocations;
+        }
+        return result;
+    }
+
+    // returns nullptr when thread cache is already destructed at thread exit
+    static ThreadCache* GetThreadCache()
+    {
+        if (threadCacheDestroyed) {
+            return nullptr;
+        }
+        static thread_local ThreadCache cache;
+        return &cache;
+    }
+}
+
+namespace Common {
+    void* SmallObjectAllocator::Allocate(size_t inSize, MemoryTag inTag)
+    {
+        auto* cache = Internal::GetThreadCache();
+        if (cache != nullptr) {
+            cache->Record(inTag, static_cast<int64_t>(inSize), 1);
+        }
+        if (inSize > maxSmallSize) {
+            return ::operator new(inSize);
+        }
+
+        const auto sizeClass = Internal::SizeToClass(inSize);
+        if (cache != nullptr) {
+            return cache->Allocate(sizeClass);
+        }
+        auto batch = Internal::GetCentralFreeList().PopBatch(sizeClass);
+        auto* result = batch.head;
+        batch.head = result->next;
+        batch.count--;
+        if (batch.count > 0) {
+            Internal::GetCentralFreeList().PushBatch(sizeClass, batch);
+        }
+        return result;
+    }
+
+    void SmallObjectAllocator::Deallocate(void* inPtr, size_t inSize, MemoryTag inTag)
+    {
+        if (inPtr == nullptr) {
+            return;
+        }
+        auto* cache = Internal::GetThreadCache();
+        if (cache != nullptr) {
+            cache->Record(inTag, -static_cast<int64_t>(inSize), -1);
+        }
+        if (inSize > maxSmallSize) {
+            ::operator delete(inPtr);
+            return;
+        }
+
+        const auto sizeClass = Internal::SizeToClass(inSize);
+        if (cache != nullptr) {
+            cache->Deallocate(inPtr, sizeClass);
+            return;
+        }
+        auto* block = static_cast<Internal::FreeBlock*>(inPtr);
+        block->next = nullptr;
+        Internal::GetCentralFreeList().PushBatch(sizeClass, { block, 1 });
+    }
+
+    MemoryTagStats SmallObjectAllocator::GetStats(MemoryTag inTag)
+    {
+        return Internal::ThreadCacheRegistry::Get().GetStats(inTag);
+    }
+
+    void SmallObjectAllocator::FlushThreadCache()
+    {
+        if (auto* cache = Internal::GetThreadCache();
+            cache != nullptr) {
+            cache->Flush();
+        }
+    }
+}
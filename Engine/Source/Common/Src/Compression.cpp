@@ -0,0 +1,198 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include <Common/Compression.h>
+
+namespace Common::Internal {
+    static constexpr size_t lzMinMatch = 4;
+    // last sequence must keep at least 5 literals, last match must start 12 bytes before end
+    static constexpr size_t lzLastLiterals = 5;
+    static constexpr size_t lzMatchFindLimit = 12;
+    static constexpr size_t lzMaxOffset = 65535;
+    static constexpr uint32_t lzHashLog = 16;
+    static constexpr uint32_t lzSkipTrigger = 6;
+
+    static uint32_t LzRead32(const uint8_t* inData)
+    {
+        uint32_t result;
+        memcpy(&result, inData, sizeof(uint32_t));
+        return result;
+    }
+
+    static uint32_t LzHash(uint32_t inSequence)
+    {
+        return (inSequence * 2654435761u) >> (32 - lzHashLog);
+    }
+
+    static bool LzWriteLength(uint8_t*& ioDst, const uint8_t* inDstEnd, size_t inLength)
+    {
+        for (; inLength >= 255; inLength -= 255) {
+            if (ioDst >= inDstEnd) {
+                return false;
+            }
+            *ioDst++ = 255;
+        }
+        if (ioDst >= inDstEnd) {
+            return false;
+        }
+        *ioDst++ = static_cast<uint8_t>(inLength);
+        return true;
+    }
+
+    static bool LzWriteSequence(uint8_t*& ioDst, const uint8_t* inDstEnd, const uint8_t* inLiterals, size_t inLiteralLength, size_t inOffset, size_t inMatchLength)
+    {
+        if (ioDst >= inDstEnd) {
+            return false;
+        }
+        uint8_t* token = ioDst++;
+        *token = static_cast<uint8_t>(std::min(inLiteralLength, static_cast<size_t>(15)) << 4);
+        if (inLiteralLength >= 15 && !LzWriteLength(ioDst, inDstEnd, inLiteralLength - 15)) {
+            return false;
+        }
+        if (static_cast<size_t>(inDstEnd - ioDst) < inLiteralLength) {
+            return false;
+        }
+        if (inLiteralLength > 0) {
+            memcpy(ioDst, inLiterals, inLiteralLength);
+            ioDst += inLiteralLength;
+        }
+
+        // last sequence carries literals only
+        if (inMatchLength == 0) {
+            return true;
+        }
+        if (inDstEnd - ioDst < 2) {
+            return false;
+        }
+        *ioDst++ = static_cast<uint8_t>(inOffset & 0xff);
+        *ioDst++ = static_cast<uint8_t>(inOffset >> 8);
+
+        const auto matchLength = inMatchLength - lzMinMatch;
+        *token |= static_cast<uint8_t>(std::min(matchLength, static_cast<size_t>(15)));
+        return matchLength < 15 || LzWriteLength(ioDst, inDstEnd, matchLength - 15);
+    }
+}
+
+namespace Common {
+    size_t CompressionUtils::LzCompressBound(size_t inSize)
+    {
+        return inSize + inSize / 255 + 16;
+    }
+
+    size_t CompressionUtils::LzCompress(const void* inSrc, size_t inSrcSize, void* outDst, size_t inDstCapacity)
+    {
+        const auto* src = static_cast<const uint8_t*>(inSrc);
+        auto* dst = static_cast<uint8_t*>(outDst);
+        const auto* dstEnd = dst + inDstCapacity;
+
+        size_t anchor = 0;
+        if (inSrcSize > Internal::lzMatchFindLimit) {
+            // entries left by previous calls are validated against source bytes, so the table never needs clearing
+            thread_local std::vector<uint32_t> table;
+            table.resize(static_cast<size_t>(1) << Internal::lzHashLog);
+
+            const auto matchLimit = inSrcSize - Internal::lzLastLiterals;
+            const auto searchLimit = inSrcSize - Internal::lzMatchFindLimit;
+            for (size_t pos = 0; pos < searchLimit;) {
+                const auto sequence = Internal::LzRead32(src + pos);
+                auto& entry = table[Internal::LzHash(sequence)];
+                const size_t candidate = entry;
+                entry = static_cast<uint32_t>(pos);
+
+                if (candidate >= pos || pos - candidate > Internal::lzMaxOffset || Internal::LzRead32(src + candidate) != sequence) {
+                    // step faster through data which does not compress
+                    pos += 1 + ((pos - anchor) >> Internal::lzSkipTrigger);
+                    continue;
+                }
+
+                size_t matchLength = Internal::lzMinMatch;
+                while (pos + matchLength < matchLimit && src[candidate + matchLength] == src[pos + matchLength]) {
+                    matchLength++;
+                }
+                if (!Internal::LzWriteSequence(dst, dstEnd, src + anchor, pos - anchor, pos - candidate, matchLength)) {
+                    return 0;
+                }
+                pos += matchLength;
+                anchor = pos;
+                if (pos - 2 < searchLimit) {
+                    table[Internal::LzHash(Internal::LzRead32(src + pos - 2))] = static_cast<uint32_t>(pos - 2);
+                }
+            }
+        }
+
+        if (!Internal::LzWriteSequence(dst, dstEnd, src + anchor, inSrcSize - anchor, 0, 0)) {
+            return 0;
+        }
+        return dst - static_cast<uint8_t*>(outDst);
+    }
+
+    bool CompressionUtils::LzDecompress(const void* inSrc, size_t inSrcSize, void* outDst, size_t inDstSize)
+    {
+        const auto* src = static_cast<const uint8_t*>(inSrc);
+        auto* dst = static_cast<uint8_t*>(outDst);
+        size_t srcPos = 0;
+        size_t dstPos = 0;
+
+        const auto readLength = [&](size_t& ioLength) -> bool {
+            uint8_t byte;
+            do {
+                if (srcPos >= inSrcSize) {
+                    return false;
+                }
+                byte = src[srcPos++];
+                ioLength += byte;
+            } while (byte == 255);
+            return true;
+        };
+
+        while (srcPos < inSrcSize) {
+            const auto token = src[srcPos++];
+            size_t literalLength = token >> 4;
+            if (literalLength == 15 && !readLength(literalLength)) {
+                return false;
+            }
+            if (literalLength > inSrcSize - srcPos || literalLength > inDstSize - dstPos) {
+                return false;
+            }
+            if (literalLength > 0) {
+                memcpy(dst + dstPos, src + srcPos, literalLength);
+                srcPos += literalLength;
+                dstPos += literalLength;
+            }
+
+            if (srcPos == inSrcSize) {
+                break;
+            }
+            if (inSrcSize - srcPos < 2) {
+                return false;
+            }
+            const size_t offset = src[srcPos] | (static_cast<size_t>(src[srcPos + 1]) << 8);
+            srcPos += 2;
+            size_t matchLength = token & 15;
+            if (matchLength == 15 && !readLength(matchLength)) {
+                return false;
+            }
+            matchLength += Internal::lzMinMatch;
+            if (offset == 0 || offset > dstPos || matchLength > inDstSize - dstPos) {
+                return false;
+            }
+
+            const auto* match = dst + dstPos - offset;
+            if (offset >= matchLength) {
+                memcpy(dst + dstPos, match, matchLength);
+            } else {
+                // overlapped match repeats the last offset bytes
+                for (size_t i = 0; i < matchLength; i++) {
+                    dst[dstPos + i] = match[i];
+                }
+            }
+            dstPos += matchLength;
+        }
+        return dstPos == inDstSize;
+    }
+}
@@ -11,6 +11,8 @@
 #include <Common/Concurrent.h>
 
 namespace Common {
+    static thread_local const WorkerThread* currentWorkerThread = nullptr;
+
     NamedThread::NamedThread() = default;
 
     void NamedThread::Join()
@@ -25,7 +27,7 @@ namespace Common {
 #elif PLATFORM_MACOS
         pthread_setname_np(name.c_str());
 #else
-        pthread_setname_np(thread.native_handle(), name.c_str());
+        pthread_setname_np(pthread_self(), name.c_str());
 #endif
     }
 
@@ -65,63 +67,81 @@ namespace Common {
         }
     }
 
-    WorkerThread::WorkerThread(const std::string& name)
+    uint8_t ThreadPool::ThreadNum() const
+    {
+        return static_cast<uint8_t>(threads.size());
+    }
+
+    WorkerThread::WorkerThread(const std::string& name, size_t inCommandCapacity)
         : stop(false)
-        , flush(false)
+        , sleeping(false)
+        , signal(0)
+        , commands(inCommandCapacity)
     {
         thread = NamedThread(name, [this]() -> void {
+            currentWorkerThread = this;
             while (true) {
-                bool needNotifyMainThread = false;
-                std::vector<std::function<void()>> tasksToExecute;
-                {
-                    std::unique_lock lock(mutex);
-                    taskCondition.wait(lock, [this]() -> bool { return stop || flush || !tasks.empty(); });
-                    if (stop && tasks.empty()) {
-                        return;
-                    }
-                    if (flush) {
-                        tasksToExecute.reserve(tasks.size());
-                        while (!tasks.empty()) {
-                            tasksToExecute.emplace_back(std::move(tasks.front()));
-                            tasks.pop();
-                        }
-                        flush = false;
-                        needNotifyMainThread = true;
-                    } else {
-                        tasksToExecute.emplace_back(std::move(tasks.front()));
-                        tasks.pop();
-                    }
+                if (ExecuteCommands() > 0) {
+                    continue;
                 }
-                for (auto& task : tasksToExecute) {
-                    task();
+                if (stop.load(std::memory_order_acquire)) {
+                    while (ExecuteCommands() > 0) {}
+                    return;
                 }
-                if (needNotifyMainThread) {
-                    flushCondition.notify_one();
+
+                const auto ticket = signal.load(std::memory_order_acquire);
+                sleeping.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (commands.Empty() && !stop.load(std::memory_order_acquire)) {
+                    signal.wait(ticket, std::memory_order_acquire);
                 }
+                sleeping.store(false, std::memory_order_relaxed);
             }
         });
     }
 
     WorkerThread::~WorkerThread()
     {
-        {
-            std::unique_lock lock(mutex);
-            stop = true;
-        }
-        taskCondition.notify_all();
+        stop.store(true, std::memory_order_release);
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_one();
         thread.Join();
     }
 
     void WorkerThread::Flush()
     {
-        {
-            std::unique_lock lock(mutex);
-            flush = true;
+        EmplaceTask([]() -> void {}).wait();
+    }
+
+    bool WorkerThread::IsCurrentThread() const
+    {
+        return currentWorkerThread == this;
+    }
+
+    size_t WorkerThread::ExecuteCommands()
+    {
+        size_t count = 0;
+        while (true) {
+            if (!overflowCommands.empty() && overflowCommands.front().first <= commands.DequeuedNum()) {
+                // command may spill new commands, so pop it before executing
+                auto command = std::move(overflowCommands.front().second);
+                overflowCommands.pop();
+                command();
+            } else if (!commands.TryExecuteOne()) {
+                // when overflow commands still wait for an in flight ring command, its producer will notify after publishing
+                return count;
+            }
+            count++;
         }
-        taskCondition.notify_one();
-        {
-            std::unique_lock lock(mutex);
-            flushCondition.wait(lock);
+    }
+
+    void WorkerThread::Notify()
+    {
+        // only pay for the wake up syscall when consumer is going to sleep
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping.load(std::memory_order_relaxed)) {
+            signal.fetch_add(1, std::memory_order_release);
+            signal.notify_one();
         }
     }
 }
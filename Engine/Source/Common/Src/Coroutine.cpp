@@ -0,0 +1,136 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <Common/Coroutine.h>
+#include <Common/File.h>
+
+namespace Common::Internal {
+    bool TaskPromiseBase::FinalAwaiter::await_ready() const noexcept // NOLINT
+    {
+        return false;
+    }
+
+    void TaskPromiseBase::FinalAwaiter::await_resume() const noexcept {} // NOLINT
+
+    std::suspend_always TaskPromiseBase::initial_suspend() const noexcept // NOLINT
+    {
+        return {};
+    }
+
+    TaskPromiseBase::FinalAwaiter TaskPromiseBase::final_suspend() const noexcept // NOLINT
+    {
+        return {};
+    }
+
+    void TaskPromiseBase::unhandled_exception() const // NOLINT
+    {
+        QuickFailWithReason("unhandled exception in coroutine task");
+    }
+
+    void TaskPromiseBase::SetContinuation(std::coroutine_handle<> inContinuation)
+    {
+        continuation = inContinuation;
+    }
+
+    Task<void> TaskPromise<void>::get_return_object() // NOLINT
+    {
+        return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    void TaskPromise<void>::return_void() const {} // NOLINT
+
+    void TaskPromise<void>::Result() const {} // NOLINT
+
+    DetachedCoroutine DetachedCoroutine::promise_type::get_return_object() const // NOLINT
+    {
+        return {};
+    }
+
+    std::suspend_never DetachedCoroutine::promise_type::initial_suspend() const noexcept // NOLINT
+    {
+        return {};
+    }
+
+    std::suspend_never DetachedCoroutine::promise_type::final_suspend() const noexcept // NOLINT
+    {
+        return {};
+    }
+
+    void DetachedCoroutine::promise_type::return_void() const {} // NOLINT
+
+    void DetachedCoroutine::promise_type::unhandled_exception() const // NOLINT
+    {
+        QuickFailWithReason("unhandled exception in coroutine task");
+    }
+}
+
+namespace Common {
+    ExecutorAwaiter::ExecutorAwaiter(TaskExecutor& inExecutor)
+        : executor(inExecutor)
+    {
+    }
+
+    bool ExecutorAwaiter::await_ready() const noexcept // NOLINT
+    {
+        return false;
+    }
+
+    void ExecutorAwaiter::await_suspend(std::coroutine_handle<> inHandle) const // NOLINT
+    {
+        executor.Dispatch([inHandle]() -> void { inHandle.resume(); });
+    }
+
+    void ExecutorAwaiter::await_resume() const noexcept {} // NOLINT
+
+    WorkerThreadAwaiter::WorkerThreadAwaiter(WorkerThread& inWorkerThread, TaskExecutor* inResumeExecutor)
+        : workerThread(inWorkerThread)
+        , resumeExecutor(inResumeExecutor)
+    {
+    }
+
+    bool WorkerThreadAwaiter::await_ready() const noexcept // NOLINT
+    {
+        return false;
+    }
+
+    void WorkerThreadAwaiter::await_suspend(std::coroutine_handle<> inHandle) const // NOLINT
+    {
+        if (resumeExecutor == nullptr) {
+            workerThread.DispatchTask([inHandle]() -> void { inHandle.resume(); });
+        } else {
+            workerThread.DispatchTask([inHandle, executor = resumeExecutor]() -> void {
+                executor->Dispatch([inHandle]() -> void { inHandle.resume(); });
+            });
+        }
+    }
+
+    void WorkerThreadAwaiter::await_resume() const noexcept {} // NOLINT
+
+    ExecutorAwaiter SwitchTo(TaskExecutor& inExecutor)
+    {
+        return ExecutorAwaiter(inExecutor);
+    }
+
+    WorkerThreadAwaiter SwitchTo(WorkerThread& inWorkerThread)
+    {
+        return { inWorkerThread, nullptr };
+    }
+
+    WorkerThreadAwaiter WaitForFlush(WorkerThread& inWorkerThread, TaskExecutor& inResumeExecutor)
+    {
+        return { inWorkerThread, &inResumeExecutor };
+    }
+
+    Task<std::vector<uint8_t>> ReadBinaryFileAsync(std::string inFileName, TaskExecutor& inExecutor) // NOLINT
+    {
+        co_await SwitchTo(inExecutor);
+        co_return FileUtils::ReadBinaryFile(inFileName);
+    }
+
+    Task<std::string> ReadTextFileAsync(std::string inFileName, TaskExecutor& inExecutor) // NOLINT
+    {
+        co_await SwitchTo(inExecutor);
+        co_return FileUtils::ReadTextFile(inFileName);
+    }
+}
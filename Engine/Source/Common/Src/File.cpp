@@ -3,6 +3,16 @@
 //
 
 #include <fstream>
+#include <utility>
+
+#if PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #include <Common/File.h>
 #include <Common/Debug.h>
@@ -22,4 +32,155 @@ namespace Common {
         }
         return result;
     }
+
+    std::vector<uint8_t> FileUtils::ReadBinaryFile(const std::string& fileName)
+    {
+        std::vector<uint8_t> result;
+        {
+            std::ifstream file(fileName, std::ios::ate | std::ios::binary);
+            Assert(file.is_open());
+            const size_t size = file.tellg();
+            result.resize(size);
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(result.data()), static_cast<std::streamsize>(size));
+            file.close();
+        }
+        return result;
+    }
+
+    MappedFile::MappedFile()
+        : valid(false)
+        , data(nullptr)
+        , size(0)
+#if PLATFORM_WINDOWS
+        , fileHandle(nullptr)
+        , mappingHandle(nullptr)
+#endif
+    {
+    }
+
+    MappedFile::MappedFile(const std::string& inFileName)
+        : MappedFile()
+    {
+#if PLATFORM_WINDOWS
+        HANDLE file = CreateFileA(inFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize)) {
+            CloseHandle(file);
+            return;
+        }
+        fileHandle = file;
+        size = static_cast<size_t>(fileSize.QuadPart);
+        valid = true;
+        if (size == 0) {
+            return;
+        }
+
+        mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mappingHandle != nullptr ? MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (view == nullptr) {
+            Close();
+            return;
+        }
+        data = static_cast<const uint8_t*>(view);
+#else
+        const int file = open(inFileName.c_str(), O_RDONLY);
+        if (file < 0) {
+            return;
+        }
+        struct stat fileStat {};
+        if (fstat(file, &fileStat) != 0) {
+            close(file);
+            return;
+        }
+        size = static_cast<size_t>(fileStat.st_size);
+        valid = true;
+        if (size == 0) {
+            close(file);
+            return;
+        }
+
+        // mapping keeps a reference to the file, descriptor is not needed anymore
+        void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+        close(file);
+        if (view == MAP_FAILED) {
+            valid = false;
+            size = 0;
+            return;
+        }
+        madvise(view, size, MADV_SEQUENTIAL);
+        data = static_cast<const uint8_t*>(view);
+#endif
+    }
+
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& inOther) noexcept
+        : valid(std::exchange(inOther.valid, false))
+        , data(std::exchange(inOther.data, nullptr))
+        , size(std::exchange(inOther.size, 0))
+#if PLATFORM_WINDOWS
+        , fileHandle(std::exchange(inOther.fileHandle, nullptr))
+        , mappingHandle(std::exchange(inOther.mappingHandle, nullptr))
+#endif
+    {
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& inOther) noexcept
+    {
+        Close();
+        valid = std::exchange(inOther.valid, false);
+        data = std::exchange(inOther.data, nullptr);
+        size = std::exchange(inOther.size, 0);
+#if PLATFORM_WINDOWS
+        fileHandle = std::exchange(inOther.fileHandle, nullptr);
+        mappingHandle = std::exchange(inOther.mappingHandle, nullptr);
+#endif
+        return *this;
+    }
+
+    bool MappedFile::IsValid() const
+    {
+        return valid;
+    }
+
+    const uint8_t* MappedFile::Data() const
+    {
+        return data;
+    }
+
+    size_t MappedFile::Size() const
+    {
+        return size;
+    }
+
+    void MappedFile::Close()
+    {
+#if PLATFORM_WINDOWS
+        if (data != nullptr) {
+            UnmapViewOfFile(data);
+        }
+        if (mappingHandle != nullptr) {
+            CloseHandle(mappingHandle);
+            mappingHandle = nullptr;
+        }
+        if (fileHandle != nullptr) {
+            CloseHandle(fileHandle);
+            fileHandle = nullptr;
+        }
+#else
+        if (data != nullptr) {
+            munmap(const_cast<uint8_t*>(data), size);
+        }
+#endif
+        valid = false;
+        data = nullptr;
+        size = 0;
+    }
 }
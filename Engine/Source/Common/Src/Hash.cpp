@@ -2,8 +2,145 @@
 // Created by johnk on 2024/4/14.
 //
 
+#include <cstring>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define HASH_X64_CRC 1
+#include <nmmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define HASH_ARM64_CRC 1
+#include <arm_acle.h>
+#if PLATFORM_LINUX
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+#endif
+
+#if COMPILER_MSVC
+#include <intrin.h>
+#endif
+
 #include <Common/Hash.h>
 
+namespace Common::Internal {
+    // secrets of wyhash
+    static constexpr uint64_t hashSecrets[6] = {
+        0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull,
+        0x589965cc75374cc3ull, 0x1d8e4e27c47d124full, 0x2d358dccaa6c78a5ull
+    };
+
+    static uint64_t Read64(const uint8_t* inData)
+    {
+        uint64_t result;
+        memcpy(&result, inData, sizeof(uint64_t));
+        return result;
+    }
+
+    // fold 128-bit product of two 64-bit values
+    static uint64_t Mum(uint64_t inLhs, uint64_t inRhs)
+    {
+#if COMPILER_MSVC
+        uint64_t high;
+        const uint64_t low = _umul128(inLhs, inRhs, &high);
+        return low ^ high;
+#else
+        const auto product = static_cast<unsigned __int128>(inLhs) * inRhs;
+        return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#endif
+    }
+
+    static constexpr std::array<uint32_t, 256> crc32CTable = []() -> std::array<uint32_t, 256> {
+        std::array<uint32_t, 256> result {};
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (auto j = 0; j < 8; j++) {
+                crc = (crc >> 1) ^ (crc & 1 ? 0x82f63b78 : 0);
+            }
+            result[i] = crc;
+        }
+        return result;
+    }();
+
+    using Crc32CFunc = uint32_t(*)(uint32_t, const uint8_t*, size_t);
+
+    static uint32_t Crc32CSoftware(uint32_t inCrc, const uint8_t* inData, size_t inLength)
+    {
+        for (auto i = 0; i < inLength; i++) {
+            inCrc = (inCrc >> 8) ^ crc32CTable[(inCrc ^ inData[i]) & 0xff];
+        }
+        return inCrc;
+    }
+
+#if HASH_X64_CRC
+#if !COMPILER_MSVC
+    __attribute__((target("sse4.2")))
+#endif
+    static uint32_t Crc32CHardware(uint32_t inCrc, const uint8_t* inData, size_t inLength)
+    {
+        uint64_t crc = inCrc;
+        for (; inLength >= 8; inLength -= 8, inData += 8) {
+            crc = _mm_crc32_u64(crc, Read64(inData));
+        }
+        for (; inLength > 0; inLength--, inData++) {
+            crc = _mm_crc32_u8(static_cast<uint32_t>(crc), *inData);
+        }
+        return static_cast<uint32_t>(crc);
+    }
+
+    static bool CpuSupportsCrc32C()
+    {
+#if COMPILER_MSVC
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 20)) != 0;
+#else
+        return __builtin_cpu_supports("sse4.2");
+#endif
+    }
+#elif HASH_ARM64_CRC
+#if !COMPILER_MSVC
+    __attribute__((target("crc")))
+#endif
+    static uint32_t Crc32CHardware(uint32_t inCrc, const uint8_t* inData, size_t inLength)
+    {
+        for (; inLength >= 8; inLength -= 8, inData += 8) {
+            inCrc = __crc32cd(inCrc, Read64(inData));
+        }
+        for (; inLength > 0; inLength--, inData++) {
+            inCrc = __crc32cb(inCrc, *inData);
+        }
+        return inCrc;
+    }
+
+    static bool CpuSupportsCrc32C()
+    {
+#if PLATFORM_LINUX
+        return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#else
+        // crc instructions are mandatory since ARMv8.1, which all supported apple and windows arm64 devices implement
+        return true;
+#endif
+    }
+#endif
+
+    static Crc32CFunc SelectCrc32C()
+    {
+#if HASH_X64_CRC || HASH_ARM64_CRC
+        if (CpuSupportsCrc32C()) {
+            return &Crc32CHardware;
+        }
+#endif
+        return &Crc32CSoftware;
+    }
+
+    static Crc32CFunc GetCrc32C()
+    {
+        static const Crc32CFunc func = SelectCrc32C();
+        return func;
+    }
+}
+
 namespace Common {
     uint32_t HashUtils::StrCrc32(const char* str, size_t length)
     {
@@ -23,4 +160,96 @@ namespace Common {
     {
         return CityHash64(static_cast<const char*>(buffer), length);
     }
+
+    uint64_t HashUtils::Hash64(const void* buffer, size_t length, uint64_t seed)
+    {
+        return Hasher(seed).Update(buffer, length).Finish();
+    }
+
+    uint32_t HashUtils::Crc32C(const void* buffer, size_t length, uint32_t seed)
+    {
+        return ~Internal::GetCrc32C()(~seed, static_cast<const uint8_t*>(buffer), length);
+    }
+
+    bool HashUtils::IsCrc32CAccelerated()
+    {
+        return Internal::GetCrc32C() != &Internal::Crc32CSoftware;
+    }
+
+    Hasher::Hasher(uint64_t inSeed)
+        : lanes()
+        , buffer()
+        , bufferSize(0)
+        , totalSize(0)
+    {
+        Reset(inSeed);
+    }
+
+    Hasher& Hasher::Update(const void* inData, size_t inSize)
+    {
+        const auto* data = static_cast<const uint8_t*>(inData);
+        totalSize += inSize;
+
+        if (bufferSize > 0) {
+            const auto copySize = std::min(inSize, stripeSize - bufferSize);
+            memcpy(buffer.data() + bufferSize, data, copySize);
+            bufferSize += copySize;
+            data += copySize;
+            inSize -= copySize;
+            if (bufferSize < stripeSize) {
+                return *this;
+            }
+            ConsumeStripe(lanes, buffer.data());
+            bufferSize = 0;
+        }
+
+        for (; inSize >= stripeSize; inSize -= stripeSize, data += stripeSize) {
+            ConsumeStripe(lanes, data);
+        }
+        if (inSize > 0) {
+            memcpy(buffer.data(), data, inSize);
+            bufferSize = inSize;
+        }
+        return *this;
+    }
+
+    Hasher& Hasher::Update(std::string_view inString)
+    {
+        Update(static_cast<uint64_t>(inString.size()));
+        return Update(inString.data(), inString.size());
+    }
+
+    uint64_t Hasher::Finish() const
+    {
+        auto finalLanes = lanes;
+        if (bufferSize > 0) {
+            // tail is zero padded, total size is mixed below so that padding can not collide with real zeros
+            std::array<uint8_t, stripeSize> tail {};
+            memcpy(tail.data(), buffer.data(), bufferSize);
+            ConsumeStripe(finalLanes, tail.data());
+        }
+
+        const auto& secrets = Internal::hashSecrets;
+        const auto result = Internal::Mum(finalLanes[0] ^ secrets[3], finalLanes[1] ^ secrets[4]) ^ finalLanes[2];
+        return Internal::Mum(result ^ totalSize ^ secrets[5], result ^ secrets[1]);
+    }
+
+    void Hasher::Reset(uint64_t inSeed)
+    {
+        const auto& secrets = Internal::hashSecrets;
+        for (auto i = 0; i < lanes.size(); i++) {
+            lanes[i] = Internal::Mum(inSeed ^ secrets[i], secrets[i + 3]);
+        }
+        bufferSize = 0;
+        totalSize = 0;
+    }
+
+    void Hasher::ConsumeStripe(std::array<uint64_t, 3>& ioLanes, const uint8_t* inStripe)
+    {
+        const auto& secrets = Internal::hashSecrets;
+        for (auto i = 0; i < ioLanes.size(); i++) {
+            const auto lane = ioLanes[i];
+            ioLanes[i] = Internal::Mum(Internal::Read64(inStripe + i * 16) ^ secrets[i], Internal::Read64(inStripe + i * 16 + 8) ^ lane) ^ lane;
+        }
+    }
 }
@@ -0,0 +1,128 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <Common/Memory.h>
+#include <Common/Debug.h>
+
+namespace Common {
+    RefCounted::RefCounted()
+        : refCount(0)
+        , weakBlock(nullptr)
+    {
+    }
+
+    RefCounted::RefCounted(const RefCounted&)
+        : refCount(0)
+        , weakBlock(nullptr)
+    {
+    }
+
+    RefCounted& RefCounted::operator=(const RefCounted&) // NOLINT
+    {
+        return *this;
+    }
+
+    RefCounted::~RefCounted()
+    {
+        // weak references observe the count has dropped to zero before here, detach it so they never touch this object again
+        if (auto* block = weakBlock.load(std::memory_order_acquire);
+            block != nullptr) {
+            block->Detach();
+        }
+    }
+
+    void RefCounted::AddRef() const
+    {
+        // new references are always created from an existing one, no ordering is needed
+        refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void RefCounted::Release() const
+    {
+        // all the writes from other owners must be visible to the deleting thread
+        if (refCount.fetch_sub(1, std::memory_order_release) != 1) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        delete this;
+    }
+
+    uint32_t RefCounted::RefCount() const
+    {
+        return refCount.load(std::memory_order_relaxed);
+    }
+
+    bool RefCounted::IsUnique() const
+    {
+        // acquire pairs with release of other owners, so the caller can safely reuse the object
+        return refCount.load(std::memory_order_acquire) == 1;
+    }
+
+    Internal::WeakRefBlock* RefCounted::AcquireWeakBlock() const
+    {
+        auto* block = weakBlock.load(std::memory_order_acquire);
+        if (block != nullptr) {
+            return block;
+        }
+
+        auto* newBlock = new Internal::WeakRefBlock(this);
+        if (weakBlock.compare_exchange_strong(block, newBlock, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return newBlock;
+        }
+        delete newBlock;
+        return block;
+    }
+}
+
+namespace Common::Internal {
+    WeakRefBlock::WeakRefBlock(const RefCounted* inObject)
+        : object(inObject)
+        , refCount(1)
+    {
+    }
+
+    void WeakRefBlock::AddRef()
+    {
+        refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void WeakRefBlock::Release()
+    {
+        if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    bool WeakRefBlock::TryLock()
+    {
+        // object can not be destroyed while holding the mutex, see Detach()
+        std::unique_lock lock(mutex);
+        if (object == nullptr) {
+            return false;
+        }
+        auto count = object->refCount.load(std::memory_order_relaxed);
+        while (count != 0) {
+            if (object->refCount.compare_exchange_weak(count, count + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool WeakRefBlock::Expired()
+    {
+        std::unique_lock lock(mutex);
+        return object == nullptr || object->RefCount() == 0;
+    }
+
+    void WeakRefBlock::Detach()
+    {
+        {
+            std::unique_lock lock(mutex);
+            Assert(object != nullptr);
+            object = nullptr;
+        }
+        Release();
+    }
+}
@@ -0,0 +1,74 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <atomic>
+
+#include <taskflow/taskflow.hpp>
+
+#include <Common/Parallel.h>
+
+namespace Common::Internal {
+    // not owned, see SetParallelExecutor()
+    static std::atomic<tf::Executor*> installedExecutor = nullptr;
+
+    static tf::Executor& GetParallelExecutor()
+    {
+        if (auto* executor = installedExecutor.load(std::memory_order_acquire); executor != nullptr) {
+            return *executor;
+        }
+        static tf::Executor executor;
+        return executor;
+    }
+
+    // nested parallel calls fall back to serial instead of blocking a worker on wait(), worker is queried from executor
+    // instead of a flag of our own, so the check holds for calls from other modules sharing the executor
+    static bool IsParallelWorker()
+    {
+        return GetParallelExecutor().this_worker_id() >= 0;
+    }
+
+    ParallelChunks ComputeParallelChunks(size_t inCount, size_t inGrainSize)
+    {
+        const auto grainSize = std::max(inGrainSize, static_cast<size_t>(1));
+        const auto workerNum = ParallelWorkerNum();
+        if (inCount <= grainSize || workerNum <= 1 || IsParallelWorker()) {
+            return { 1, inCount };
+        }
+
+        // a few chunks per worker for load balance, but never smaller than grain size
+        const auto chunkNum = std::min((inCount + grainSize - 1) / grainSize, workerNum * 4);
+        const auto chunkSize = (inCount + chunkNum - 1) / chunkNum;
+        return { (inCount + chunkSize - 1) / chunkSize, chunkSize };
+    }
+
+    void ParallelRunChunks(size_t inChunkNum, ParallelChunkFunc inFunc, void* inContext)
+    {
+        if (inChunkNum == 1) {
+            inFunc(inContext, 0);
+            return;
+        }
+
+        tf::Taskflow taskflow;
+        for (size_t i = 0; i < inChunkNum; i++) {
+            taskflow.emplace([inFunc, inContext, i]() -> void {
+                inFunc(inContext, i);
+            });
+        }
+        GetParallelExecutor()
+            .run(taskflow)
+            .wait();
+    }
+}
+
+namespace Common {
+    size_t ParallelWorkerNum()
+    {
+        return Internal::GetParallelExecutor().num_workers();
+    }
+
+    void SetParallelExecutor(tf::Executor* inExecutor)
+    {
+        Internal::installedExecutor.store(inExecutor, std::memory_order_release);
+    }
+}
@@ -2,14 +2,1018 @@
 // Created by johnk on 2023/7/13.
 //
 
+#include <atomic>
+
 #include <Common/Serialization.h>
+#include <Common/Compression.h>
+#include <Common/Parallel.h>
+
+namespace Common::Internal {
+    // compressed stream layout:
+    // uint32_t magic, uint32_t version, uint64_t blockSize  : header
+    // uint8_t[] blocks                                       : lz compressed, or raw when compressedSize == rawSize
+    // { uint64_t offset, uint32_t compressedSize, uint32_t rawSize }[] : seek table, offset from header begin
+    // uint64_t blockCount, uint64_t rawSize, uint32_t magic : footer
+    static constexpr uint32_t compressedStreamMagic = 0x4243584c;
+    static constexpr uint32_t compressedStreamVersion = 1;
+    static constexpr size_t compressedStreamHeaderSize = sizeof(uint32_t) * 2 + sizeof(uint64_t);
+    static constexpr size_t compressedStreamTableEntrySize = sizeof(uint64_t) + sizeof(uint32_t) * 2;
+    static constexpr size_t compressedStreamFooterSize = sizeof(uint64_t) * 2 + sizeof(uint32_t);
+
+    static void SeekTo(BinaryDeserializeStream& inStream, size_t inLoc)
+    {
+        inStream.Seek(static_cast<int64_t>(inLoc) - static_cast<int64_t>(inStream.Loc()));
+    }
+
+    static size_t CompressBatchSize()
+    {
+        return std::max(ParallelWorkerNum(), static_cast<size_t>(1));
+    }
+
+    // serialize header layout, always fixed encoding:
+    // uint32_t magic, uint8_t version, uint8_t intEncoding, uint16_t flags
+    // with schema table flag the payload is followed by the table and a fixed uint64_t table size
+    static constexpr uint32_t serializeHeaderMagic = 0x48535845;
+    static constexpr uint8_t serializeHeaderVersion = 2;
+    static constexpr size_t serializeHeaderSize = sizeof(uint32_t) + sizeof(uint8_t) * 2 + sizeof(uint16_t);
+    static constexpr uint16_t serializeHeaderSchemaTableFlag = 1 << 0;
+}
 
 namespace Common {
-    BinarySerializeStream::BinarySerializeStream() = default;
+    BinarySerializeStream::BinarySerializeStream()
+        : intEncoding(SerializeIntEncoding::fixed)
+        , schemaTable(nullptr)
+        , frameSizeState(FrameSizeState::none)
+        , frameSizeCursor(0)
+    {
+    }
 
     BinarySerializeStream::~BinarySerializeStream() = default;
 
-    BinaryDeserializeStream::BinaryDeserializeStream() = default;
+    SerializeFraming BinarySerializeStream::Framing()
+    {
+        return SerializeFraming::seek;
+    }
+
+    SerializeIntEncoding BinarySerializeStream::IntEncoding() const
+    {
+        return intEncoding;
+    }
+
+    void BinarySerializeStream::SetIntEncoding(SerializeIntEncoding inEncoding)
+    {
+        // sizes recorded by an ongoing size pass would not match
+        Assert(frameSizeState == FrameSizeState::none);
+        intEncoding = inEncoding;
+    }
+
+    SerializeSchemaTable* BinarySerializeStream::SchemaTable() const
+    {
+        return schemaTable;
+    }
+
+    void BinarySerializeStream::SetSchemaTable(SerializeSchemaTable* inSchemaTable)
+    {
+        Assert(frameSizeState == FrameSizeState::none);
+        schemaTable = inSchemaTable;
+    }
+
+    FrameSizeSlots::FrameSizeSlots(BinarySerializeStream& inStream, size_t inCount)
+        : stream(inStream)
+        , count(inCount)
+        , begin(0)
+    {
+        using State = BinarySerializeStream::FrameSizeState;
+        const bool varint = stream.IntEncoding() == SerializeIntEncoding::varint;
+        if (stream.frameSizeState == State::recording) {
+            begin = stream.frameSizes.size();
+            stream.frameSizes.resize(begin + count, 0);
+            // varint slots are accounted in Commit() when their values are known
+            if (!varint) {
+                stream.Seek(static_cast<int64_t>(SlotsSize()));
+            }
+        } else if (stream.frameSizeState == State::replaying) {
+            begin = stream.frameSizeCursor;
+            stream.frameSizeCursor += count;
+            Assert(stream.frameSizeCursor <= stream.frameSizes.size());
+            if (varint) {
+                for (auto i = 0; i < count; i++) {
+                    stream.WriteInteger<uint64_t>(stream.frameSizes[begin + i]);
+                }
+            } else {
+                stream.WriteBulk<uint64_t>(stream.frameSizes.data() + begin, count);
+            }
+        } else {
+            // varint slots can not be patched in place, SerializeFramed() always runs a size pass for them
+            Assert(!varint);
+            sizes.resize(count, 0);
+            stream.Seek(static_cast<int64_t>(SlotsSize()));
+        }
+    }
+
+    void FrameSizeSlots::Set(size_t inIndex, uint64_t inSize)
+    {
+        Assert(inIndex < count);
+        using State = BinarySerializeStream::FrameSizeState;
+        if (stream.frameSizeState == State::recording) {
+            stream.frameSizes[begin + inIndex] = inSize;
+        } else if (stream.frameSizeState == State::replaying) {
+            // serialization must be deterministic between size pass and writing pass
+            Assert(stream.frameSizes[begin + inIndex] == inSize);
+        } else {
+            sizes[inIndex] = inSize;
+        }
+    }
+
+    void FrameSizeSlots::Commit(size_t inContentSize)
+    {
+        using State = BinarySerializeStream::FrameSizeState;
+        if (stream.frameSizeState == State::recording && stream.IntEncoding() == SerializeIntEncoding::varint) {
+            stream.Seek(static_cast<int64_t>(SlotsSize()));
+        }
+        if (stream.frameSizeState != State::none) {
+            return;
+        }
+        const auto slotsSize = static_cast<int64_t>(SlotsSize());
+        stream.Seek(-slotsSize - static_cast<int64_t>(inContentSize));
+        stream.WriteBulk<uint64_t>(sizes.data(), count);
+        stream.Seek(static_cast<int64_t>(inContentSize));
+    }
+
+    size_t FrameSizeSlots::SlotsSize() const
+    {
+        if (stream.IntEncoding() == SerializeIntEncoding::fixed) {
+            return sizeof(uint64_t) * count;
+        }
+        size_t result = 0;
+        for (auto i = 0; i < count; i++) {
+            result += Internal::VarIntSize(stream.frameSizes[begin + i]);
+        }
+        return result;
+    }
+
+    SizeCounterSerializeStream::SizeCounterSerializeStream()
+        : pointer(0)
+        , totalSize(0)
+    {
+    }
+
+    SizeCounterSerializeStream::~SizeCounterSerializeStream() = default;
+
+    void SizeCounterSerializeStream::WriteInternal(const void* data, size_t size)
+    {
+        pointer += size;
+        totalSize = std::max(totalSize, pointer);
+    }
+
+    void SizeCounterSerializeStream::Seek(int64_t offset)
+    {
+        pointer += offset;
+    }
+
+    size_t SizeCounterSerializeStream::Loc()
+    {
+        return pointer;
+    }
+
+    std::endian SizeCounterSerializeStream::Endian()
+    {
+        return std::endian::native;
+    }
+
+    size_t SizeCounterSerializeStream::Size() const
+    {
+        return totalSize;
+    }
+
+    BinaryDeserializeStream::BinaryDeserializeStream()
+        : intEncoding(SerializeIntEncoding::fixed)
+        , schemaTable(nullptr)
+    {
+    }
 
     BinaryDeserializeStream::~BinaryDeserializeStream() = default;
+
+    SerializeIntEncoding BinaryDeserializeStream::IntEncoding() const
+    {
+        return intEncoding;
+    }
+
+    void BinaryDeserializeStream::SetIntEncoding(SerializeIntEncoding inEncoding)
+    {
+        intEncoding = inEncoding;
+    }
+
+    const SerializeSchemaTable* BinaryDeserializeStream::SchemaTable() const
+    {
+        return schemaTable;
+    }
+
+    void BinaryDeserializeStream::SetSchemaTable(const SerializeSchemaTable* inSchemaTable)
+    {
+        schemaTable = inSchemaTable;
+    }
+
+    SerializeSchemaTable::SerializeSchemaTable() = default;
+
+    const SerializeSchemaTable::Schema* SerializeSchemaTable::Find(uint32_t inIndex) const
+    {
+        return inIndex < schemas.size() ? &schemas[inIndex] : nullptr;
+    }
+
+    size_t SerializeSchemaTable::Num() const
+    {
+        return schemas.size();
+    }
+
+    size_t SerializeSchemaTable::Serialize(BinarySerializeStream& inStream) const
+    {
+        size_t serialized = Serializer<uint64_t>::Serialize(inStream, schemas.size());
+        for (const auto& schema : schemas) {
+            serialized += Serializer<std::string>::Serialize(inStream, schema.name);
+            serialized += Serializer<std::vector<std::string>>::Serialize(inStream, schema.fieldNames);
+        }
+        return serialized;
+    }
+
+    size_t SerializeSchemaTable::Deserialize(BinaryDeserializeStream& inStream)
+    {
+        schemas.clear();
+        indices.clear();
+
+        uint64_t count = 0;
+        size_t deserialized = Serializer<uint64_t>::Deserialize(inStream, count);
+        schemas.resize(count);
+        for (auto i = 0; i < count; i++) {
+            auto& schema = schemas[i];
+            deserialized += Serializer<std::string>::Deserialize(inStream, schema.name);
+            deserialized += Serializer<std::vector<std::string>>::Deserialize(inStream, schema.fieldNames);
+            indices.emplace(schema.name, static_cast<uint32_t>(i));
+        }
+        return deserialized;
+    }
+
+    size_t WriteSerializeHeader(BinarySerializeStream& inStream, SerializeIntEncoding inEncoding, SerializeSchemaTable* inSchemaTable)
+    {
+        Assert(inEncoding < SerializeIntEncoding::max);
+        inStream.Write<uint32_t>(Internal::serializeHeaderMagic);
+        inStream.Write<uint8_t>(Internal::serializeHeaderVersion);
+        inStream.Write<uint8_t>(static_cast<uint8_t>(inEncoding));
+        inStream.Write<uint16_t>(inSchemaTable != nullptr ? Internal::serializeHeaderSchemaTableFlag : 0);
+        inStream.SetIntEncoding(inEncoding);
+        inStream.SetSchemaTable(inSchemaTable);
+        return Internal::serializeHeaderSize;
+    }
+
+    size_t WriteSerializeFooter(BinarySerializeStream& inStream)
+    {
+        const auto* schemaTable = inStream.SchemaTable();
+        if (schemaTable == nullptr) {
+            return 0;
+        }
+
+        const uint64_t tableSize = schemaTable->Serialize(inStream);
+        inStream.Write<uint64_t>(tableSize);
+        return tableSize + sizeof(uint64_t);
+    }
+
+    bool ReadSerializeHeader(BinaryDeserializeStream& inStream, SerializeSchemaTable* outSchemaTable)
+    {
+        inStream.SetIntEncoding(SerializeIntEncoding::fixed);
+        inStream.SetSchemaTable(nullptr);
+        if (inStream.Size() - inStream.Loc() < Internal::serializeHeaderSize) {
+            return false;
+        }
+
+        uint32_t magic;
+        inStream.Read<uint32_t>(magic);
+        if (magic != Internal::serializeHeaderMagic) {
+            inStream.Seek(-static_cast<int64_t>(sizeof(uint32_t)));
+            return false;
+        }
+
+        uint8_t version;
+        uint8_t encoding;
+        uint16_t flags;
+        inStream.Read<uint8_t>(version);
+        inStream.Read<uint8_t>(encoding);
+        inStream.Read<uint16_t>(flags);
+        Assert(version <= Internal::serializeHeaderVersion && encoding < static_cast<uint8_t>(SerializeIntEncoding::max));
+        inStream.SetIntEncoding(static_cast<SerializeIntEncoding>(encoding));
+
+        if ((flags & Internal::serializeHeaderSchemaTableFlag) != 0) {
+            Assert(outSchemaTable != nullptr && inStream.Size() - inStream.Loc() >= sizeof(uint64_t));
+            const auto payloadBegin = inStream.Loc();
+            const auto tableEnd = inStream.Size() - sizeof(uint64_t);
+
+            uint64_t tableSize;
+            Internal::SeekTo(inStream, tableEnd);
+            inStream.Read<uint64_t>(tableSize);
+            Assert(tableSize <= tableEnd - payloadBegin);
+            Internal::SeekTo(inStream, tableEnd - tableSize);
+            outSchemaTable->Deserialize(inStream);
+            Internal::SeekTo(inStream, payloadBegin);
+            inStream.SetSchemaTable(outSchemaTable);
+        }
+        return true;
+    }
+
+    CompressedSerializeStream::CompressedSerializeStream(BinarySerializeStream& inStream, size_t inBlockSize)
+        : stream(inStream)
+        , blockSize(std::clamp(inBlockSize, static_cast<size_t>(64), static_cast<size_t>(UINT32_MAX)))
+        , streamBegin(inStream.Loc())
+        , pointer(0)
+        , blockPointer(0)
+        , blockUsed(0)
+        , block(blockSize)
+        , closed(false)
+    {
+        stream.Write<uint32_t>(Internal::compressedStreamMagic);
+        stream.Write<uint32_t>(Internal::compressedStreamVersion);
+        stream.Write<uint64_t>(blockSize);
+    }
+
+    CompressedSerializeStream::~CompressedSerializeStream()
+    {
+        Close();
+    }
+
+    void CompressedSerializeStream::WriteInternal(const void* data, size_t size)
+    {
+        Assert(!closed);
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        while (size > 0) {
+            if (blockPointer == blockSize) {
+                SubmitBlock();
+            }
+            const auto copySize = std::min(size, blockSize - blockPointer);
+            memcpy(block.data() + blockPointer, bytes, copySize);
+            blockPointer += copySize;
+            blockUsed = std::max(blockUsed, blockPointer);
+            pointer += copySize;
+            bytes += copySize;
+            size -= copySize;
+        }
+    }
+
+    void CompressedSerializeStream::Seek(int64_t offset)
+    {
+        if (offset < 0) {
+            Assert(static_cast<size_t>(-offset) <= blockPointer);
+            blockPointer += offset;
+            pointer += offset;
+            return;
+        }
+
+        static constexpr std::array<uint8_t, 64> zeros {};
+        for (auto remain = static_cast<size_t>(offset); remain > 0;) {
+            const auto num = std::min(remain, zeros.size());
+            WriteInternal(zeros.data(), num);
+            remain -= num;
+        }
+    }
+
+    size_t CompressedSerializeStream::Loc()
+    {
+        return pointer;
+    }
+
+    std::endian CompressedSerializeStream::Endian()
+    {
+        return stream.Endian();
+    }
+
+    SerializeFraming CompressedSerializeStream::Framing()
+    {
+        return SerializeFraming::sizePass;
+    }
+
+    void CompressedSerializeStream::Close()
+    {
+        if (closed) {
+            return;
+        }
+        if (blockUsed > 0) {
+            SubmitBlock();
+        }
+        FlushBlocks();
+
+        uint64_t rawSize = 0;
+        for (const auto& blockInfo : blockInfos) {
+            stream.Write<uint64_t>(blockInfo.offset);
+            stream.Write<uint32_t>(blockInfo.compressedSize);
+            stream.Write<uint32_t>(blockInfo.rawSize);
+            rawSize += blockInfo.rawSize;
+        }
+        stream.Write<uint64_t>(blockInfos.size());
+        stream.Write<uint64_t>(rawSize);
+        stream.Write<uint32_t>(Internal::compressedStreamMagic);
+        closed = true;
+    }
+
+    void CompressedSerializeStream::SubmitBlock()
+    {
+        block.resize(blockUsed);
+        pendingBlocks.emplace_back(std::move(block));
+        block = std::vector<uint8_t>(blockSize);
+        blockPointer = 0;
+        blockUsed = 0;
+
+        if (pendingBlocks.size() >= Internal::CompressBatchSize()) {
+            FlushBlocks();
+        }
+    }
+
+    void CompressedSerializeStream::FlushBlocks()
+    {
+        std::vector<size_t> rawSizes(pendingBlocks.size());
+        for (auto i = 0; i < pendingBlocks.size(); i++) {
+            rawSizes[i] = pendingBlocks[i].size();
+        }
+
+        // blocks which do not shrink are stored raw
+        std::vector<std::vector<uint8_t>> compressedBlocks(pendingBlocks.size());
+        ParallelFor(0, pendingBlocks.size(), [&](size_t inIndex) -> void {
+            auto& rawBlock = pendingBlocks[inIndex];
+            auto& compressedBlock = compressedBlocks[inIndex];
+            compressedBlock.resize(CompressionUtils::LzCompressBound(rawBlock.size()));
+
+            const auto compressedSize = CompressionUtils::LzCompress(rawBlock.data(), rawBlock.size(), compressedBlock.data(), compressedBlock.size());
+            if (compressedSize == 0 || compressedSize >= rawBlock.size()) {
+                compressedBlock = std::move(rawBlock);
+            } else {
+                compressedBlock.resize(compressedSize);
+            }
+        }, 1);
+
+        for (auto i = 0; i < pendingBlocks.size(); i++) {
+            const auto& compressedBlock = compressedBlocks[i];
+
+            BlockInfo blockInfo {};
+            blockInfo.offset = stream.Loc() - streamBegin;
+            blockInfo.compressedSize = static_cast<uint32_t>(compressedBlock.size());
+            blockInfo.rawSize = static_cast<uint32_t>(rawSizes[i]);
+            blockInfos.emplace_back(blockInfo);
+            stream.WriteBulk<uint8_t>(compressedBlock.data(), compressedBlock.size());
+        }
+        pendingBlocks.clear();
+    }
+
+    CompressedDeserializeStream::CompressedDeserializeStream(BinaryDeserializeStream& inStream)
+        : stream(inStream)
+        , streamBegin(inStream.Loc())
+        , blockSize(0)
+        , rawSize(0)
+        , pointer(0)
+        , valid(false)
+        , batchBegin(0)
+    {
+        const auto streamSize = stream.Size();
+        if (streamSize < streamBegin + Internal::compressedStreamHeaderSize + Internal::compressedStreamFooterSize) {
+            return;
+        }
+
+        uint32_t magic;
+        uint32_t version;
+        uint64_t tempBlockSize;
+        stream.Read<uint32_t>(magic);
+        stream.Read<uint32_t>(version);
+        stream.Read<uint64_t>(tempBlockSize);
+        if (magic != Internal::compressedStreamMagic || version != Internal::compressedStreamVersion || tempBlockSize == 0) {
+            return;
+        }
+        blockSize = static_cast<size_t>(tempBlockSize);
+
+        uint64_t blockCount;
+        uint64_t tempRawSize;
+        Internal::SeekTo(stream, streamSize - Internal::compressedStreamFooterSize);
+        stream.Read<uint64_t>(blockCount);
+        stream.Read<uint64_t>(tempRawSize);
+        stream.Read<uint32_t>(magic);
+        const auto tableSize = blockCount * Internal::compressedStreamTableEntrySize;
+        if (magic != Internal::compressedStreamMagic
+            || tableSize > streamSize - streamBegin - Internal::compressedStreamHeaderSize - Internal::compressedStreamFooterSize) {
+            return;
+        }
+
+        Internal::SeekTo(stream, streamSize - Internal::compressedStreamFooterSize - tableSize);
+        blockInfos.resize(blockCount);
+        uint64_t totalRawSize = 0;
+        for (auto& blockInfo : blockInfos) {
+            stream.Read<uint64_t>(blockInfo.offset);
+            stream.Read<uint32_t>(blockInfo.compressedSize);
+            stream.Read<uint32_t>(blockInfo.rawSize);
+            totalRawSize += blockInfo.rawSize;
+            // every block but the last one is full, reads locate blocks by pointer / blockSize
+            if (blockInfo.rawSize > blockSize || (&blockInfo != &blockInfos.back() && blockInfo.rawSize != blockSize)) {
+                return;
+            }
+        }
+        if (totalRawSize != tempRawSize) {
+            return;
+        }
+        rawSize = static_cast<size_t>(tempRawSize);
+        valid = true;
+    }
+
+    CompressedDeserializeStream::~CompressedDeserializeStream() = default;
+
+    bool CompressedDeserializeStream::IsCompressed(BinaryDeserializeStream& inStream)
+    {
+        if (inStream.Size() < inStream.Loc() + sizeof(uint32_t)) {
+            return false;
+        }
+        uint32_t magic;
+        inStream.Read<uint32_t>(magic);
+        inStream.Seek(-static_cast<int64_t>(sizeof(uint32_t)));
+        return magic == Internal::compressedStreamMagic;
+    }
+
+    bool CompressedDeserializeStream::IsValid() const
+    {
+        return valid;
+    }
+
+    void CompressedDeserializeStream::ReadInternal(void* data, size_t size)
+    {
+        auto* bytes = static_cast<uint8_t*>(data);
+        if (!valid || pointer + size > rawSize) {
+            Fail(bytes, size);
+            return;
+        }
+        while (size > 0) {
+            const auto blockIndex = pointer / blockSize;
+            const auto& rawBlock = GetBlock(blockIndex);
+            const auto blockOffset = pointer - blockIndex * blockSize;
+            if (!valid || blockOffset >= rawBlock.size()) {
+                Fail(bytes, size);
+                return;
+            }
+
+            const auto copySize = std::min(size, rawBlock.size() - blockOffset);
+            memcpy(bytes, rawBlock.data() + blockOffset, copySize);
+            pointer += copySize;
+            bytes += copySize;
+            size -= copySize;
+        }
+    }
+
+    void CompressedDeserializeStream::Seek(int64_t offset)
+    {
+        pointer += offset;
+    }
+
+    size_t CompressedDeserializeStream::Loc()
+    {
+        return pointer;
+    }
+
+    size_t CompressedDeserializeStream::Size()
+    {
+        return rawSize;
+    }
+
+    std::endian CompressedDeserializeStream::Endian()
+    {
+        return stream.Endian();
+    }
+
+    void CompressedDeserializeStream::Fail(uint8_t* data, size_t size)
+    {
+        // corrupt or truncated data, read zeros from now on and let owner reject the result by IsValid()
+        valid = false;
+        memset(data, 0, size);
+    }
+
+    const std::vector<uint8_t>& CompressedDeserializeStream::GetBlock(size_t index)
+    {
+        if (index < batchBegin || index >= batchBegin + batchBlocks.size()) {
+            DecompressBatch(index);
+        }
+        return batchBlocks[index - batchBegin];
+    }
+
+    void CompressedDeserializeStream::DecompressBatch(size_t firstIndex)
+    {
+        Assert(firstIndex < blockInfos.size());
+        const auto blockNum = std::min(Internal::CompressBatchSize(), blockInfos.size() - firstIndex);
+
+        // io stays serial on the inner stream, only decoding goes parallel
+        batchBegin = firstIndex;
+        batchBlocks.resize(blockNum);
+
+        const auto streamSize = stream.Size();
+        std::vector<std::vector<uint8_t>> compressedBlocks(blockNum);
+        for (auto i = 0; i < blockNum; i++) {
+            const auto& blockInfo = blockInfos[firstIndex + i];
+            if (streamBegin + blockInfo.offset + blockInfo.compressedSize > streamSize) {
+                valid = false;
+                return;
+            }
+            compressedBlocks[i].resize(blockInfo.compressedSize);
+            Internal::SeekTo(stream, streamBegin + blockInfo.offset);
+            stream.ReadBulk<uint8_t>(compressedBlocks[i].data(), blockInfo.compressedSize);
+        }
+
+        std::atomic<bool> corrupt = false;
+        ParallelFor(0, blockNum, [&](size_t inIndex) -> void {
+            const auto& blockInfo = blockInfos[firstIndex + inIndex];
+            auto& rawBlock = batchBlocks[inIndex];
+            if (blockInfo.compressedSize == blockInfo.rawSize) {
+                rawBlock = std::move(compressedBlocks[inIndex]);
+                return;
+            }
+            rawBlock.resize(blockInfo.rawSize);
+            if (!CompressionUtils::LzDecompress(compressedBlocks[inIndex].data(), compressedBlocks[inIndex].size(), rawBlock.data(), rawBlock.size())) {
+                corrupt.store(true, std::memory_order_relaxed);
+            }
+        }, 1);
+
+        if (corrupt.load(std::memory_order_relaxed)) {
+            valid = false;
+        }
+    }
+}
+
+namespace Common {
+    JsonOutputStream::JsonOutputStream(std::ostream* inStream)
+        : stream(inStream)
+    {
+    }
+
+    void JsonOutputStream::Put(Ch c)
+    {
+        buffer.push_back(c);
+        if (stream != nullptr && buffer.size() >= flushSize) {
+            Flush();
+        }
+    }
+
+    void JsonOutputStream::Flush()
+    {
+        if (stream == nullptr || buffer.empty()) {
+            return;
+        }
+        stream->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+
+    std::string_view JsonOutputStream::Str() const
+    {
+        Assert(stream == nullptr);
+        return buffer;
+    }
+
+    JsonWriter::JsonWriter()
+        : stream(nullptr)
+        , writer(stream)
+    {
+    }
+
+    JsonWriter::JsonWriter(std::ostream& inStream)
+        : stream(&inStream)
+        , writer(stream)
+    {
+    }
+
+    JsonWriter::~JsonWriter()
+    {
+        Flush();
+    }
+
+    void JsonWriter::Null()
+    {
+        writer.Null();
+    }
+
+    void JsonWriter::Bool(bool inValue)
+    {
+        writer.Bool(inValue);
+    }
+
+    void JsonWriter::Int(int32_t inValue)
+    {
+        writer.Int(inValue);
+    }
+
+    void JsonWriter::Uint(uint32_t inValue)
+    {
+        writer.Uint(inValue);
+    }
+
+    void JsonWriter::Int64(int64_t inValue)
+    {
+        writer.Int64(inValue);
+    }
+
+    void JsonWriter::Uint64(uint64_t inValue)
+    {
+        writer.Uint64(inValue);
+    }
+
+    void JsonWriter::Double(double inValue)
+    {
+        writer.Double(inValue);
+    }
+
+    void JsonWriter::String(std::string_view inValue)
+    {
+        writer.String(inValue.data(), static_cast<rapidjson::SizeType>(inValue.length()));
+    }
+
+    void JsonWriter::Key(std::string_view inKey)
+    {
+        writer.Key(inKey.data(), static_cast<rapidjson::SizeType>(inKey.length()));
+    }
+
+    void JsonWriter::StartObject()
+    {
+        writer.StartObject();
+    }
+
+    void JsonWriter::EndObject()
+    {
+        writer.EndObject();
+    }
+
+    void JsonWriter::StartArray()
+    {
+        writer.StartArray();
+    }
+
+    void JsonWriter::EndArray()
+    {
+        writer.EndArray();
+    }
+
+    bool JsonWriter::IsComplete() const
+    {
+        return writer.IsComplete();
+    }
+
+    void JsonWriter::Flush()
+    {
+        stream.Flush();
+    }
+
+    std::string_view JsonWriter::Str() const
+    {
+        return stream.Str();
+    }
+
+    // receives exactly one parser event per token and stores it as current token of reader
+    struct JsonReader::Handler : rapidjson::BaseReaderHandler<rapidjson::UTF8<>, Handler> {
+        explicit Handler(JsonReader& inReader)
+            : reader(inReader)
+            , received(false)
+        {
+        }
+
+        bool Emit(JsonTokenType inType)
+        {
+            reader.tokenType = inType;
+            received = true;
+            return true;
+        }
+
+        bool Signed(int64_t inValue)
+        {
+            reader.numberFlags = numberInt64;
+            reader.numberFlags |= inValue >= INT32_MIN && inValue <= INT32_MAX ? numberInt : 0;
+            reader.numberFlags |= inValue >= 0 ? numberUint64 : 0;
+            reader.numberFlags |= inValue >= 0 && inValue <= UINT32_MAX ? numberUint : 0;
+            reader.int64Value = inValue;
+            reader.uint64Value = static_cast<uint64_t>(inValue);
+            reader.doubleValue = static_cast<double>(inValue);
+            return Emit(JsonTokenType::number);
+        }
+
+        bool Unsigned(uint64_t inValue)
+        {
+            reader.numberFlags = numberUint64;
+            reader.numberFlags |= inValue <= UINT32_MAX ? numberUint : 0;
+            reader.numberFlags |= inValue <= INT64_MAX ? numberInt64 : 0;
+            reader.numberFlags |= inValue <= INT32_MAX ? numberInt : 0;
+            reader.int64Value = static_cast<int64_t>(inValue);
+            reader.uint64Value = inValue;
+            reader.doubleValue = static_cast<double>(inValue);
+            return Emit(JsonTokenType::number);
+        }
+
+        bool Null() { return Emit(JsonTokenType::null); }
+        bool Bool(bool inValue) { reader.boolValue = inValue; return Emit(JsonTokenType::boolean); }
+        bool Int(int inValue) { return Signed(inValue); }
+        bool Uint(unsigned inValue) { return Unsigned(inValue); }
+        bool Int64(int64_t inValue) { return Signed(inValue); }
+        bool Uint64(uint64_t inValue) { return Unsigned(inValue); }
+        bool Double(double inValue) { reader.numberFlags = 0; reader.doubleValue = inValue; return Emit(JsonTokenType::number); }
+        bool String(const char* inStr, rapidjson::SizeType inLength, bool) { reader.stringValue.assign(inStr, inLength); return Emit(JsonTokenType::string); }
+        bool Key(const char* inStr, rapidjson::SizeType inLength, bool) { reader.keyValue.assign(inStr, inLength); return Emit(JsonTokenType::key); }
+        bool StartObject() { return Emit(JsonTokenType::startObject); }
+        bool EndObject(rapidjson::SizeType) { return Emit(JsonTokenType::endObject); }
+        bool StartArray() { return Emit(JsonTokenType::startArray); }
+        bool EndArray(rapidjson::SizeType) { return Emit(JsonTokenType::endArray); }
+
+        JsonReader& reader;
+        bool received;
+    };
+
+    JsonReader::JsonReader(std::string_view inJson)
+        : stream(inJson.data(), inJson.size())
+        , tokenType(JsonTokenType::max)
+        , boolValue(false)
+        , numberFlags(0)
+        , int64Value(0)
+        , uint64Value(0)
+        , doubleValue(0)
+    {
+        reader.IterativeParseInit();
+        Next();
+    }
+
+    JsonReader::~JsonReader() = default;
+
+    JsonTokenType JsonReader::Peek() const
+    {
+        return tokenType;
+    }
+
+    bool JsonReader::HasError() const
+    {
+        return tokenType == JsonTokenType::error;
+    }
+
+    bool JsonReader::ReadNull()
+    {
+        if (tokenType != JsonTokenType::null) {
+            Skip();
+            return false;
+        }
+        Next();
+        return true;
+    }
+
+    bool JsonReader::ReadBool(bool& outValue)
+    {
+        if (tokenType != JsonTokenType::boolean) {
+            Skip();
+            return false;
+        }
+        outValue = boolValue;
+        Next();
+        return true;
+    }
+
+    bool JsonReader::ReadInt(int32_t& outValue)
+    {
+        if (tokenType != JsonTokenType::number || (numberFlags & numberInt) == 0) {
+            Skip();
+            return false;
+        }
+        outValue = static_cast<int32_t>(int64Value);
+        Next();
+        return true;
+    }
+
+    bool JsonReader::ReadUint(uint32_t& outValue)
+    {
+        if (tokenType != JsonTokenType::number || (numberFlags & numberUint) == 0) {
+            Skip();
+            return false;
+        }
+        outValue = static_cast<uint32_t>(uint64Value);
+        Next();
+        return true;
+    }
+
+    bool JsonReader::ReadInt64(int64_t& outValue)
+    {
+        if (tokenType != JsonTokenType::number || (numberFlags & numberInt64) == 0) {
+            Skip();
+            return false;
+        }
+        outValue = int64Value;
+        Next();
+        return true;
+    }
+
+    bool JsonReader::ReadUint64(uint64_t& outValue)
+    {
+        if (tokenType != JsonTokenType::number || (numberFlags & numberUint64) == 0) {
+            Skip();
+            return false;
+        }
+        outValue = uint64Value;
+        Next();
+        return true;
+    }
+
+    bool JsonReader::ReadDouble(double& outValue)
+    {
+        if (tokenType != JsonTokenType::number) {
+            Skip();
+            return false;
+        }
+        outValue = doubleValue;
+        Next();
+        return true;
+    }
+
+    bool JsonReader::ReadString(std::string& outValue)
+    {
+        if (tokenType != JsonTokenType::string) {
+            Skip();
+            return false;
+        }
+        outValue = std::move(stringValue);
+        Next();
+        return true;
+    }
+
+    bool JsonReader::StartObject()
+    {
+        if (tokenType != JsonTokenType::startObject) {
+            Skip();
+            return false;
+        }
+        Next();
+        return true;
+    }
+
+    bool JsonReader::NextKey(std::string_view& outKey)
+    {
+        if (tokenType == JsonTokenType::endObject) {
+            Next();
+            return false;
+        }
+        if (tokenType != JsonTokenType::key) {
+            return false;
+        }
+        outKey = keyValue;
+        Next();
+        return true;
+    }
+
+    bool JsonReader::StartArray()
+    {
+        if (tokenType != JsonTokenType::startArray) {
+            Skip();
+            return false;
+        }
+        Next();
+        return true;
+    }
+
+    bool JsonReader::NextElement()
+    {
+        if (tokenType == JsonTokenType::endArray) {
+            Next();
+            return false;
+        }
+        return tokenType != JsonTokenType::end && tokenType != JsonTokenType::error;
+    }
+
+    void JsonReader::Skip()
+    {
+        // skipping at a key skips the whole member
+        if (tokenType == JsonTokenType::key) {
+            Next();
+        }
+
+        size_t depth = 0;
+        do {
+            if (tokenType == JsonTokenType::end || tokenType == JsonTokenType::error) {
+                return;
+            }
+            if (tokenType == JsonTokenType::startObject || tokenType == JsonTokenType::startArray) {
+                depth++;
+            } else if (tokenType == JsonTokenType::endObject || tokenType == JsonTokenType::endArray) {
+                // end of enclosing container is not part of current value
+                if (depth == 0) {
+                    return;
+                }
+                depth--;
+            }
+            Next();
+        } while (depth > 0);
+    }
+
+    void JsonReader::Next()
+    {
+        if (tokenType == JsonTokenType::end || tokenType == JsonTokenType::error) {
+            return;
+        }
+
+        Handler handler(*this);
+        while (!handler.received) {
+            if (reader.IterativeParseComplete()) {
+                tokenType = JsonTokenType::end;
+                return;
+            }
+            if (!reader.IterativeParseNext<rapidjson::kParseDefaultFlags>(stream, handler)) {
+                tokenType = JsonTokenType::error;
+                return;
+            }
+        }
+    }
 }
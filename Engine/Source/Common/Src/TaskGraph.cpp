@@ -0,0 +1,39 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <atomic>
+#include <algorithm>
+
+#include <Common/TaskGraph.h>
+
+namespace Common {
+    // not owned, see TaskExecutor::Shared()
+    static std::atomic<TaskExecutor*> installedSharedExecutor = nullptr;
+
+    TaskExecutor& TaskExecutor::Shared()
+    {
+        if (auto* installed = installedSharedExecutor.load(std::memory_order_acquire); installed != nullptr) {
+            return *installed;
+        }
+        static TaskExecutor executor("TaskWorker", static_cast<uint8_t>(std::clamp(std::thread::hardware_concurrency(), 1u, 255u)));
+        return executor;
+    }
+
+    void TaskExecutor::SetShared(TaskExecutor* inExecutor)
+    {
+        installedSharedExecutor.store(inExecutor, std::memory_order_release);
+    }
+
+    TaskExecutor::TaskExecutor(const std::string& inName, uint8_t inThreadNum)
+        : threadPool(inName, inThreadNum)
+    {
+    }
+
+    TaskExecutor::~TaskExecutor() = default;
+
+    uint8_t TaskExecutor::ThreadNum() const
+    {
+        return threadPool.ThreadNum();
+    }
+}
@@ -0,0 +1,162 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <map>
+#include <vector>
+#include <string>
+#include <thread>
+#include <cstring>
+
+#include <Test/Test.h>
+
+#include <Common/Allocator.h>
+#include <Common/Memory.h>
+using namespace Common;
+
+TEST(AllocatorTest, LinearAllocatorTest)
+{
+    LinearAllocator allocator(1024);
+    auto* a = static_cast<uint8_t*>(allocator.Allocate(3, 1));
+    auto* b = allocator.New<uint64_t>(5);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(b) % alignof(uint64_t), 0);
+    ASSERT_EQ(*b, 5);
+    ASSERT_GE(reinterpret_cast<uint8_t*>(b), a + 3);
+    ASSERT_EQ(allocator.UsedBytes(), 3 + sizeof(uint64_t));
+
+    // oversized allocation
+    auto* c = static_cast<uint8_t*>(allocator.Allocate(4096));
+    c[4095] = 1;
+    allocator.Reset();
+    ASSERT_EQ(allocator.UsedBytes(), 0);
+
+    // pages are reused after reset
+    ASSERT_EQ(allocator.Allocate(3, 1), a);
+}
+
+TEST(AllocatorTest, MarkerTest)
+{
+    LinearAllocator allocator(256);
+    allocator.Allocate(16);
+    const auto marker = allocator.Mark();
+    auto* a = allocator.Allocate(16);
+    for (auto i = 0; i < 100; i++) {
+        allocator.Allocate(64);
+    }
+    allocator.Rewind(marker);
+    ASSERT_EQ(allocator.UsedBytes(), 16);
+    ASSERT_EQ(allocator.Allocate(16), a);
+}
+
+TEST(AllocatorTest, FrameArenaTest)
+{
+    FrameArena::Reset();
+    {
+        FrameArenaMark mark;
+        std::vector<uint32_t, FrameAllocator<uint32_t>> values;
+        for (uint32_t i = 0; i < 10000; i++) {
+            values.emplace_back(i);
+        }
+        ASSERT_EQ(values[9999], 9999);
+        ASSERT_GT(FrameArena::Get().UsedBytes(), 10000 * sizeof(uint32_t));
+    }
+    ASSERT_EQ(FrameArena::Get().UsedBytes(), 0);
+
+    std::basic_string<char, std::char_traits<char>, FrameAllocator<char>> str("a string that does not fit into small buffer");
+    ASSERT_EQ(str.size(), 44);
+    FrameArena::Reset();
+    ASSERT_EQ(FrameArena::Get().UsedBytes(), 0);
+}
+
+TEST(AllocatorTest, ArenaAllocatorTest)
+{
+    LinearAllocator allocator;
+    std::vector<std::string, ArenaAllocator<std::string>> values { ArenaAllocator<std::string>(allocator) };
+    values.emplace_back("hello");
+    values.emplace_back("world");
+    ASSERT_EQ(values[0] + values[1], "helloworld");
+    ASSERT_GT(allocator.UsedBytes(), 0);
+    ASSERT_EQ(&values.get_allocator().GetAllocator(), &allocator);
+}
+
+struct PooledTestObject : PooledObject<MemoryTag::ecs> {
+    explicit PooledTestObject(int inValue) : value(inValue) {}
+    int value;
+};
+
+TEST(AllocatorTest, SmallObjectAllocatorTest)
+{
+    const auto before = SmallObjectAllocator::GetStats(MemoryTag::render);
+    std::vector<void*> blocks;
+    for (size_t i = 1; i <= SmallObjectAllocator::maxSmallSize; i++) {
+        auto* block = SmallObjectAllocator::Allocate(i, MemoryTag::render);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t), 0);
+        memset(block, 0xcd, i);
+        blocks.emplace_back(block);
+    }
+    auto* large = SmallObjectAllocator::Allocate(4096, MemoryTag::render);
+    const auto during = SmallObjectAllocator::GetStats(MemoryTag::render);
+    ASSERT_EQ(during.allocations - before.allocations, SmallObjectAllocator::maxSmallSize + 1);
+
+    SmallObjectAllocator::Deallocate(large, 4096, MemoryTag::render);
+    for (size_t i = 1; i <= SmallObjectAllocator::maxSmallSize; i++) {
+        SmallObjectAllocator::Deallocate(blocks[i - 1], i, MemoryTag::render);
+    }
+    const auto after = SmallObjectAllocator::GetStats(MemoryTag::render);
+    ASSERT_EQ(after.allocations, before.allocations);
+    ASSERT_EQ(after.bytes, before.bytes);
+
+    // freed blocks are reused by the same thread
+    auto* a = SmallObjectAllocator::Allocate(32);
+    SmallObjectAllocator::Deallocate(a, 32);
+    ASSERT_EQ(SmallObjectAllocator::Allocate(32), a);
+    SmallObjectAllocator::Deallocate(a, 32);
+}
+
+TEST(AllocatorTest, SmallObjectCrossThreadTest)
+{
+    constexpr size_t count = 100000;
+    std::vector<void*> blocks(count);
+    std::thread producer([&]() -> void {
+        for (size_t i = 0; i < count; i++) {
+            blocks[i] = SmallObjectAllocator::Allocate(48, MemoryTag::asset);
+        }
+    });
+    producer.join();
+
+    std::thread consumer([&]() -> void {
+        for (size_t i = 0; i < count; i++) {
+            SmallObjectAllocator::Deallocate(blocks[i], 48, MemoryTag::asset);
+        }
+        SmallObjectAllocator::FlushThreadCache();
+    });
+    consumer.join();
+    ASSERT_EQ(SmallObjectAllocator::GetStats(MemoryTag::asset).allocations, 0);
+}
+
+TEST(AllocatorTest, PooledAllocatorTest)
+{
+    std::vector<uint64_t, PooledAllocator<uint64_t>> values;
+    for (uint64_t i = 0; i < 1000; i++) {
+        values.emplace_back(i);
+    }
+    ASSERT_EQ(values[999], 999);
+
+    std::map<int, std::string, std::less<>, PooledAllocator<std::pair<const int, std::string>>> map;
+    map.emplace(1, "hello");
+    map.emplace(2, "world");
+    ASSERT_EQ(map[1] + map[2], "helloworld");
+    ASSERT_GT(SmallObjectAllocator::GetStats(MemoryTag::container).allocations, 0);
+}
+
+TEST(AllocatorTest, PooledObjectTest)
+{
+    const auto before = SmallObjectAllocator::GetStats(MemoryTag::ecs);
+    {
+        auto unique = Common::MakeUnique<PooledTestObject>(1);
+        auto shared = Common::MakeShared<PooledTestObject>(2);
+        ASSERT_EQ(unique->value + shared->value, 3);
+        ASSERT_EQ(SmallObjectAllocator::GetStats(MemoryTag::ecs).allocations - before.allocations, 2);
+    }
+    ASSERT_EQ(SmallObjectAllocator::GetStats(MemoryTag::ecs).allocations, before.allocations);
+}
@@ -0,0 +1,74 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <random>
+#include <vector>
+
+#include <Test/Test.h>
+
+#include <Common/Compression.h>
+using namespace Common;
+
+static void PerformLzRoundTripTest(const std::vector<uint8_t>& inData)
+{
+    std::vector<uint8_t> compressed(CompressionUtils::LzCompressBound(inData.size()));
+    const auto compressedSize = CompressionUtils::LzCompress(inData.data(), inData.size(), compressed.data(), compressed.size());
+    ASSERT_GT(compressedSize, 0);
+    ASSERT_LE(compressedSize, compressed.size());
+
+    std::vector<uint8_t> decompressed(inData.size());
+    ASSERT_TRUE(CompressionUtils::LzDecompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size()));
+    ASSERT_EQ(decompressed, inData);
+}
+
+TEST(CompressionTest, LzRoundTripTest)
+{
+    PerformLzRoundTripTest({});
+    PerformLzRoundTripTest({ 1, 2, 3 });
+    PerformLzRoundTripTest(std::vector<uint8_t>(100000, 7));
+
+    std::vector<uint8_t> text;
+    for (auto i = 0; i < 5000; i++) {
+        for (const char c : std::string("position normal uv tangent ") + std::to_string(i % 97)) {
+            text.emplace_back(static_cast<uint8_t>(c));
+        }
+    }
+    PerformLzRoundTripTest(text);
+
+    std::mt19937 engine(42); // NOLINT
+    std::uniform_int_distribution<uint32_t> distribution(0, 255);
+    std::vector<uint8_t> noise(70000);
+    for (auto& byte : noise) {
+        byte = static_cast<uint8_t>(distribution(engine));
+    }
+    PerformLzRoundTripTest(noise);
+}
+
+TEST(CompressionTest, LzRatioTest)
+{
+    std::vector<uint8_t> data;
+    for (auto i = 0; i < 65536; i++) {
+        data.emplace_back(static_cast<uint8_t>(i % 16));
+    }
+    std::vector<uint8_t> compressed(CompressionUtils::LzCompressBound(data.size()));
+    const auto compressedSize = CompressionUtils::LzCompress(data.data(), data.size(), compressed.data(), compressed.size());
+    ASSERT_LT(compressedSize, data.size() / 50);
+
+    // output not fitting in capacity is reported rather than overflowed
+    ASSERT_EQ(CompressionUtils::LzCompress(data.data(), data.size(), compressed.data(), 8), 0);
+}
+
+TEST(CompressionTest, LzMalformedTest)
+{
+    const std::vector<uint8_t> data(1000, 3);
+    std::vector<uint8_t> compressed(CompressionUtils::LzCompressBound(data.size()));
+    const auto compressedSize = CompressionUtils::LzCompress(data.data(), data.size(), compressed.data(), compressed.size());
+
+    std::vector<uint8_t> decompressed(data.size());
+    ASSERT_FALSE(CompressionUtils::LzDecompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size() - 1));
+    ASSERT_FALSE(CompressionUtils::LzDecompress(compressed.data(), compressedSize - 1, decompressed.data(), decompressed.size()));
+
+    const std::vector<uint8_t> badOffset = { 0x10, 'a', 0xff, 0xff };
+    ASSERT_FALSE(CompressionUtils::LzDecompress(badOffset.data(), badOffset.size(), decompressed.data(), 10));
+}
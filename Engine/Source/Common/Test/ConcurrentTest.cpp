@@ -5,6 +5,7 @@
 #include <Test/Test.h>
 
 #include <Common/Concurrent.h>
+#include <Common/Memory.h>
 
 TEST(ConcurrentTest, NamedThreadTest)
 {
@@ -115,3 +116,184 @@ TEST(ConcurrentTest, WorkerThread3)
     syncSignal.wait();
     ASSERT_EQ(value, 10);
 }
+
+TEST(ConcurrentTest, WorkerThread4)
+{
+    uint32_t value = 0;
+    Common::WorkerThread workerThread("TestWorkerThread", 4);
+    for (auto i = 0; i < 1000; i++) {
+        workerThread.DispatchTask([&value](uint32_t inDelta) -> void { value += inDelta; }, 2);
+    }
+    workerThread.Flush();
+    ASSERT_EQ(value, 2000);
+}
+
+TEST(ConcurrentTest, WorkerThread5)
+{
+    // worker enqueues more commands than ring can hold while ring is full, must not wait on itself
+    std::vector<uint32_t> values;
+    Common::WorkerThread workerThread("TestWorkerThread", 4);
+    workerThread.EmplaceTask([&]() -> void {
+        for (auto i = 0; i < 100; i++) {
+            workerThread.DispatchTask([&values, i]() -> void { values.emplace_back(i); });
+        }
+    }).wait();
+    // spilled commands still run before commands enqueued after them by other threads
+    workerThread.Flush();
+    ASSERT_EQ(values.size(), 100);
+    for (auto i = 0; i < 100; i++) {
+        ASSERT_EQ(values[i], i);
+    }
+}
+
+TEST(ConcurrentTest, CommandRingTest0)
+{
+    std::vector<uint32_t> values;
+    Common::SpscCommandRing ring(4);
+    ASSERT_EQ(ring.Capacity(), 4);
+    ASSERT_TRUE(ring.Empty());
+    for (auto i = 0; i < 4; i++) {
+        ASSERT_TRUE(ring.TryEmplace([&values, i]() -> void { values.emplace_back(i); }));
+    }
+    ASSERT_FALSE(ring.TryEmplace([]() -> void {}));
+    ASSERT_EQ(ring.ExecuteAll(), 4);
+    ASSERT_TRUE(ring.Empty());
+    ASSERT_EQ(values, (std::vector<uint32_t> { 0, 1, 2, 3 }));
+}
+
+TEST(ConcurrentTest, CommandRingTest1)
+{
+    uint32_t value = 0;
+    auto counter = std::make_shared<uint32_t>(0);
+    {
+        Common::SpscCommandRing ring(8);
+        std::array<uint64_t, 32> bigPayload {};
+        bigPayload[31] = 5;
+        ring.Emplace([&value, bigPayload]() -> void { value += bigPayload[31]; });
+        ring.Emplace([counter]() -> void { ++*counter; });
+        ASSERT_TRUE(ring.TryExecuteOne());
+        ASSERT_EQ(value, 5);
+        ASSERT_EQ(counter.use_count(), 2);
+    }
+    // not executed commands must be destructed with the ring
+    ASSERT_EQ(*counter, 0);
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(ConcurrentTest, CommandRingTest2)
+{
+    constexpr uint32_t producerNum = 4;
+    constexpr uint32_t commandNumPerProducer = 1000;
+
+    std::vector<uint32_t> lastValues(producerNum, 0);
+    bool ordered = true;
+    std::atomic<uint32_t> finishedProducers = 0;
+    Common::MpscCommandRing ring(64);
+
+    std::vector<Common::NamedThread> producers;
+    producers.reserve(producerNum);
+    for (auto p = 0; p < producerNum; p++) {
+        producers.emplace_back("TestProducer", [&, p]() -> void {
+            for (uint32_t i = 1; i <= commandNumPerProducer; i++) {
+                ring.Emplace([&, p, i]() -> void {
+                    ordered = ordered && lastValues[p] + 1 == i;
+                    lastValues[p] = i;
+                });
+            }
+            ++finishedProducers;
+        });
+    }
+    while (finishedProducers < producerNum || !ring.Empty()) {
+        ring.ExecuteAll();
+    }
+    for (auto& producer : producers) {
+        producer.Join();
+    }
+    ASSERT_TRUE(ordered);
+    ASSERT_EQ(lastValues, std::vector<uint32_t>(producerNum, commandNumPerProducer));
+}
+
+TEST(ConcurrentTest, ShardedLruCacheTest0)
+{
+    Common::ShardedLruCache<uint32_t, std::string, std::hash<uint32_t>, 1> cache(2, 0, 1);
+    uint32_t created = 0;
+    const auto creator = [&]() -> std::string { return std::to_string(created++); };
+
+    ASSERT_EQ(cache.GetOrCreate(1, creator), "0");
+    ASSERT_EQ(cache.GetOrCreate(2, creator), "1");
+    ASSERT_EQ(cache.GetOrCreate(1, creator), "0");
+    ASSERT_EQ(cache.GetOrCreate(3, creator), "2");
+    ASSERT_EQ(cache.Size(), 3);
+
+    // key 2 is least recently used
+    ASSERT_EQ(cache.Tick(), 1);
+    ASSERT_EQ(cache.Size(), 2);
+    ASSERT_EQ(cache.GetOrCreate(1, creator), "0");
+    ASSERT_EQ(cache.GetOrCreate(2, creator), "3");
+
+    const auto stats = cache.GetStats();
+    ASSERT_EQ(stats.hits, 2);
+    ASSERT_EQ(stats.misses, 4);
+    ASSERT_EQ(stats.evictions, 1);
+    ASSERT_EQ(stats.size, 3);
+
+    ASSERT_TRUE(cache.Erase(1));
+    ASSERT_FALSE(cache.Erase(1));
+    ASSERT_EQ(cache.EraseIf([](uint32_t inKey, const std::string&) -> bool { return inKey == 3; }), 1);
+    ASSERT_EQ(cache.Size(), 1);
+    cache.Clear();
+    ASSERT_EQ(cache.Size(), 0);
+}
+
+TEST(ConcurrentTest, ShardedLruCacheTest1)
+{
+    Common::ShardedLruCache<uint32_t, uint32_t> cache(0, 2, 2);
+    cache.GetOrCreate(1, []() -> uint32_t { return 1; });
+    cache.GetOrCreate(2, []() -> uint32_t { return 2; });
+
+    // entries used in recent frames are retained even though they are idle
+    ASSERT_EQ(cache.Tick(), 0);
+    cache.GetOrCreate(2, []() -> uint32_t { return 0; });
+    ASSERT_EQ(cache.Tick(), 0);
+    ASSERT_EQ(cache.Tick(), 1);
+    ASSERT_EQ(cache.Size(), 1);
+    ASSERT_EQ(cache.Tick(), 1);
+    ASSERT_EQ(cache.Size(), 0);
+    ASSERT_EQ(cache.Frame(), 4);
+}
+
+TEST(ConcurrentTest, ShardedLruCacheTest2)
+{
+    constexpr uint32_t threadNum = 8;
+    constexpr uint32_t keyNum = 512;
+
+    Common::ShardedLruCache<uint32_t, Common::UniqueRef<uint32_t>> cache;
+    std::atomic<uint32_t> created = 0;
+    std::atomic<bool> matched = true;
+
+    std::vector<Common::NamedThread> threads;
+    threads.reserve(threadNum);
+    for (auto t = 0; t < threadNum; t++) {
+        threads.emplace_back("TestThread", [&]() -> void {
+            for (uint32_t i = 0; i < keyNum * 4; i++) {
+                const uint32_t key = i % keyNum;
+                const auto& value = cache.GetOrCreate(key, [&]() -> Common::UniqueRef<uint32_t> {
+                    ++created;
+                    return Common::MakeUnique<uint32_t>(key);
+                });
+                if (*value != key) {
+                    matched = false;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.Join();
+    }
+
+    ASSERT_TRUE(matched);
+    ASSERT_EQ(created, keyNum);
+    const auto stats = cache.GetStats();
+    ASSERT_EQ(stats.misses, keyNum);
+    ASSERT_EQ(stats.hits, threadNum * keyNum * 4 - keyNum);
+}
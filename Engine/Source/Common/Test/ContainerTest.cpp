@@ -2,6 +2,9 @@
 // Created by johnk on 2023/12/5.
 //
 
+#include <string>
+#include <ranges>
+
 #include <Test/Test.h>
 #include <Common/Container.h>
 using namespace Common;
@@ -302,6 +305,60 @@ TEST(ContainerTest, InplaceVectorCopyAndMove)
     ASSERT_EQ(t5[3], temp1);
 }
 
+TEST(ContainerTest, SmallVectorBasic)
+{
+    SmallVector<int, 4> t0 { 1, 2, 3 };
+    ASSERT_TRUE(t0.IsInline());
+    ASSERT_EQ(t0.Size(), 3);
+    ASSERT_EQ(t0.Capacity(), 4);
+
+    t0.PushBack(4);
+    ASSERT_TRUE(t0.IsInline());
+    t0.PushBack(t0[0]);
+    ASSERT_FALSE(t0.IsInline());
+    ASSERT_EQ(t0.ToVector(), (std::vector<int> { 1, 2, 3, 4, 1 }));
+
+    t0.Insert(0, 0);
+    t0.Erase(2);
+    t0.EraseSwapLast(1);
+    ASSERT_EQ(t0.ToVector(), (std::vector<int> { 0, 1, 3, 4 }));
+    ASSERT_EQ(*std::ranges::find(t0, 3), 3);
+
+    t0.Resize(2);
+    ASSERT_EQ(t0, (SmallVector<int, 8> { 0, 1 }));
+    t0.Clear();
+    ASSERT_TRUE(t0.Empty());
+    ASSERT_FALSE(t0.IsInline());
+}
+
+TEST(ContainerTest, SmallVectorCopyAndMove)
+{
+    SmallVector<std::string, 2> t0 { "a", "b" };
+    SmallVector<std::string, 2> t1 { "c", "d", "e" };
+
+    // inline move relocates elements, heap move steals buffer
+    SmallVector<std::string, 2> t2 = std::move(t0);
+    ASSERT_TRUE(t2.IsInline());
+    ASSERT_TRUE(t0.Empty());
+    const auto* heapData = t1.Data();
+    SmallVector<std::string, 2> t3 = std::move(t1);
+    ASSERT_EQ(t3.Data(), heapData);
+    ASSERT_TRUE(t1.Empty());
+    ASSERT_TRUE(t1.IsInline());
+
+    t2 = t3;
+    ASSERT_EQ(t2.ToVector(), (std::vector<std::string> { "c", "d", "e" }));
+    t3 = SmallVector<std::string, 2> { "f" };
+    ASSERT_EQ(t3.ToVector(), (std::vector<std::string> { "f" }));
+
+    SmallVector<CopyAndMoveTest, 2> t4;
+    t4.EmplaceBack();
+    t4.EmplaceBack();
+    t4.EmplaceBack();
+    ASSERT_EQ(t4[0].constructType, ConstructType::cMove);
+    ASSERT_EQ(t4[2].constructType, ConstructType::cDefault);
+}
+
 TEST(ContainerTest, TrunkBasic)
 {
     Trunk<int, 4> t0;
@@ -471,3 +528,217 @@ TEST(ContainerTest, StableUnorderedMapTest)
     ASSERT_EQ(t0.Size(), 4);
     ASSERT_EQ(t0.Capacity(), 8);
 }
+
+TEST(ContainerTest, TrunkIteratorTest)
+{
+    Trunk<int, 130> t0;
+    ASSERT_EQ(t0.Begin(), t0.End());
+
+    for (auto i = 0; i < 130; i++) {
+        t0.Emplace(i);
+    }
+    for (auto i = 0; i < 130; i++) {
+        if (i % 3 != 0) {
+            t0.Erase(i);
+        }
+    }
+    ASSERT_EQ(t0.Emplace(1000), 1);
+    t0.Erase(1);
+
+    int expected = 0;
+    for (auto& elem : t0) {
+        ASSERT_EQ(elem, expected);
+        expected += 3;
+    }
+    ASSERT_EQ(expected, 132);
+
+    const auto& t1 = t0;
+    ASSERT_EQ(std::distance(t1.begin(), t1.end()), 44);
+    ASSERT_EQ(t0.Allocated(), 44);
+
+    t0.Clear();
+    ASSERT_TRUE(t0.Empty());
+    ASSERT_EQ(t0.Begin(), t0.End());
+}
+
+TEST(ContainerTest, TrunkListIteratorTest)
+{
+    TrunkList<int, 4> t0;
+    ASSERT_EQ(t0.Begin(), t0.End());
+
+    std::vector<TrunkList<int, 4>::Handle> handles;
+    for (auto i = 0; i < 12; i++) {
+        handles.emplace_back(t0.Emplace(i));
+    }
+    // empty the second trunk entirely
+    for (auto i = 4; i < 8; i++) {
+        t0.Erase(handles[i]);
+    }
+    t0.Erase(handles[0]);
+
+    std::vector<int> visited;
+    for (const auto& elem : std::as_const(t0)) {
+        visited.emplace_back(elem);
+    }
+    ASSERT_EQ(visited, (std::vector<int> { 1, 2, 3, 8, 9, 10, 11 }));
+
+    for (auto& elem : t0) {
+        elem *= 2;
+    }
+    ASSERT_EQ(*handles[11], 22);
+}
+
+TEST(ContainerTest, StableUnorderedMapIteratorTest)
+{
+    StableUnorderedMap<int, std::string, 4> t0;
+    for (auto i = 0; i < 10; i++) {
+        t0.Emplace(i, std::to_string(i));
+    }
+    t0.Erase(3);
+
+    int count = 0;
+    for (auto& [key, value] : t0) {
+        ASSERT_EQ(value, std::to_string(key));
+        value += "!";
+        count++;
+    }
+    ASSERT_EQ(count, 9);
+    ASSERT_EQ(t0.At(9), "9!");
+}
+
+TEST(ContainerTest, FlatHashMapBasic)
+{
+    FlatHashMap<int, std::string> t0;
+    ASSERT_TRUE(t0.Empty());
+    ASSERT_FALSE(t0.Contains(1));
+    ASSERT_EQ(t0.Find(1), t0.End());
+
+    for (int i = 0; i < 1000; i++) {
+        const auto [iter, inserted] = t0.Emplace(i, std::to_string(i));
+        ASSERT_TRUE(inserted);
+        ASSERT_EQ(iter->second, std::to_string(i));
+    }
+    ASSERT_FALSE(t0.Emplace(1, "x").second);
+    ASSERT_EQ(t0.Size(), 1000);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(t0.At(i), std::to_string(i));
+    }
+
+    for (int i = 0; i < 1000; i += 2) {
+        ASSERT_EQ(t0.Erase(i), 1);
+    }
+    ASSERT_EQ(t0.Erase(0), 0);
+    ASSERT_EQ(t0.Size(), 500);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(t0.Contains(i), i % 2 == 1);
+    }
+
+    t0[2000] = "a";
+    t0[2000] += "b";
+    ASSERT_EQ(t0.At(2000), "ab");
+
+    size_t count = 0;
+    for (const auto& [key, value] : t0) {
+        ASSERT_EQ(key == 2000 ? "ab" : std::to_string(key), value);
+        count++;
+    }
+    ASSERT_EQ(count, t0.Size());
+
+    t0.Clear();
+    ASSERT_TRUE(t0.Empty());
+    ASSERT_EQ(t0.Begin(), t0.End());
+}
+
+TEST(ContainerTest, FlatHashMapTombstoneTest)
+{
+    // erase and insert with different keys repeatedly, table must recycle tombstones instead of growing unbounded
+    FlatHashMap<uint64_t, uint64_t> t0;
+    for (uint64_t i = 0; i < 100000; i++) {
+        t0.Emplace(i, i);
+        if (i >= 8) {
+            t0.Erase(i - 8);
+        }
+    }
+    ASSERT_EQ(t0.Size(), 8);
+    ASSERT_LE(t0.Capacity(), 32);
+}
+
+TEST(ContainerTest, FlatHashMapAliasedEmplaceTest)
+{
+    // value argument references an element of the map itself, it must stay valid while the insert grows the table
+    FlatHashMap<int, std::string> t0;
+    t0.Emplace(0, "a long string which never fits in small string buffer");
+    for (int i = 1; i < 1024; i++) {
+        const auto capacity = t0.Capacity();
+        ASSERT_TRUE(t0.Emplace(i, t0.At(i - 1)).second);
+        if (t0.Capacity() != capacity) {
+            ASSERT_EQ(t0.At(i), t0.At(0));
+        }
+    }
+    ASSERT_GT(t0.Capacity(), 1024);
+    for (int i = 0; i < 1024; i++) {
+        ASSERT_EQ(t0.At(i), "a long string which never fits in small string buffer");
+    }
+}
+
+TEST(ContainerTest, FlatHashMapCopyAndMove)
+{
+    FlatHashMap<std::string, int> t0 = { { "a", 1 }, { "b", 2 } };
+    FlatHashMap<std::string, int> t1 = t0;
+    ASSERT_EQ(t1.Size(), 2);
+    ASSERT_EQ(t1.At("b"), 2);
+
+    FlatHashMap<std::string, int> t2 = std::move(t1);
+    ASSERT_TRUE(t1.Empty()); // NOLINT
+    ASSERT_EQ(t2.At("a"), 1);
+
+    t1 = t2;
+    t2 = std::move(t0);
+    ASSERT_EQ(t1.Size(), 2);
+    ASSERT_EQ(t2.Size(), 2);
+
+    auto iter = t2.Find("a");
+    iter = t2.Erase(iter);
+    ASSERT_EQ(t2.Size(), 1);
+    ASSERT_FALSE(t2.Contains("a"));
+
+    std::vector<int> values;
+    for (const auto& value : t1 | std::views::values) {
+        values.emplace_back(value);
+    }
+    std::ranges::sort(values);
+    ASSERT_EQ(values, (std::vector<int> { 1, 2 }));
+}
+
+struct StringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::string_view inValue) const
+    {
+        return std::hash<std::string_view> {}(inValue);
+    }
+};
+
+TEST(ContainerTest, FlatHashSetTest)
+{
+    FlatHashSet<std::string, StringHash, std::equal_to<>> t0;
+    ASSERT_TRUE(t0.Emplace("hello").second);
+    ASSERT_TRUE(t0.Emplace(std::string("world")).second);
+    ASSERT_FALSE(t0.Emplace("hello").second);
+
+    // heterogeneous lookup, no temporary string is constructed
+    const std::string_view key = "world";
+    ASSERT_TRUE(t0.Contains(key));
+    ASSERT_EQ(*t0.Find(key), "world");
+    ASSERT_FALSE(t0.Contains(std::string_view("none")));
+
+    FlatHashSet<int*> t1;
+    int values[64];
+    for (auto& value : values) {
+        t1.Emplace(&value);
+    }
+    ASSERT_EQ(t1.Size(), 64);
+    for (auto& value : values) {
+        ASSERT_TRUE(t1.Contains(&value));
+    }
+}
@@ -0,0 +1,92 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <fstream>
+#include <filesystem>
+
+#include <Test/Test.h>
+
+#include <Common/Coroutine.h>
+using namespace Common;
+
+static Task<uint32_t> AddAsync(uint32_t inLhs, uint32_t inRhs)
+{
+    co_await SwitchTo(TaskExecutor::Shared());
+    co_return inLhs + inRhs;
+}
+
+static Task<uint32_t> SumAsync(uint32_t inCount)
+{
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < inCount; i++) {
+        result = co_await AddAsync(result, i);
+    }
+    co_return result;
+}
+
+TEST(CoroutineTest, TaskTest)
+{
+    ASSERT_EQ(SyncWait(AddAsync(1, 2)), 3);
+    ASSERT_EQ(SyncWait(SumAsync(100)), 4950);
+
+    uint32_t value = 0;
+    SyncWait([](uint32_t& outValue) -> Task<> {
+        outValue = co_await AddAsync(2, 3);
+    }(value));
+    ASSERT_EQ(value, 5);
+}
+
+TEST(CoroutineTest, LaunchTest)
+{
+    std::vector<TaskFuture<uint32_t>> futures;
+    futures.reserve(1000);
+    for (uint32_t i = 0; i < 1000; i++) {
+        futures.emplace_back(Launch(AddAsync(i, 1)));
+    }
+    auto result = WhenAll(futures).Get();
+    for (uint32_t i = 0; i < 1000; i++) {
+        ASSERT_EQ(result[i], i + 1);
+    }
+}
+
+TEST(CoroutineTest, AwaitTaskFutureTest)
+{
+    auto future = TaskExecutor::Shared().Async([]() -> uint32_t { return 4; });
+    auto task = [](TaskFuture<uint32_t> inFuture) -> Task<uint32_t> {
+        const uint32_t value = co_await inFuture;
+        co_return value * 2;
+    };
+    ASSERT_EQ(SyncWait(task(future)), 8);
+}
+
+TEST(CoroutineTest, WorkerThreadTest)
+{
+    WorkerThread workerThread("TestWorkerThread");
+    const auto workerThreadId = SyncWait([](WorkerThread& inWorkerThread) -> Task<std::thread::id> {
+        co_await SwitchTo(inWorkerThread);
+        co_return std::this_thread::get_id();
+    }(workerThread));
+
+    uint32_t value = 0;
+    for (auto i = 0; i < 10; i++) {
+        workerThread.DispatchTask([&value]() -> void { ++value; });
+    }
+    const auto result = SyncWait([](WorkerThread& inWorkerThread, uint32_t& inValue, std::thread::id inWorkerThreadId) -> Task<bool> {
+        co_await WaitForFlush(inWorkerThread);
+        co_return inValue == 10 && std::this_thread::get_id() != inWorkerThreadId;
+    }(workerThread, value, workerThreadId));
+    ASSERT_TRUE(result);
+}
+
+TEST(CoroutineTest, ReadFileTest)
+{
+    static std::filesystem::path fileName = "../Test/Generated/Common/CoroutineTest.ReadFileTest.txt";
+    std::filesystem::create_directories(fileName.parent_path());
+    {
+        std::ofstream file(fileName, std::ios::binary);
+        file << "hello";
+    }
+    ASSERT_EQ(SyncWait(ReadTextFileAsync(fileName.string())), "hello");
+    ASSERT_EQ(SyncWait(ReadBinaryFileAsync(fileName.string())), (std::vector<uint8_t> { 'h', 'e', 'l', 'l', 'o' }));
+}
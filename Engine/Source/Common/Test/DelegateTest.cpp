@@ -2,6 +2,9 @@
 // Created by johnk on 2024/11/5.
 //
 
+#include <array>
+#include <memory>
+
 #include <Common/Delegate.h>
 #include <gtest/gtest.h>
 
@@ -42,3 +45,61 @@ TEST(DelegateTest, BasicTest)
     event.Broadcast(1, true);
     ASSERT_EQ(counter, 3);
 }
+
+TEST(DelegateTest, UnbindTest)
+{
+    int sum = 0;
+    Common::Delegate<int> event;
+    const auto h0 = event.BindLambda([&](int v) -> void { sum += v; });
+    const auto h1 = event.BindLambda([&](int v) -> void { sum += v * 10; });
+    const auto h2 = event.BindLambda([&](int v) -> void { sum += v * 100; });
+    ASSERT_EQ(event.Count(), 3);
+
+    event.Broadcast(1);
+    ASSERT_EQ(sum, 111);
+
+    event.Unbind(h1);
+    event.Broadcast(1);
+    ASSERT_EQ(sum, 212);
+
+    event.Unbind(h0);
+    event.Unbind(h2);
+    ASSERT_EQ(event.Count(), 0);
+    event.Broadcast(1);
+    ASSERT_EQ(sum, 212);
+}
+
+TEST(DelegateTest, InlineFunctionTest)
+{
+    using Func = Common::InlineFunction<int(int)>;
+    Func f0 = [](int v) -> int { return v + 1; };
+    ASSERT_TRUE(f0);
+    ASSERT_EQ(f0(1), 2);
+
+    // capture exceeds inline capacity, stored in heap
+    std::array<int, 32> big {};
+    big[31] = 5;
+    Func f1 = [big](int v) -> int { return v + big[31]; };
+    ASSERT_EQ(f1(1), 6);
+
+    auto sharedState = std::make_shared<int>(3);
+    Func f2 = [sharedState](int v) -> int { return v * *sharedState; };
+    ASSERT_EQ(sharedState.use_count(), 2);
+
+    Func f3 = f1;
+    Func f4 = std::move(f1);
+    ASSERT_FALSE(f1);
+    ASSERT_EQ(f3(2), 7);
+    ASSERT_EQ(f4(3), 8);
+
+    f3 = f2;
+    ASSERT_EQ(sharedState.use_count(), 3);
+    f4 = std::move(f2);
+    ASSERT_FALSE(f2);
+    ASSERT_EQ(sharedState.use_count(), 3);
+    ASSERT_EQ(f4(2), 6);
+
+    f3.Reset();
+    f4.Reset();
+    ASSERT_EQ(sharedState.use_count(), 1);
+}
@@ -3,6 +3,7 @@
 //
 
 #include <string_view>
+#include <array>
 
 #include <Test/Test.h>
 
@@ -25,3 +26,58 @@ TEST(HashTest, StrCrc32DynTest)
     ASSERT_EQ(Common::HashUtils::StrCrc32(std::string("hello")), 0x3610a686);
     ASSERT_EQ(Common::HashUtils::StrCrc32(std::string("explosion game engine")), 0xdb39167f);
 }
+
+TEST(HashTest, Crc32CTest)
+{
+    constexpr std::string_view checkString = "123456789";
+    ASSERT_EQ(Common::HashUtils::Crc32C(checkString.data(), checkString.size()), 0xe3069283);
+    ASSERT_EQ(Common::HashUtils::Crc32C(nullptr, 0), 0);
+
+    // incremental with seed
+    const std::string longString(1000, 'x');
+    const auto full = Common::HashUtils::Crc32C(longString.data(), longString.size());
+    const auto part = Common::HashUtils::Crc32C(longString.data(), 333);
+    ASSERT_EQ(Common::HashUtils::Crc32C(longString.data() + 333, longString.size() - 333, part), full);
+}
+
+TEST(HashTest, Hash64Test)
+{
+    constexpr std::string_view testString = "Hello, World";
+    const auto hash = Common::HashUtils::Hash64(testString.data(), testString.size());
+    ASSERT_EQ(hash, Common::HashUtils::Hash64(testString.data(), testString.size()));
+    ASSERT_NE(hash, Common::HashUtils::Hash64(testString.data(), testString.size(), 1));
+    ASSERT_NE(hash, Common::HashUtils::Hash64(testString.data(), testString.size() - 1));
+
+    // zero padding of tail must not collide with real zeros
+    const std::array<uint8_t, 4> zeros {};
+    ASSERT_NE(Common::HashUtils::Hash64(zeros.data(), 3), Common::HashUtils::Hash64(zeros.data(), 4));
+    ASSERT_NE(Common::HashUtils::Hash64(nullptr, 0), Common::HashUtils::Hash64(zeros.data(), 1));
+}
+
+TEST(HashTest, HasherTest)
+{
+    std::string data;
+    for (auto i = 0; i < 200; i++) {
+        data.push_back(static_cast<char>(i * 31));
+    }
+
+    for (const size_t split : { 0, 1, 7, 47, 48, 49, 100, 200 }) {
+        Common::Hasher hasher(5);
+        hasher
+            .Update(data.data(), split)
+            .Update(data.data() + split, data.size() - split);
+        ASSERT_EQ(hasher.Finish(), Common::HashUtils::Hash64(data.data(), data.size(), 5));
+    }
+
+    Common::Hasher lhs;
+    Common::Hasher rhs;
+    lhs.Update(std::string_view("ab")).Update(std::string_view("c"));
+    rhs.Update(std::string_view("a")).Update(std::string_view("bc"));
+    ASSERT_NE(lhs.Finish(), rhs.Finish());
+
+    lhs.Reset();
+    rhs.Reset();
+    lhs.Update(static_cast<uint64_t>(1)).Update(2.0f);
+    rhs.Update(static_cast<uint64_t>(1)).Update(2.0f);
+    ASSERT_EQ(lhs.Finish(), rhs.Finish());
+}
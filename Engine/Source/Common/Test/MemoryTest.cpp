@@ -2,6 +2,9 @@
 // Created by johnk on 2023/4/14.
 //
 
+#include <thread>
+#include <vector>
+
 #include <Test/Test.h>
 
 #include <Common/Memory.h>
@@ -134,3 +137,112 @@ TEST(MemoryTest, WeakRefDeriveTest) // NOLINT
     ASSERT_EQ(live, false);
     ASSERT_EQ(weakRef.Expired(), true);
 }
+
+struct TestRefCounted : RefCounted {
+    uint32_t value;
+    bool& live;
+
+    TestRefCounted(const uint32_t inValue, bool& inLive) : value(inValue), live(inLive)
+    {
+        live = true;
+    }
+
+    ~TestRefCounted() override
+    {
+        live = false;
+    }
+};
+
+struct ChildTestRefCounted : TestRefCounted {
+    uint32_t cValue;
+
+    ChildTestRefCounted(const uint32_t inValue, const uint32_t inCValue, bool& inLive) : TestRefCounted(inValue, inLive), cValue(inCValue)
+    {
+    }
+};
+
+TEST(MemoryTest, IntrusiveRefTest) // NOLINT
+{
+    bool live;
+    {
+        const IntrusiveRef ref1 = MakeIntrusive<TestRefCounted>(1, live);
+        ASSERT_EQ(live, true);
+        ASSERT_EQ(ref1->value, 1);
+        ASSERT_EQ(ref1.RefCount(), 1);
+        ASSERT_TRUE(ref1.IsUnique());
+
+        IntrusiveRef<TestRefCounted> ref2 = ref1;
+        ASSERT_EQ(ref2.RefCount(), 2);
+        ASSERT_FALSE(ref1.IsUnique());
+
+        // count lives in object, so a raw pointer can be turned back into a reference safely
+        const IntrusiveRef<TestRefCounted> ref3 = ref2.Get();
+        ASSERT_EQ(ref1.RefCount(), 3);
+
+        const IntrusiveRef<TestRefCounted> ref4 = std::move(ref2);
+        ASSERT_EQ(ref2, nullptr);
+        ASSERT_EQ(ref4.RefCount(), 3);
+    }
+    ASSERT_EQ(live, false);
+}
+
+TEST(MemoryTest, IntrusiveRefCastTest) // NOLINT
+{
+    bool live;
+    IntrusiveRef<TestRefCounted> ref = MakeIntrusive<ChildTestRefCounted>(1, 2, live);
+    const auto childRef = ref.StaticCast<ChildTestRefCounted>();
+    ASSERT_EQ(childRef->cValue, 2);
+    ASSERT_EQ(ref.RefCount(), 2);
+    ASSERT_EQ(ref.DynamicCast<ChildTestRefCounted>(), childRef);
+
+    ref.Reset();
+    ASSERT_EQ(live, true);
+    ASSERT_TRUE(childRef.IsUnique());
+}
+
+TEST(MemoryTest, IntrusiveWeakRefTest) // NOLINT
+{
+    bool live;
+    IntrusiveRef<TestRefCounted> ref = MakeIntrusive<ChildTestRefCounted>(1, 2, live);
+    const IntrusiveWeakRef<TestRefCounted> weakRef = ref;
+    ASSERT_EQ(weakRef.Expired(), false);
+    ASSERT_EQ(ref.RefCount(), 1);
+
+    {
+        const IntrusiveRef<ChildTestRefCounted> lockRef = weakRef.Lock().StaticCast<ChildTestRefCounted>();
+        ASSERT_EQ(lockRef->cValue, 2);
+        ASSERT_EQ(ref.RefCount(), 2);
+    }
+
+    ref.Reset();
+    ASSERT_EQ(live, false);
+    ASSERT_EQ(weakRef.Expired(), true);
+    ASSERT_EQ(weakRef.Lock(), nullptr);
+}
+
+TEST(MemoryTest, IntrusiveRefConcurrentTest) // NOLINT
+{
+    bool live;
+    for (auto i = 0; i < 100; i++) {
+        IntrusiveRef<TestRefCounted> ref = MakeIntrusive<TestRefCounted>(1, live);
+        IntrusiveWeakRef<TestRefCounted> weakRef = ref;
+
+        std::vector<std::thread> threads;
+        for (auto j = 0; j < 4; j++) {
+            threads.emplace_back([ref, weakRef]() mutable -> void {
+                for (auto k = 0; k < 100; k++) {
+                    IntrusiveRef<TestRefCounted> copy = ref;
+                    IntrusiveRef<TestRefCounted> locked = weakRef.Lock();
+                    ASSERT_EQ(locked->value, 1);
+                }
+                ref.Reset();
+            });
+        }
+        ref.Reset();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ASSERT_EQ(live, false);
+        ASSERT_TRUE(weakRef.Expired());
+    }
+}
@@ -0,0 +1,110 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <random>
+#include <atomic>
+
+#include <Test/Test.h>
+
+#include <Common/Parallel.h>
+using namespace Common;
+
+static std::vector<uint32_t> RandomValues(size_t inCount)
+{
+    std::mt19937 engine(42); // NOLINT
+    std::uniform_int_distribution<uint32_t> distribution(0, 1000000);
+    std::vector<uint32_t> result(inCount);
+    for (auto& value : result) {
+        value = distribution(engine);
+    }
+    return result;
+}
+
+TEST(ParallelTest, ForTest)
+{
+    std::vector<uint32_t> values(100000, 0);
+    ParallelFor(0, values.size(), [&](size_t inIndex) -> void {
+        values[inIndex] = static_cast<uint32_t>(inIndex * 2);
+    }, 128);
+    for (auto i = 0; i < values.size(); i++) {
+        ASSERT_EQ(values[i], i * 2);
+    }
+
+    std::atomic<size_t> count = 0;
+    ParallelFor(10, 20, [&](size_t) -> void { ++count; });
+    ASSERT_EQ(count, 10);
+    ParallelFor(20, 10, [&](size_t) -> void { ++count; });
+    ASSERT_EQ(count, 10);
+
+    ParallelForEach(values.begin(), values.end(), [](uint32_t& inValue) -> void { inValue++; }, 128);
+    for (auto i = 0; i < values.size(); i++) {
+        ASSERT_EQ(values[i], i * 2 + 1);
+    }
+}
+
+TEST(ParallelTest, NestedForTest)
+{
+    std::vector<std::atomic<uint32_t>> counts(64);
+    ParallelFor(0, counts.size(), [&](size_t inOuter) -> void {
+        ParallelFor(0, 4096, [&](size_t) -> void { ++counts[inOuter]; }, 16);
+    }, 1);
+    for (const auto& count : counts) {
+        ASSERT_EQ(count, 4096);
+    }
+}
+
+TEST(ParallelTest, SortTest)
+{
+    for (const size_t count : { 0, 1, 100, 5000, 100003 }) {
+        auto values = RandomValues(count);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        ParallelSort(values.begin(), values.end(), std::less<> {}, 256);
+        ASSERT_EQ(values, expected);
+    }
+
+    auto values = RandomValues(20000);
+    ParallelSort(values.begin(), values.end(), std::greater<> {}, 256);
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<> {}));
+}
+
+TEST(ParallelTest, ReduceTest)
+{
+    const auto values = RandomValues(100000);
+    const auto expected = std::accumulate(values.begin(), values.end(), static_cast<uint64_t>(0));
+    ASSERT_EQ(ParallelReduce(values.begin(), values.end(), static_cast<uint64_t>(0), std::plus<> {}, 128), expected);
+    ASSERT_EQ(ParallelReduce(values.begin(), values.begin(), static_cast<uint64_t>(7)), 7);
+
+    // not commutative, chunk results must be combined in order
+    std::vector<std::string> strings;
+    for (auto i = 0; i < 3000; i++) {
+        strings.emplace_back(std::to_string(i % 10));
+    }
+    const auto concat = ParallelReduce(strings.begin(), strings.end(), std::string(), std::plus<> {}, 64);
+    ASSERT_EQ(concat, std::accumulate(strings.begin(), strings.end(), std::string()));
+}
+
+TEST(ParallelTest, ScanTest)
+{
+    for (const size_t count : { 0, 1, 100, 5000, 100003 }) {
+        const auto values = RandomValues(count);
+        std::vector<uint64_t> expected(count);
+        uint64_t sum = 0;
+        for (auto i = 0; i < count; i++) {
+            sum += values[i];
+            expected[i] = sum;
+        }
+
+        std::vector<uint64_t> result(count);
+        const auto end = ParallelScan(values.begin(), values.end(), result.begin(), std::plus<uint64_t> {}, 256);
+        ASSERT_EQ(end, result.end());
+        ASSERT_EQ(result, expected);
+    }
+
+    std::vector<uint32_t> inplace(10000, 1);
+    ParallelScan(inplace.begin(), inplace.end(), inplace.begin(), std::plus<> {}, 100);
+    for (auto i = 0; i < inplace.size(); i++) {
+        ASSERT_EQ(inplace[i], i + 1);
+    }
+}
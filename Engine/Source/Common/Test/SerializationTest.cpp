@@ -3,6 +3,7 @@
 //
 
 #include <filesystem>
+#include <sstream>
 
 #include <Common/Memory.h>
 #include <SerializationTest.h>
@@ -32,6 +33,50 @@ TEST(SerializationTest, FileStreamTest)
     }
 }
 
+TEST(SerializationTest, BufferedFileStreamTest)
+{
+    static std::filesystem::path fileName = "../Test/Generated/Common/SerializationTest.BufferedFileStreamTest.bin";
+    std::filesystem::create_directories(fileName.parent_path());
+
+    std::vector<uint32_t> values(1000);
+    for (auto i = 0; i < values.size(); i++) {
+        values[i] = i;
+    }
+
+    {
+        // header patching seeks back both inside and beyond the block
+        BinaryFileSerializeStream stream(fileName.string(), 64);
+        stream.Seek(4);
+        stream.WriteBulk(values.data(), 10);
+        stream.Seek(-44);
+        stream.Write<uint32_t>(10);
+        stream.Seek(40);
+        stream.Seek(4);
+        stream.WriteBulk(values.data(), values.size());
+        stream.Seek(-4004);
+        stream.Write<uint32_t>(static_cast<uint32_t>(values.size()));
+        stream.Seek(4000);
+        ASSERT_EQ(stream.Loc(), 4048);
+    }
+
+    {
+        MappedFileDeserializeStream stream(fileName.string());
+        uint32_t count;
+        stream.Read<uint32_t>(count);
+        ASSERT_EQ(count, 10);
+        std::vector<uint32_t> result(count);
+        stream.ReadBulk(result.data(), count);
+        ASSERT_TRUE(std::equal(result.begin(), result.end(), values.begin()));
+
+        stream.Read<uint32_t>(count);
+        ASSERT_EQ(count, values.size());
+        const auto view = stream.ReadView(count * sizeof(uint32_t));
+        ASSERT_EQ(view.size(), values.size() * sizeof(uint32_t));
+        ASSERT_EQ(memcmp(view.data(), values.data(), view.size()), 0);
+        ASSERT_EQ(stream.Loc(), 4048);
+    }
+}
+
 TEST(SerializationTest, ByteStreamTest)
 {
     static std::filesystem::path fileName = "../Test/Generated/Common/SerializationTest.ByteStreamTest.bin";
@@ -83,6 +128,245 @@ TEST(SerializationTest, TypedSerializationTest)
     PerformTypedSerializationTest<std::tuple<int, bool, int>>({ 1, true, 2 });
 }
 
+TEST(SerializationTest, BulkSerializationTest)
+{
+    std::vector<float> floats(100000);
+    for (auto i = 0; i < floats.size(); i++) {
+        floats[i] = static_cast<float>(i) * 0.5f;
+    }
+    PerformTypedSerializationTest<std::vector<float>>(floats);
+    PerformTypedSerializationTest<std::vector<uint8_t>>(std::vector<uint8_t>(5000, 7));
+    PerformTypedSerializationTest<std::vector<int64_t>>({ -1, 0, 1, 0x123456789abcdef0 });
+    PerformTypedSerializationTest<std::vector<double>>({});
+    PerformTypedSerializationTest<std::array<uint16_t, 4>>({ 1, 0x102, 0xfffe, 0 });
+    PerformTypedSerializationTest<std::string>(std::string(10000, 'a'));
+    PerformTypedSerializationTest<std::wstring>(std::wstring(3000, L'b'));
+
+    // bulk path must keep the element by element wire format
+    std::vector<uint8_t> memory;
+    {
+        MemorySerializeStream<std::endian::big> stream(memory);
+        Serializer<std::vector<uint32_t>>::Serialize(stream, { 0x01020304, 0x05060708 });
+    }
+    const std::vector<uint8_t> expected = { 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 3, 4, 5, 6, 7, 8 };
+    ASSERT_EQ(memory, expected);
+}
+
+TEST(SerializationTest, AppendOnlyStreamTest)
+{
+    const std::tuple<int, std::string, std::vector<float>> value = { 1, "hello", { 2.0f, 3.0f } };
+
+    std::vector<uint8_t> memory;
+    {
+        MemorySerializeStream stream(memory);
+        Serialize(stream, value);
+        Serialize(stream, std::string("world"));
+    }
+
+    std::ostringstream appendOnly;
+    {
+        OStreamSerializeStream stream(appendOnly);
+        ASSERT_EQ(stream.Framing(), SerializeFraming::sizePass);
+        ASSERT_EQ(Serialize(stream, value) + Serialize(stream, std::string("world")), memory.size());
+    }
+    const auto bytes = appendOnly.str();
+    ASSERT_EQ(std::vector<uint8_t>(bytes.begin(), bytes.end()), memory);
+
+    SizeCounterSerializeStream counter;
+    Serialize(counter, value);
+    Serialize(counter, std::string("world"));
+    ASSERT_EQ(counter.Size(), memory.size());
+}
+
+TEST(SerializationTest, VarIntSerializationTest)
+{
+    const std::tuple<int32_t, int64_t, uint64_t, int8_t, std::vector<std::string>, std::map<uint32_t, int16_t>> value = {
+        -1, INT64_MIN, UINT64_MAX, INT8_MIN, { "a", "bc", "" }, { { 0, -300 }, { 127, 300 }, { 128, INT16_MAX } }
+    };
+
+    std::vector<uint8_t> fixed;
+    {
+        MemorySerializeStream stream(fixed);
+        Serialize(stream, value);
+    }
+
+    std::vector<uint8_t> varint;
+    size_t serialized;
+    {
+        MemorySerializeStream stream(varint);
+        ASSERT_EQ(WriteSerializeHeader(stream, SerializeIntEncoding::varint), 8);
+        ASSERT_EQ(stream.IntEncoding(), SerializeIntEncoding::varint);
+        serialized = Serialize(stream, value);
+    }
+    ASSERT_EQ(serialized + 8, varint.size());
+    ASSERT_LT(varint.size(), fixed.size());
+
+    {
+        MemoryDeserializeStream stream(varint);
+        ASSERT_TRUE(ReadSerializeHeader(stream));
+        ASSERT_EQ(stream.IntEncoding(), SerializeIntEncoding::varint);
+
+        std::remove_const_t<decltype(value)> restored;
+        const auto [success, deserialized] = Deserialize(stream, restored);
+        ASSERT_TRUE(success);
+        ASSERT_EQ(deserialized, serialized);
+        ASSERT_EQ(restored, value);
+        ASSERT_EQ(stream.Loc(), varint.size());
+    }
+
+    // payloads without header fall back to fixed encoding
+    {
+        MemoryDeserializeStream stream(fixed);
+        ASSERT_FALSE(ReadSerializeHeader(stream));
+        ASSERT_EQ(stream.Loc(), 0);
+        ASSERT_EQ(stream.IntEncoding(), SerializeIntEncoding::fixed);
+
+        std::remove_const_t<decltype(value)> restored;
+        ASSERT_TRUE(Deserialize(stream, restored).first);
+        ASSERT_EQ(restored, value);
+    }
+
+    // zigzag keeps small negative values small
+    std::vector<uint8_t> memory;
+    {
+        MemorySerializeStream stream(memory);
+        stream.SetIntEncoding(SerializeIntEncoding::varint);
+        ASSERT_EQ(Serializer<int64_t>::Serialize(stream, -1), 1);
+        ASSERT_EQ(Serializer<int64_t>::Serialize(stream, 64), 2);
+        ASSERT_EQ(Serializer<uint64_t>::Serialize(stream, UINT64_MAX), 10);
+    }
+    const std::vector<uint8_t> expected = { 0x01, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01 };
+    ASSERT_EQ(memory, expected);
+}
+
+TEST(SerializationTest, SchemaTableTest)
+{
+    const auto buildSchema = [](const std::string& inName, std::vector<std::string> inFieldNames) -> auto {
+        return [=]() -> SerializeSchemaTable::Schema {
+            return { inName, inFieldNames, {} };
+        };
+    };
+
+    std::vector<uint8_t> memory;
+    {
+        SerializeSchemaTable schemaTable;
+        MemorySerializeStream stream(memory);
+        WriteSerializeHeader(stream, SerializeIntEncoding::varint, &schemaTable);
+        ASSERT_EQ(stream.SchemaTable(), &schemaTable);
+
+        ASSERT_EQ(schemaTable.FindOrAdd("A", buildSchema("A", { "a", "b" })), 0);
+        ASSERT_EQ(schemaTable.FindOrAdd("B", buildSchema("B", {})), 1);
+        ASSERT_EQ(schemaTable.FindOrAdd("A", buildSchema("A", { "c" })), 0);
+        Serialize(stream, std::string("payload"));
+        ASSERT_GT(WriteSerializeFooter(stream), sizeof(uint64_t));
+    }
+
+    MemoryDeserializeStream stream(memory);
+    SerializeSchemaTable schemaTable;
+    ASSERT_TRUE(ReadSerializeHeader(stream, &schemaTable));
+    ASSERT_EQ(stream.SchemaTable(), &schemaTable);
+    ASSERT_EQ(stream.Loc(), 8);
+    ASSERT_EQ(schemaTable.Num(), 2);
+    ASSERT_EQ(schemaTable.Find(0)->name, "A");
+    ASSERT_EQ(schemaTable.Find(0)->fieldNames, std::vector<std::string>({ "a", "b" }));
+    ASSERT_EQ(schemaTable.Find(1)->name, "B");
+    ASSERT_TRUE(schemaTable.Find(1)->fieldNames.empty());
+    ASSERT_EQ(schemaTable.Find(2), nullptr);
+
+    std::string payload;
+    ASSERT_TRUE(Deserialize(stream, payload).first);
+    ASSERT_EQ(payload, "payload");
+}
+
+TEST(SerializationTest, CompressedStreamTest)
+{
+    std::vector<uint32_t> values(100000);
+    for (auto i = 0; i < values.size(); i++) {
+        values[i] = i / 16;
+    }
+    const std::tuple<std::string, std::vector<uint32_t>, double> value = { "header", values, 1.5 };
+
+    std::vector<uint8_t> raw;
+    {
+        MemorySerializeStream stream(raw);
+        Serialize(stream, value);
+    }
+
+    std::vector<uint8_t> memory = { 1, 2, 3 };
+    {
+        MemorySerializeStream stream(memory, memory.size());
+        CompressedSerializeStream compressed(stream, 4096);
+        ASSERT_EQ(Serialize(compressed, value), raw.size());
+    }
+    ASSERT_LT(memory.size(), raw.size() / 2);
+
+    {
+        MemoryDeserializeStream stream(memory, 3);
+        ASSERT_TRUE(CompressedDeserializeStream::IsCompressed(stream));
+        CompressedDeserializeStream compressed(stream);
+        ASSERT_TRUE(compressed.IsValid());
+        ASSERT_EQ(compressed.Size(), raw.size());
+
+        std::tuple<std::string, std::vector<uint32_t>, double> restored;
+        ASSERT_TRUE(Deserialize(compressed, restored).first);
+        ASSERT_EQ(restored, value);
+
+        // random access through seek table
+        compressed.Seek(-static_cast<int64_t>(raw.size()) + 10000);
+        std::vector<uint8_t> tail(raw.size() - 10000);
+        compressed.ReadBulk(tail.data(), tail.size());
+        ASSERT_TRUE(std::equal(tail.begin(), tail.end(), raw.begin() + 10000));
+    }
+
+    {
+        MemoryDeserializeStream stream(raw);
+        ASSERT_FALSE(CompressedDeserializeStream::IsCompressed(stream));
+        ASSERT_EQ(stream.Loc(), 0);
+    }
+}
+
+TEST(SerializationTest, CorruptCompressedStreamTest)
+{
+    std::vector<uint32_t> values(100000);
+    for (auto i = 0; i < values.size(); i++) {
+        values[i] = i / 16;
+    }
+
+    std::vector<uint8_t> memory;
+    {
+        MemorySerializeStream stream(memory);
+        CompressedSerializeStream compressed(stream, 4096);
+        Serialize(compressed, values);
+    }
+
+    // damage the middle of block data, header and seek table stay intact
+    {
+        auto corrupted = memory;
+        std::fill(corrupted.begin() + 32, corrupted.begin() + corrupted.size() / 2, 0xff);
+
+        MemoryDeserializeStream stream(corrupted);
+        CompressedDeserializeStream compressed(stream);
+        ASSERT_TRUE(compressed.IsValid());
+
+        std::vector<uint32_t> restored;
+        Deserialize(compressed, restored);
+        ASSERT_FALSE(compressed.IsValid());
+    }
+
+    // drop the seek table
+    {
+        const std::vector<uint8_t> truncated(memory.begin(), memory.begin() + memory.size() / 2);
+        MemoryDeserializeStream stream(truncated);
+        CompressedDeserializeStream compressed(stream);
+        ASSERT_FALSE(compressed.IsValid());
+
+        uint64_t value = 1;
+        compressed.Read(value);
+        ASSERT_EQ(value, 0);
+        ASSERT_FALSE(compressed.IsValid());
+    }
+}
+
 TEST(SerializationTest, JsonSerializeTest)
 {
     PerformJsonSerializationTest<bool>(false, "false");
@@ -112,3 +396,49 @@ TEST(SerializationTest, JsonSerializeTest)
     PerformJsonSerializationTest<std::map<std::string, int>>({ { "1", 1 }, { "2", 2 } }, R"([{"key":"1","value":1},{"key":"2","value":2}])");
     PerformJsonSerializationTest<std::tuple<int, bool, int>>({ 1, true, 2 }, R"({"0":1,"1":true,"2":2})");
 }
+
+TEST(SerializationTest, JsonStreamTest)
+{
+    {
+        std::stringstream stream;
+        {
+            Common::JsonWriter writer(stream);
+            Common::JsonWrite<std::map<std::string, std::vector<int>>>(writer, { { "a", { 1, 2 } }, { "b", {} } });
+        }
+        ASSERT_EQ(stream.str(), R"([{"key":"a","value":[1,2]},{"key":"b","value":[]}])");
+    }
+
+    {
+        // unknown keys and mismatched values are skipped without breaking following values
+        const std::string json = R"({"key":{"x":[2,[3]]},"unknown":{"y":[null,true]},"value":[1,4]})";
+        Common::JsonReader reader(json);
+        std::pair<int, std::vector<int>> value { 7, {} };
+        Common::JsonRead(reader, value);
+        ASSERT_EQ(reader.Peek(), Common::JsonTokenType::end);
+        ASSERT_EQ(value.first, 7);
+        ASSERT_EQ(value.second, (std::vector<int> { 1, 4 }));
+    }
+
+    {
+        Common::JsonReader reader("[1,2");
+        std::vector<int> value;
+        Common::JsonRead(reader, value);
+        ASSERT_TRUE(reader.HasError());
+        ASSERT_EQ(value, (std::vector<int> { 1, 2 }));
+    }
+
+    {
+        Common::JsonReader reader("[1,2,3,4]");
+        std::array<int, 3> value { 1, 1, 1 };
+        Common::JsonRead(reader, value);
+        ASSERT_EQ(value, (std::array<int, 3> { 0, 0, 0 }));
+    }
+
+    for (const auto* json : { "-1", "4294967296", "3.5", "\"3\"" }) {
+        Common::JsonReader reader(json);
+        uint32_t value = 5;
+        Common::JsonRead(reader, value);
+        ASSERT_EQ(reader.Peek(), Common::JsonTokenType::end);
+        ASSERT_EQ(value, 5);
+    }
+}
@@ -63,11 +63,29 @@ void PerformTypedSerializationTestWithEndian(const T& inValue)
         []() -> Common::UniqueRef<Common::BinaryDeserializeStream> { return { new Common::BinaryFileDeserializeStream<E>(fileName.string()) }; },
         inValue);
 
+    PerformTypedSerializationTestWithStream<T>(
+        []() -> Common::UniqueRef<Common::BinarySerializeStream> { return { new Common::BinaryFileSerializeStream<E>(fileName.string(), 16) }; },
+        []() -> Common::UniqueRef<Common::BinaryDeserializeStream> { return { new Common::MappedFileDeserializeStream<E>(fileName.string()) }; },
+        inValue);
+
     std::vector<uint8_t> buffer;
     PerformTypedSerializationTestWithStream<T>(
         [&]() -> Common::UniqueRef<Common::BinarySerializeStream> { return { new Common::MemorySerializeStream<E>(buffer) }; },
         [&]() -> Common::UniqueRef<Common::BinaryDeserializeStream> { return { new Common::MemoryDeserializeStream<E>(buffer) }; },
         inValue);
+
+    PerformTypedSerializationTestWithStream<T>(
+        [&]() -> Common::UniqueRef<Common::BinarySerializeStream> {
+            auto* stream = new Common::MemorySerializeStream<E>(buffer);
+            Common::WriteSerializeHeader(*stream, Common::SerializeIntEncoding::varint);
+            return { stream };
+        },
+        [&]() -> Common::UniqueRef<Common::BinaryDeserializeStream> {
+            auto* stream = new Common::MemoryDeserializeStream<E>(buffer);
+            Common::ReadSerializeHeader(*stream);
+            return { stream };
+        },
+        inValue);
 }
 
 template <typename T>
@@ -110,4 +128,17 @@ void PerformJsonSerializationTest(const T& inValue, const std::string& inExceptJ
         Common::JsonDeserialize<T>(jsonValue, value);
         ASSERT_EQ(inValue, value);
     }
+
+    {
+        Common::JsonWriter writer;
+        Common::JsonWrite<T>(writer, inValue);
+        ASSERT_TRUE(writer.IsComplete());
+        ASSERT_EQ(writer.Str(), json);
+
+        Common::JsonReader reader(json);
+        T value;
+        Common::JsonRead<T>(reader, value);
+        ASSERT_EQ(reader.Peek(), Common::JsonTokenType::end);
+        ASSERT_EQ(inValue, value);
+    }
 }
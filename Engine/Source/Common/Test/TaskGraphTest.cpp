@@ -0,0 +1,76 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <Test/Test.h>
+
+#include <Common/TaskGraph.h>
+using namespace Common;
+
+TEST(TaskGraphTest, AsyncTest)
+{
+    auto future = TaskExecutor::Shared().Async([]() -> uint32_t { return 1; });
+    ASSERT_EQ(future.Get(), 1);
+    ASSERT_TRUE(future.Ready());
+
+    std::atomic<uint32_t> value = 0;
+    auto voidFuture = TaskExecutor::Shared().Async([&value]() -> void { ++value; });
+    voidFuture.Wait();
+    ASSERT_EQ(value, 1);
+}
+
+TEST(TaskGraphTest, ThenTest)
+{
+    TaskExecutor executor("TestTaskExecutor", 2);
+    auto future = executor.Async([]() -> uint32_t { return 2; })
+        .Then([](const uint32_t& inValue) -> uint32_t { return inValue * 3; })
+        .Then([](const uint32_t& inValue) -> std::string { return std::to_string(inValue); });
+    ASSERT_EQ(future.Get(), "6");
+    ASSERT_EQ(&future.Executor(), &executor);
+
+    std::atomic<uint32_t> value = 0;
+    auto voidFuture = executor.Async([&value]() -> void { value = 1; })
+        .Then([&value]() -> void { value = value * 5; });
+    voidFuture.Wait();
+    ASSERT_EQ(value, 5);
+}
+
+TEST(TaskGraphTest, WhenAllTest0)
+{
+    TaskExecutor executor("TestTaskExecutor", 4);
+    std::vector<TaskFuture<uint32_t>> futures;
+    for (uint32_t i = 0; i < 100; i++) {
+        futures.emplace_back(executor.Async([i]() -> uint32_t { return i; }));
+    }
+    auto sum = WhenAll(futures).Then([](const std::vector<uint32_t>& inValues) -> uint32_t {
+        uint32_t result = 0;
+        for (auto i = 0; i < inValues.size(); i++) {
+            result += inValues[i] == i ? inValues[i] : 0;
+        }
+        return result;
+    });
+    ASSERT_EQ(sum.Get(), 4950);
+
+    ASSERT_TRUE(WhenAll(std::vector<TaskFuture<uint32_t>> {}).Get().empty());
+}
+
+TEST(TaskGraphTest, WhenAllTest1)
+{
+    TaskExecutor executor("TestTaskExecutor", 4);
+    std::atomic<uint32_t> a = 0;
+    std::atomic<uint32_t> b = 0;
+    auto taskA = executor.Async([&a]() -> void { a = 1; });
+    auto taskB = executor.Async([&b]() -> float { b = 2; return 1.0f; });
+    auto taskC = WhenAll(taskA, taskB).Then([&a, &b]() -> uint32_t { return a + b; });
+    ASSERT_EQ(taskC.Get(), 3);
+}
+
+TEST(TaskGraphTest, ReadyContinuationTest)
+{
+    TaskExecutor executor("TestTaskExecutor", 1);
+    auto future = executor.Async([]() -> uint32_t { return 3; });
+    future.Wait();
+    auto a = future.Then([](const uint32_t& inValue) -> uint32_t { return inValue + 1; });
+    auto b = future.Then([](const uint32_t& inValue) -> uint32_t { return inValue + 2; });
+    ASSERT_EQ(a.Get() + b.Get(), 9);
+}
@@ -0,0 +1,28 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <Common/Parallel.h>
+#include <Common/TaskGraph.h>
+#include <Core/Api.h>
+
+namespace Core {
+    // Common is linked statically into every shared module, executors defined in Common would be duplicated per module,
+    // so the process wide instances are owned here by Core (shared) and installed into the Common copy of each module
+    class CORE_API SharedExecutors {
+    public:
+        static tf::Executor& Parallel();
+        static Common::TaskExecutor& Task();
+    };
+
+    // inline on purpose, installs into the Common copy of the calling module. called by IMPLEMENT_DYNAMIC_MODULE and
+    // IMPLEMENT_STATIC_MODULE, executables using parallel algorithms or task graphs before loading any module should
+    // call it in main()
+    inline void InstallSharedExecutors()
+    {
+        Common::SetParallelExecutor(&SharedExecutors::Parallel());
+        Common::TaskExecutor::SetShared(&SharedExecutors::Task());
+    }
+}
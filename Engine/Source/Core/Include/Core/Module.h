@@ -11,6 +11,7 @@
 #include <Common/DynamicLibrary.h>
 #include <Common/Debug.h>
 #include <Core/Api.h>
+#include <Core/Executor.h>
 
 // if your dynamic library always given interface by XXX_API nor module,
 // just declare a min module as placeholder to compatible with module manager
@@ -22,12 +23,14 @@
 #define IMPLEMENT_DYNAMIC_MODULE(apiName, moduleClass) \
     extern "C" apiName Core::Module* GetModule() \
     { \
+        Core::InstallSharedExecutors(); \
         static moduleClass instance; \
         return &instance; \
     } \
 
 #define IMPLEMENT_STATIC_MODULE(id, name, moduleClass) \
     int _register_##id = []() -> int { \
+        Core::InstallSharedExecutors(); \
         static moduleClass instance; \
         Core::ModuleManager::Get().Register(name, instance); \
         return 0; \
@@ -0,0 +1,30 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <thread>
+#include <algorithm>
+
+#include <taskflow/taskflow.hpp>
+
+#include <Core/Executor.h>
+
+namespace Core {
+    tf::Executor& SharedExecutors::Parallel()
+    {
+        static tf::Executor executor;
+        return executor;
+    }
+
+    Common::TaskExecutor& SharedExecutors::Task()
+    {
+        static Common::TaskExecutor executor("TaskWorker", static_cast<uint8_t>(std::clamp(std::thread::hardware_concurrency(), 1u, 255u)));
+        return executor;
+    }
+
+    // Core links Common statically too, install into its own copy
+    static int installSharedExecutors = []() -> int {
+        InstallSharedExecutors();
+        return 0;
+    }();
+}
@@ -0,0 +1,128 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <Benchmark/Benchmark.h>
+#include <Mirror/Mirror.h>
+#include <ReflectionBenchmark.h>
+
+ReflectionBenchmarkStruct::ReflectionBenchmarkStruct()
+    : a(0)
+    , b(0.0f)
+{
+}
+
+ReflectionBenchmarkStruct::ReflectionBenchmarkStruct(int32_t inA, float inB)
+    : a(inA)
+    , b(inB)
+{
+}
+
+int32_t ReflectionBenchmarkStruct::Add(int32_t inValue) const
+{
+    return a + inValue;
+}
+
+float ReflectionBenchmarkStruct::Scale(float inValue, float inFactor)
+{
+    return inValue * inFactor;
+}
+
+BENCHMARK(ReflectionClassGetByType)
+{
+    while (state.Next()) {
+        const auto* clazz = &Mirror::Class::Get<ReflectionBenchmarkStruct>();
+        Benchmark::DoNotOptimize(clazz);
+    }
+}
+
+BENCHMARK(ReflectionClassGetByTypeId)
+{
+    const auto typeId = Mirror::GetTypeInfo<ReflectionBenchmarkStruct>()->id;
+    while (state.Next()) {
+        const auto* clazz = &Mirror::Class::Get(typeId);
+        Benchmark::DoNotOptimize(clazz);
+    }
+}
+
+BENCHMARK(ReflectionStaticFunctionInvoke)
+{
+    const auto& function = Mirror::Class::Get<ReflectionBenchmarkStruct>().GetStaticFunction("Scale");
+    float value = 1.0f;
+    while (state.Next()) {
+        value = function.Invoke(value, 1.0f).As<float>();
+        Benchmark::DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(ReflectionStaticFunctionInvokeDyn)
+{
+    const auto& function = Mirror::Class::Get<ReflectionBenchmarkStruct>().GetStaticFunction("Scale");
+    float value = 1.0f;
+    while (state.Next()) {
+        value = function.InvokeDyn(Mirror::ForwardAsArgList(value, 1.0f)).As<float>();
+        Benchmark::DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(ReflectionMemberFunctionInvoke)
+{
+    const auto& function = Mirror::Class::Get<ReflectionBenchmarkStruct>().GetMemberFunction("Add");
+    const ReflectionBenchmarkStruct object(1, 0.0f);
+    int32_t value = 0;
+    while (state.Next()) {
+        value = function.Invoke(object, value).As<int32_t>();
+        Benchmark::DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(ReflectionMemberVariableGet)
+{
+    const auto& memberVariable = Mirror::Class::Get<ReflectionBenchmarkStruct>().GetMemberVariable("a");
+    ReflectionBenchmarkStruct object(1, 0.0f);
+    while (state.Next()) {
+        memberVariable.Get(object).As<int32_t&>()++;
+        Benchmark::DoNotOptimize(object);
+    }
+}
+
+BENCHMARK(ReflectionMemberVariableSet)
+{
+    const auto& memberVariable = Mirror::Class::Get<ReflectionBenchmarkStruct>().GetMemberVariable("b");
+    ReflectionBenchmarkStruct object;
+    const float value = 1.0f;
+    while (state.Next()) {
+        memberVariable.Set(object, value);
+        Benchmark::DoNotOptimize(object);
+    }
+}
+
+BENCHMARK(ReflectionConstructorConstruct)
+{
+    const auto& constructor = Mirror::Class::Get<ReflectionBenchmarkStruct>().GetConstructor("int32_t, float");
+    while (state.Next()) {
+        auto object = constructor.Construct(1, 2.0f);
+        Benchmark::DoNotOptimize(object);
+    }
+}
+
+BENCHMARK(ReflectionClassInplaceNew)
+{
+    const auto& clazz = Mirror::Class::Get<ReflectionBenchmarkStruct>();
+    alignas(ReflectionBenchmarkStruct) uint8_t memory[sizeof(ReflectionBenchmarkStruct)];
+    while (state.Next()) {
+        auto object = clazz.InplaceNew(memory, 1, 2.0f);
+        Benchmark::DoNotOptimize(object);
+    }
+}
+
+BENCHMARK(DirectMemberFunctionCall)
+{
+    const ReflectionBenchmarkStruct object(1, 0.0f);
+    int32_t value = 0;
+    while (state.Next()) {
+        Benchmark::DoNotOptimize(object);
+        value = object.Add(value);
+        Benchmark::DoNotOptimize(value);
+    }
+}
@@ -0,0 +1,22 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include <Mirror/Meta.h>
+
+struct EClass() ReflectionBenchmarkStruct {
+    EClassBody(ReflectionBenchmarkStruct)
+
+    ReflectionBenchmarkStruct();
+    ReflectionBenchmarkStruct(int32_t inA, float inB);
+
+    EFunc() int32_t Add(int32_t inValue) const;
+    EFunc() static float Scale(float inValue, float inFactor);
+
+    EProperty() int32_t a;
+    EProperty() float b;
+};
@@ -0,0 +1,251 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <filesystem>
+#include <ranges>
+#include <format>
+
+#include <rapidjson/stringbuffer.h>
+
+#include <Benchmark/Benchmark.h>
+#include <Mirror/Mirror.h>
+#include <Mirror/Patch.h>
+#include <SerializationBenchmark.h>
+using namespace Common;
+
+static const std::filesystem::path fileName = "../Benchmark/Generated/Mirror/SerializationBenchmark.bin";
+
+enum class BinaryFormat : uint8_t {
+    fixed,
+    varint,
+    schemaTable,
+    max
+};
+
+template <typename T>
+static const std::vector<T>& GetObjects(size_t inCount)
+{
+    static const std::vector<T> objects = [&]() -> std::vector<T> {
+        std::vector<T> result(inCount);
+        const auto& clazz = Mirror::Class::Get<T>();
+        for (auto i = 0; i < result.size(); i++) {
+            for (const auto& memberVariable : clazz.GetMemberVariables() | std::views::values) {
+                auto member = memberVariable.GetDyn(Mirror::ForwardAsArg(result[i]));
+                if (auto* value = member.template TryAs<int32_t>()) {
+                    *value = i + 1;
+                } else if (auto* value = member.template TryAs<float>()) {
+                    *value = static_cast<float>(i) + 0.5f;
+                } else if (auto* value = member.template TryAs<std::string>()) {
+                    *value = std::format("value{}", i);
+                } else if (auto* value = member.template TryAs<uint64_t>()) {
+                    *value = static_cast<uint64_t>(i) << 24;
+                } else if (auto* value = member.template TryAs<double>()) {
+                    *value = static_cast<double>(i) + 0.25;
+                }
+            }
+        }
+        return result;
+    }();
+    return objects;
+}
+
+// both object sets hold 10000 member variables in total
+static const std::vector<SerializationBenchmarkStruct10>& GetObjects10()
+{
+    return GetObjects<SerializationBenchmarkStruct10>(1000);
+}
+
+static const std::vector<SerializationBenchmarkStruct100>& GetObjects100()
+{
+    return GetObjects<SerializationBenchmarkStruct100>(100);
+}
+
+template <typename T>
+static void SerializeWithFormat(BinarySerializeStream& stream, const T& inValue, BinaryFormat inFormat)
+{
+    SerializeSchemaTable schemaTable;
+    WriteSerializeHeader(
+        stream,
+        inFormat == BinaryFormat::fixed ? SerializeIntEncoding::fixed : SerializeIntEncoding::varint,
+        inFormat == BinaryFormat::schemaTable ? &schemaTable : nullptr);
+    Serialize(stream, inValue);
+    WriteSerializeFooter(stream);
+}
+
+template <typename T>
+static void BinaryMemoryWrite(Benchmark::State& state, const T& inValue, BinaryFormat inFormat)
+{
+    std::vector<uint8_t> buffer;
+    while (state.Next()) {
+        buffer.clear();
+        MemorySerializeStream stream(buffer);
+        SerializeWithFormat(stream, inValue, inFormat);
+    }
+    state.SetBytesPerIteration(buffer.size());
+}
+
+template <typename T>
+static void BinaryMemoryRead(Benchmark::State& state, const T& inValue, BinaryFormat inFormat)
+{
+    std::vector<uint8_t> buffer;
+    {
+        MemorySerializeStream stream(buffer);
+        SerializeWithFormat(stream, inValue, inFormat);
+    }
+
+    T value;
+    while (state.Next()) {
+        SerializeSchemaTable schemaTable;
+        MemoryDeserializeStream stream(buffer);
+        ReadSerializeHeader(stream, &schemaTable);
+        Deserialize(stream, value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(buffer.size());
+}
+
+template <typename T>
+static void BinaryFileWrite(Benchmark::State& state, const T& inValue, BinaryFormat inFormat)
+{
+    std::filesystem::create_directories(fileName.parent_path());
+    while (state.Next()) {
+        BinaryFileSerializeStream stream(fileName.string());
+        SerializeWithFormat(stream, inValue, inFormat);
+    }
+    state.SetBytesPerIteration(std::filesystem::file_size(fileName));
+}
+
+template <typename T>
+static void MappedFileRead(Benchmark::State& state, const T& inValue, BinaryFormat inFormat)
+{
+    std::filesystem::create_directories(fileName.parent_path());
+    {
+        BinaryFileSerializeStream stream(fileName.string());
+        SerializeWithFormat(stream, inValue, inFormat);
+    }
+
+    T value;
+    while (state.Next()) {
+        SerializeSchemaTable schemaTable;
+        MappedFileDeserializeStream stream(fileName.string());
+        ReadSerializeHeader(stream, &schemaTable);
+        Deserialize(stream, value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(std::filesystem::file_size(fileName));
+}
+
+template <typename T>
+static void JsonDomWrite(Benchmark::State& state, const T& inValue)
+{
+    size_t size = 0;
+    while (state.Next()) {
+        rapidjson::Document document;
+        rapidjson::Value jsonValue;
+        JsonSerialize(jsonValue, document.GetAllocator(), inValue);
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer writer(buffer);
+        jsonValue.Accept(writer);
+        size = buffer.GetSize();
+    }
+    state.SetBytesPerIteration(size);
+}
+
+template <typename T>
+static void JsonDomRead(Benchmark::State& state, const T& inValue)
+{
+    JsonWriter writer;
+    JsonWrite(writer, inValue);
+    const std::string json(writer.Str());
+
+    T value;
+    while (state.Next()) {
+        rapidjson::Document document;
+        document.Parse(json.c_str());
+        JsonDeserialize(document, value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(json.size());
+}
+
+template <typename T>
+static void JsonStreamWrite(Benchmark::State& state, const T& inValue)
+{
+    size_t size = 0;
+    while (state.Next()) {
+        JsonWriter writer;
+        JsonWrite(writer, inValue);
+        size = writer.Str().size();
+    }
+    state.SetBytesPerIteration(size);
+}
+
+template <typename T>
+static void JsonStreamRead(Benchmark::State& state, const T& inValue)
+{
+    JsonWriter writer;
+    JsonWrite(writer, inValue);
+    const std::string json(writer.Str());
+
+    T value;
+    while (state.Next()) {
+        JsonReader reader(json);
+        JsonRead(reader, value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(json.size());
+}
+
+template <typename T>
+static void ObjectDiff(Benchmark::State& state, const T& inBase, const T& inTarget)
+{
+    while (state.Next()) {
+        auto patch = Mirror::ObjectPatch::Diff(inBase, inTarget);
+        Benchmark::DoNotOptimize(patch);
+    }
+}
+
+template <typename T>
+static void ObjectPatchApply(Benchmark::State& state, const T& inBase, const T& inTarget)
+{
+    const auto patch = Mirror::ObjectPatch::Diff(inBase, inTarget);
+    T value = inBase;
+    while (state.Next()) {
+        patch.Apply(value);
+        Benchmark::DoNotOptimize(value);
+    }
+    state.SetBytesPerIteration(patch.DataSize());
+}
+
+BENCHMARK(BinaryMemoryWriteClass10Fixed) { BinaryMemoryWrite(state, GetObjects10(), BinaryFormat::fixed); }
+BENCHMARK(BinaryMemoryWriteClass10VarInt) { BinaryMemoryWrite(state, GetObjects10(), BinaryFormat::varint); }
+BENCHMARK(BinaryMemoryWriteClass10Schema) { BinaryMemoryWrite(state, GetObjects10(), BinaryFormat::schemaTable); }
+BENCHMARK(BinaryMemoryReadClass10Fixed) { BinaryMemoryRead(state, GetObjects10(), BinaryFormat::fixed); }
+BENCHMARK(BinaryMemoryReadClass10VarInt) { BinaryMemoryRead(state, GetObjects10(), BinaryFormat::varint); }
+BENCHMARK(BinaryMemoryReadClass10Schema) { BinaryMemoryRead(state, GetObjects10(), BinaryFormat::schemaTable); }
+BENCHMARK(BinaryMemoryWriteClass100Fixed) { BinaryMemoryWrite(state, GetObjects100(), BinaryFormat::fixed); }
+BENCHMARK(BinaryMemoryWriteClass100VarInt) { BinaryMemoryWrite(state, GetObjects100(), BinaryFormat::varint); }
+BENCHMARK(BinaryMemoryWriteClass100Schema) { BinaryMemoryWrite(state, GetObjects100(), BinaryFormat::schemaTable); }
+BENCHMARK(BinaryMemoryReadClass100Fixed) { BinaryMemoryRead(state, GetObjects100(), BinaryFormat::fixed); }
+BENCHMARK(BinaryMemoryReadClass100VarInt) { BinaryMemoryRead(state, GetObjects100(), BinaryFormat::varint); }
+BENCHMARK(BinaryMemoryReadClass100Schema) { BinaryMemoryRead(state, GetObjects100(), BinaryFormat::schemaTable); }
+
+BENCHMARK(BinaryFileWriteClass100Fixed) { BinaryFileWrite(state, GetObjects100(), BinaryFormat::fixed); }
+BENCHMARK(BinaryFileWriteClass100Schema) { BinaryFileWrite(state, GetObjects100(), BinaryFormat::schemaTable); }
+BENCHMARK(MappedFileReadClass100Fixed) { MappedFileRead(state, GetObjects100(), BinaryFormat::fixed); }
+BENCHMARK(MappedFileReadClass100Schema) { MappedFileRead(state, GetObjects100(), BinaryFormat::schemaTable); }
+
+BENCHMARK(JsonDomWriteClass10) { JsonDomWrite(state, GetObjects10()); }
+BENCHMARK(JsonDomReadClass10) { JsonDomRead(state, GetObjects10()); }
+BENCHMARK(JsonStreamWriteClass10) { JsonStreamWrite(state, GetObjects10()); }
+BENCHMARK(JsonStreamReadClass10) { JsonStreamRead(state, GetObjects10()); }
+BENCHMARK(JsonDomWriteClass100) { JsonDomWrite(state, GetObjects100()); }
+BENCHMARK(JsonDomReadClass100) { JsonDomRead(state, GetObjects100()); }
+BENCHMARK(JsonStreamWriteClass100) { JsonStreamWrite(state, GetObjects100()); }
+BENCHMARK(JsonStreamReadClass100) { JsonStreamRead(state, GetObjects100()); }
+
+BENCHMARK(ObjectDiffClass100Unchanged) { ObjectDiff(state, GetObjects100()[0], GetObjects100()[0]); }
+BENCHMARK(ObjectDiffClass100Changed) { ObjectDiff(state, GetObjects100()[0], GetObjects100()[1]); }
+BENCHMARK(ObjectPatchApplyClass100) { ObjectPatchApply(state, GetObjects100()[0], GetObjects100()[1]); }
@@ -0,0 +1,130 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+#include <Mirror/Meta.h>
+
+struct EClass() SerializationBenchmarkStruct10 {
+    EClassBody(SerializationBenchmarkStruct10)
+
+    EProperty() int32_t m0 = 0;
+    EProperty() float m1 = 0.0f;
+    EProperty() std::string m2;
+    EProperty() uint64_t m3 = 0;
+    EProperty() double m4 = 0.0;
+    EProperty() int32_t m5 = 0;
+    EProperty() float m6 = 0.0f;
+    EProperty() std::string m7;
+    EProperty() uint64_t m8 = 0;
+    EProperty() double m9 = 0.0;
+};
+
+struct EClass() SerializationBenchmarkStruct100 {
+    EClassBody(SerializationBenchmarkStruct100)
+
+    EProperty() int32_t m0 = 0;
+    EProperty() float m1 = 0.0f;
+    EProperty() std::string m2;
+    EProperty() uint64_t m3 = 0;
+    EProperty() double m4 = 0.0;
+    EProperty() int32_t m5 = 0;
+    EProperty() float m6 = 0.0f;
+    EProperty() std::string m7;
+    EProperty() uint64_t m8 = 0;
+    EProperty() double m9 = 0.0;
+    EProperty() int32_t m10 = 0;
+    EProperty() float m11 = 0.0f;
+    EProperty() std::string m12;
+    EProperty() uint64_t m13 = 0;
+    EProperty() double m14 = 0.0;
+    EProperty() int32_t m15 = 0;
+    EProperty() float m16 = 0.0f;
+    EProperty() std::string m17;
+    EProperty() uint64_t m18 = 0;
+    EProperty() double m19 = 0.0;
+    EProperty() int32_t m20 = 0;
+    EProperty() float m21 = 0.0f;
+    EProperty() std::string m22;
+    EProperty() uint64_t m23 = 0;
+    EProperty() double m24 = 0.0;
+    EProperty() int32_t m25 = 0;
+    EProperty() float m26 = 0.0f;
+    EProperty() std::string m27;
+    EProperty() uint64_t m28 = 0;
+    EProperty() double m29 = 0.0;
+    EProperty() int32_t m30 = 0;
+    EProperty() float m31 = 0.0f;
+    EProperty() std::string m32;
+    EProperty() uint64_t m33 = 0;
+    EProperty() double m34 = 0.0;
+    EProperty() int32_t m35 = 0;
+    EProperty() float m36 = 0.0f;
+    EProperty() std::string m37;
+    EProperty() uint64_t m38 = 0;
+    EProperty() double m39 = 0.0;
+    EProperty() int32_t m40 = 0;
+    EProperty() float m41 = 0.0f;
+    EProperty() std::string m42;
+    EProperty() uint64_t m43 = 0;
+    EProperty() double m44 = 0.0;
+    EProperty() int32_t m45 = 0;
+    EProperty() float m46 = 0.0f;
+    EProperty() std::string m47;
+    EProperty() uint64_t m48 = 0;
+    EProperty() double m49 = 0.0;
+    EProperty() int32_t m50 = 0;
+    EProperty() float m51 = 0.0f;
+    EProperty() std::string m52;
+    EProperty() uint64_t m53 = 0;
+    EProperty() double m54 = 0.0;
+    EProperty() int32_t m55 = 0;
+    EProperty() float m56 = 0.0f;
+    EProperty() std::string m57;
+    EProperty() uint64_t m58 = 0;
+    EProperty() double m59 = 0.0;
+    EProperty() int32_t m60 = 0;
+    EProperty() float m61 = 0.0f;
+    EProperty() std::string m62;
+    EProperty() uint64_t m63 = 0;
+    EProperty() double m64 = 0.0;
+    EProperty() int32_t m65 = 0;
+    EProperty() float m66 = 0.0f;
+    EProperty() std::string m67;
+    EProperty() uint64_t m68 = 0;
+    EProperty() double m69 = 0.0;
+    EProperty() int32_t m70 = 0;
+    EProperty() float m71 = 0.0f;
+    EProperty() std::string m72;
+    EProperty() uint64_t m73 = 0;
+    EProperty() double m74 = 0.0;
+    EProperty() int32_t m75 = 0;
+    EProperty() float m76 = 0.0f;
+    EProperty() std::string m77;
+    EProperty() uint64_t m78 = 0;
+    EProperty() double m79 = 0.0;
+    EProperty() int32_t m80 = 0;
+    EProperty() float m81 = 0.0f;
+    EProperty() std::string m82;
+    EProperty() uint64_t m83 = 0;
+    EProperty() double m84 = 0.0;
+    EProperty() int32_t m85 = 0;
+    EProperty() float m86 = 0.0f;
+    EProperty() std::string m87;
+    EProperty() uint64_t m88 = 0;
+    EProperty() double m89 = 0.0;
+    EProperty() int32_t m90 = 0;
+    EProperty() float m91 = 0.0f;
+    EProperty() std::string m92;
+    EProperty() uint64_t m93 = 0;
+    EProperty() double m94 = 0.0;
+    EProperty() int32_t m95 = 0;
+    EProperty() float m96 = 0.0f;
+    EProperty() std::string m97;
+    EProperty() uint64_t m98 = 0;
+    EProperty() double m99 = 0.0;
+};
@@ -9,12 +9,15 @@
 #include <unordered_map>
 #include <optional>
 #include <cstdint>
+#include <cstddef>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
 #include <functional>
 #include <ranges>
 #include <variant>
+#include <span>
+#include <atomic>
 
 #include <Common/Serialization.h>
 #include <Common/Debug.h>
@@ -23,6 +26,11 @@
 #include <Common/Concepts.h>
 #include <Mirror/Api.h>
 
+// inline capacity in bytes of Mirror::Any, values up to it are held without heap allocation, configured by cmake cache variable of same name
+#ifndef MIRROR_ANY_INLINE_CAPACITY
+#define MIRROR_ANY_INLINE_CAPACITY 64
+#endif
+
 #if COMPILER_MSVC
 #define functionSignature __FUNCSIG__
 #else
@@ -31,8 +39,10 @@
 
 namespace Mirror {
     using TypeId = uint64_t;
+    using ClassIndex = uint32_t;
 
     constexpr TypeId typeIdNull = 0;
+    constexpr ClassIndex classIndexNull = UINT32_MAX;
 }
 
 namespace Mirror {
@@ -103,6 +113,8 @@ namespace Mirror {
         using DeserializeFunc = std::pair<bool, size_t>(void*, Common::BinaryDeserializeStream&);
         using JsonSerializeFunc = void(const void*, rapidjson::Value&, rapidjson::Document::AllocatorType&);
         using JsonDeserializeFunc = void(void*, const rapidjson::Value&);
+        using JsonWriteFunc = void(const void*, Common::JsonWriter&);
+        using JsonReadFunc = void(void*, Common::JsonReader&);
         using ToStringFunc = std::string(const void*);
         using GetTemplateViewRttiFunc = std::pair<TemplateViewId, TemplateViewRttiPtr>();
 
@@ -126,6 +138,8 @@ namespace Mirror {
         template <typename T> static std::pair<bool, size_t> Deserialize(void* inThis, Common::BinaryDeserializeStream& inStream);
         template <typename T> static void JsonSerialize(const void* inThis, rapidjson::Value& outJsonValue, rapidjson::Document::AllocatorType& inAllocator);
         template <typename T> static void JsonDeserialize(void* inThis, const rapidjson::Value& inJsonValue);
+        template <typename T> static void JsonWrite(const void* inThis, Common::JsonWriter& inWriter);
+        template <typename T> static void JsonRead(void* inThis, Common::JsonReader& inReader);
         template <typename T> static std::string ToString(const void* inThis);
         template <typename T> static std::pair<TemplateViewId, TemplateViewRttiPtr> GetTemplateViewRtti();
 
@@ -149,6 +163,8 @@ namespace Mirror {
         DeserializeFunc* deserialize;
         JsonSerializeFunc* jsonSerialize;
         JsonDeserializeFunc* jsonDeserialize;
+        JsonWriteFunc* jsonWrite;
+        JsonReadFunc* jsonRead;
         ToStringFunc* toString;
         GetTemplateViewRttiFunc* getTemplateViewRtti;
     };
@@ -175,6 +191,8 @@ namespace Mirror {
         &AnyRtti::Deserialize<T>,
         &AnyRtti::JsonSerialize<T>,
         &AnyRtti::JsonDeserialize<T>,
+        &AnyRtti::JsonWrite<T>,
+        &AnyRtti::JsonRead<T>,
         &AnyRtti::ToString<T>,
         &AnyRtti::GetTemplateViewRtti<T>
     };
@@ -288,6 +306,9 @@ namespace Mirror {
         void JsonSerialize(rapidjson::Value& outJsonValue, rapidjson::Document::AllocatorType& inAllocator) const;
         void JsonDeserialize(const rapidjson::Value& inJsonValue);
         void JsonDeserialize(const rapidjson::Value& inJsonValue) const;
+        void JsonWrite(Common::JsonWriter& inWriter) const;
+        void JsonRead(Common::JsonReader& inReader);
+        void JsonRead(Common::JsonReader& inReader) const;
         std::string ToString() const;
         void* Data(uint32_t inIndex = 0) const;
         size_t MemorySize() const;
@@ -298,22 +319,31 @@ namespace Mirror {
         bool operator!=(const Any& inAny) const;
 
     private:
+        // raw memory of held value, inline up to InlineCapacity, larger memory is allocated from small object allocator,
+        // copy and move only transfer bytes, elements are constructed and destructed by Any through rtti
         class MIRROR_API HolderInfo {
         public:
+            static constexpr size_t InlineCapacity = MIRROR_ANY_INLINE_CAPACITY;
+            static constexpr size_t MaxAlignment = alignof(std::max_align_t);
+
             HolderInfo();
             explicit HolderInfo(size_t inMemorySize);
+            HolderInfo(const HolderInfo& inOther);
+            HolderInfo(HolderInfo&& inOther) noexcept;
+            HolderInfo& operator=(const HolderInfo& inOther);
+            HolderInfo& operator=(HolderInfo&& inOther) noexcept;
+            ~HolderInfo();
 
             void ResizeMemory(size_t inSize);
             void* Ptr() const;
             size_t Size() const;
 
         private:
-            static constexpr size_t MaxStackMemorySize = sizeof(std::vector<uint8_t>) - sizeof(size_t);
-            using InplaceMemory = Common::InplaceVector<uint8_t, MaxStackMemorySize>;
-            using HeapMemory = std::vector<uint8_t>;
-            static_assert(sizeof(InplaceMemory) == sizeof(HeapMemory));
+            void ReleaseMemory();
 
-            std::variant<InplaceMemory, HeapMemory> memory;
+            size_t memorySize;
+            uint8_t* heapMemory;
+            alignas(MaxAlignment) uint8_t inlineMemory[InlineCapacity];
         };
 
         class MIRROR_API RefInfo {
@@ -378,6 +408,7 @@ namespace Mirror {
         const TypeInfo* RemoveRefType() const;
         const TypeInfo* AddPointerType() const;
         const TypeInfo* RemovePointerType() const;
+        void* Data() const;
 
     private:
         template <typename F> decltype(auto) Delegate(F&& inFunc) const;
@@ -386,10 +417,13 @@ namespace Mirror {
     };
 
     using ArgumentList = std::vector<Argument>;
+    // non-owning view of arguments, lets fixed arity calls pack arguments on stack instead of a heap ArgumentList
+    using ArgumentSpan = std::span<const Argument>;
 
     template <typename T> Any ForwardAsAny(T&& value);
     template <typename T> Argument ForwardAsArg(T&& value);
     template <typename... Args> ArgumentList ForwardAsArgList(Args&&... args);
+    template <typename... Args> std::array<Argument, sizeof...(Args)> ForwardAsArgArray(Args&&... args);
     template <typename T> Any ForwardAsAnyByValue(T&& value);
     template <typename T> Argument ForwardAsArgByValue(T&& value);
     template <typename... Args> ArgumentList ForwardAsArgListByValue(Args&&... args);
@@ -472,8 +506,8 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Setter = std::function<void(const Argument&)>;
-        using Getter = std::function<Any()>;
+        using Setter = void(*)(const Argument&);
+        using Getter = Any(*)();
 
         struct ConstructParams {
             Id id;
@@ -516,7 +550,7 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Invoker = std::function<Any(const ArgumentList&)>;
+        using Invoker = Any(*)(ArgumentSpan);
 
         struct ConstructParams {
             Id id;
@@ -544,7 +578,7 @@ namespace Mirror {
 
         template <typename... Args> Any Construct(Args&&... args) const;
         template <typename... Args> Any New(Args&&... args) const;
-        template <typename... Args> Any InplaceNew(Args&&... args) const;
+        template <typename... Args> Any InplaceNew(void* ptr, Args&&... args) const;
 
         const std::string& GetOwnerName() const;
         const Id& GetOwnerId() const;
@@ -567,8 +601,8 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Invoker = std::function<Any(const ArgumentList&)>;
-        using InplaceInvoker = std::function<Any(void*, const ArgumentList&)>;
+        using Invoker = Any(*)(ArgumentSpan);
+        using InplaceInvoker = Any(*)(void*, ArgumentSpan);
 
         struct ConstructParams {
             Id id;
@@ -615,7 +649,7 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Invoker = std::function<void(const Argument&)>;
+        using Invoker = void(*)(const Argument&);
 
         struct ConstructParams {
             Id owner;
@@ -648,20 +682,25 @@ namespace Mirror {
         void SetDyn(const Argument& object, const Argument& value) const;
         Any GetDyn(const Argument& object) const;
         bool IsTransient() const;
+        bool IsMemoryComparable() const;
 
     private:
         friend class Class;
+        friend class ObjectPatch;
         template <typename C> friend class ClassRegistry;
 
-        using Setter = std::function<void(const Argument&, const Argument&)>;
-        using Getter = std::function<Any(const Argument&)>;
+        using Setter = void(*)(const Argument&, const Argument&);
+        using Getter = Any(*)(const Argument&);
 
         struct ConstructParams {
             Id id;
             Id owner;
             FieldAccess access;
             size_t memorySize;
+            size_t offset;
+            bool memoryComparable;
             const TypeInfo* typeInfo;
+            const AnyRtti* rtti;
             Setter setter;
             Getter getter;
         };
@@ -671,7 +710,11 @@ namespace Mirror {
         Id owner;
         FieldAccess access;
         size_t memorySize;
+        // byte offset in owner class and whether memcmp/memcpy on it equals compare/assign of value, used by ObjectPatch
+        size_t offset;
+        bool memoryComparable;
         const TypeInfo* typeInfo;
+        const AnyRtti* rtti;
         Setter setter;
         Getter getter;
     };
@@ -696,7 +739,7 @@ namespace Mirror {
         friend class Class;
         template <typename C> friend class ClassRegistry;
 
-        using Invoker = std::function<Any(const Argument&, const ArgumentList&)>;
+        using Invoker = Any(*)(const Argument&, ArgumentSpan);
 
         struct ConstructParams {
             Id id;
@@ -766,6 +809,8 @@ namespace Mirror {
         static bool Has(TypeId typeId);
         static const Class* Find(TypeId typeId);
         static const Class& Get(TypeId typeId);
+        static const Class* FindByIndex(ClassIndex inIndex);
+        static const Class& GetByIndex(ClassIndex inIndex);
         static std::vector<const Class*> GetAll();
         static std::vector<const Class*> FindWithCategory(const std::string& category);
 
@@ -783,9 +828,12 @@ namespace Mirror {
         void ForEachMemberVariable(const MemberVariableTraverser& func) const;
         void ForEachMemberFunction(const MemberFunctionTraverser& func) const;
         const TypeInfo* GetTypeInfo() const;
+        ClassIndex GetIndex() const;
         size_t SizeOf() const;
         bool HasDefaultConstructor() const;
         const Class* GetBaseClass() const;
+        // byte offset of base class subobject in this class, base class member variable offsets are relative to it
+        size_t GetBaseClassOffset() const;
         bool IsBaseOf(const Class* derivedClass) const;
         bool IsDerivedFrom(const Class* baseClass) const;
         const Constructor* FindDefaultConstructor() const;
@@ -794,7 +842,7 @@ namespace Mirror {
         const Destructor* FindDestructor() const;
         const Destructor& GetDestructor() const;
         bool HasConstructor(const Id& inId) const;
-        const Constructor* FindSuitableConstructor(const ArgumentList& arguments) const;
+        const Constructor* FindSuitableConstructor(ArgumentSpan arguments) const;
         const Constructor* FindConstructor(const Id& inId) const;
         const Constructor& GetConstructor(const Id& inId) const;
         bool HasStaticVariable(const Id& inId) const;
@@ -819,7 +867,9 @@ namespace Mirror {
         void DeleteDyn(const Argument& argument) const;
 
     private:
-        static std::unordered_map<TypeId, Id> typeToIdMap;
+        // dense index is assigned at first registration of a type and kept across unload, so cached indices never dangle
+        static Common::FlatHashMap<TypeId, ClassIndex> typeToIndexMap;
+        static std::vector<const Class*> indexedClasses;
 
         friend class Registry;
         template <typename T> friend class ClassRegistry;
@@ -830,7 +880,9 @@ namespace Mirror {
         struct ConstructParams {
             Id id;
             const TypeInfo* typeInfo;
+            ClassIndex index;
             size_t memorySize;
+            size_t baseClassOffset;
             BaseClassGetter baseClassGetter;
             InplaceGetter inplaceGetter;
             std::function<Any()> defaultObjectCreator;
@@ -851,7 +903,9 @@ namespace Mirror {
         MemberFunction& EmplaceMemberFunction(const Id& inId, MemberFunction::ConstructParams&& inParams);
 
         const TypeInfo* typeInfo;
+        ClassIndex index;
         size_t memorySize;
+        size_t baseClassOffset;
         BaseClassGetter baseClassGetter;
         InplaceGetter inplaceGetter;
         Any defaultObject;
@@ -938,7 +992,7 @@ namespace Mirror {
         std::vector<const EnumValue*> GetSortedValues() const;
 
     private:
-        static std::unordered_map<TypeId, Id> typeToIdMap;
+        static Common::FlatHashMap<TypeId, Id> typeToIdMap;
 
         friend class Registry;
         template <typename T> friend class EnumRegistry;
@@ -1610,6 +1664,12 @@ namespace Mirror {
 }
 
 namespace Mirror::Internal {
+    // filled by first lookup of each class type, later Class::Find<C>() is a single indexed load
+    template <typename C>
+    struct ClassIndexCache {
+        static inline std::atomic<ClassIndex> value = classIndexNull;
+    };
+
     template <typename T>
     void StaticCheckArgumentType()
     {
@@ -1637,6 +1697,63 @@ namespace Mirror::Internal {
             inVisitor(std::ref(std::get<I>(tuple)));
         }(), 0)... };
     }
+
+    // meta pointers except class, enum and destructor are represented as [ownerName, name] in json
+    inline void JsonWriteNamePair(Common::JsonWriter& inWriter, const std::string& inOwnerName, const std::string& inName)
+    {
+        inWriter.StartArray();
+        inWriter.String(inOwnerName);
+        inWriter.String(inName);
+        inWriter.EndArray();
+    }
+
+    // false when json value is not an array with two elements
+    inline bool JsonReadNamePair(Common::JsonReader& inReader, std::string& outOwnerName, std::string& outName)
+    {
+        if (!inReader.StartArray()) {
+            return false;
+        }
+        size_t count = 0;
+        while (inReader.NextElement()) {
+            if (count == 0) {
+                Common::JsonRead(inReader, outOwnerName);
+            } else if (count == 1) {
+                Common::JsonRead(inReader, outName);
+            } else {
+                inReader.Skip();
+            }
+            count++;
+        }
+        return count == 2;
+    }
+
+    // schema of a class lists its non transient member variables, in the order they are serialized
+    inline uint32_t FindOrAddSchema(Common::SerializeSchemaTable& inTable, const Class& inClass)
+    {
+        return inTable.FindOrAdd(inClass.GetName(), [&]() -> Common::SerializeSchemaTable::Schema {
+            Common::SerializeSchemaTable::Schema schema;
+            schema.name = inClass.GetName();
+            for (const auto& memberVariable : inClass.GetMemberVariables() | std::views::values) {
+                if (!memberVariable.IsTransient()) {
+                    schema.fieldNames.emplace_back(memberVariable.GetName());
+                }
+            }
+            return schema;
+        });
+    }
+
+    // member variables matching schema fields, nullptr for fields no longer present in inClass
+    inline const std::vector<const void*>& ResolveSchema(const Common::SerializeSchemaTable::Schema& inSchema, const Class& inClass)
+    {
+        if (inSchema.resolvedFields.size() != inSchema.fieldNames.size()) {
+            inSchema.resolvedFields.clear();
+            inSchema.resolvedFields.reserve(inSchema.fieldNames.size());
+            for (const auto& fieldName : inSchema.fieldNames) {
+                inSchema.resolvedFields.emplace_back(inClass.FindMemberVariable(fieldName));
+            }
+        }
+        return inSchema.resolvedFields;
+    }
 }
 
 namespace Common { // NOLINT
@@ -1644,42 +1761,61 @@ namespace Common { // NOLINT
     struct Serializer<T> {
         static constexpr size_t typeId = HashUtils::StrCrc32("_MetaObject");
 
-        // struct
-        // std::string className                  : classNameSize
-        // size_t baseContentSize                 : sizeof(size_t)
+        // struct, sizes are uint64_t and follow integer encoding of stream
+        // std::string className                  : classHeaderSize
+        // size_t baseContentSize                 : baseContentSizeSize
         // void* baseContent                      : baseContentSize
-        // size_t memberVariableCount             : sizeof(size_t)
-        // size_t[] memberVariableContentEnds     : sizeof(size_t) * memberVariableCount
+        // size_t memberVariableCount             : memberVariableCountSize
+        // size_t[] memberVariableContentEnds     : memberVariableContentEndsSize
         // void*[] memberVariableContent          : memberVariablesContentSize
         //     |- std::string memberVariableName  : memberVariableNameSize
         //     |- bool sameAsDefaultObject        : sizeof(bool)
         //     |- void* memberVariableContent     : memberVariableEnd - memberVariableLastEnd
+        // when stream has a schema table, className is replaced by uint32_t schemaIndex, memberVariableCount and
+        // memberVariableName are omitted since they are recorded by schema
 
         static size_t SerializeDyn(BinarySerializeStream& stream, const Mirror::Class& clazz, const Mirror::Argument& obj)
+        {
+            return SerializeFramed(stream, [&](BinarySerializeStream& framedStream) -> size_t {
+                return SerializeDynInternal(framedStream, clazz, obj);
+            });
+        }
+
+        static size_t SerializeDynInternal(BinarySerializeStream& stream, const Mirror::Class& clazz, const Mirror::Argument& obj)
         {
             const auto& className = clazz.GetName();
             const auto* baseClass = clazz.GetBaseClass();
             const auto& memberVariables = clazz.GetMemberVariables();
             const auto defaultObject = clazz.GetDefaultObject();
 
-            const auto classNameSize = Serializer<std::string>::Serialize(stream, className);
+            auto* schemaTable = stream.SchemaTable();
+            const auto classHeaderSize = schemaTable != nullptr
+                ? Serializer<uint32_t>::Serialize(stream, Mirror::Internal::FindOrAddSchema(*schemaTable, clazz))
+                : Serializer<std::string>::Serialize(stream, className);
 
             uint64_t baseClassContentSize = 0;
-            stream.Seek(sizeof(uint64_t));
-            if (baseClass != nullptr) {
-                baseClassContentSize = SerializeDyn(stream, *baseClass, obj);
+            size_t baseClassContentSizeSize = 0;
+            {
+                FrameSizeSlots baseClassContentSizeSlot(stream, 1);
+                if (baseClass != nullptr) {
+                    baseClassContentSize = SerializeDynInternal(stream, *baseClass, obj);
+                }
+                baseClassContentSizeSlot.Set(0, baseClassContentSize);
+                baseClassContentSizeSlot.Commit(baseClassContentSize);
+                baseClassContentSizeSize = baseClassContentSizeSlot.SlotsSize();
             }
 
-            stream.Seek(-static_cast<int64_t>(baseClassContentSize) - static_cast<int64_t>(sizeof(uint64_t)));
-            Serializer<uint64_t>::Serialize(stream, baseClassContentSize);
-            stream.Seek(static_cast<int64_t>(baseClassContentSize));
-
-            const uint64_t memberVariableCount = memberVariables.size();
-            std::vector<uint64_t> memberVariableContentEnds;
-            memberVariableContentEnds.reserve(memberVariableCount);
+            uint64_t memberVariableCount = 0;
+            for (const auto& memberVariable : memberVariables | std::views::values) {
+                if (!memberVariable.IsTransient()) {
+                    memberVariableCount++;
+                }
+            }
+            const auto memberVariableCountSize = schemaTable != nullptr ? 0 : Serializer<uint64_t>::Serialize(stream, memberVariableCount);
 
-            stream.Seek(static_cast<int64_t>(sizeof(uint64_t) * (memberVariableCount + 1)));
+            FrameSizeSlots memberVariableContentEnds(stream, memberVariableCount);
             uint64_t memberVariableContentSize = 0;
+            size_t memberVariableIndex = 0;
             for (const auto& memberVariable : memberVariables | std::views::values) {
                 if (memberVariable.IsTransient()) {
                     continue;
@@ -1689,21 +1825,17 @@ namespace Common { // NOLINT
                     ? false
                     : memberVariable.GetDyn(obj) == memberVariable.GetDyn(defaultObject);
 
-                memberVariableContentSize += Serializer<std::string>::Serialize(stream, memberVariable.GetName());
+                if (schemaTable == nullptr) {
+                    memberVariableContentSize += Serializer<std::string>::Serialize(stream, memberVariable.GetName());
+                }
                 memberVariableContentSize += Serializer<bool>::Serialize(stream, sameAsDefaultObject);
                 if (!sameAsDefaultObject) {
                     memberVariableContentSize += memberVariable.GetDyn(obj).Serialize(stream);
                 }
-                memberVariableContentEnds.emplace_back(memberVariableContentSize);
+                memberVariableContentEnds.Set(memberVariableIndex++, memberVariableContentSize);
             }
-
-            stream.Seek(-static_cast<int64_t>(memberVariableContentSize) - static_cast<int64_t>(sizeof(uint64_t) * (memberVariableCount + 1)));
-            Serializer<uint64_t>::Serialize(stream, memberVariableCount);
-            for (const auto& end : memberVariableContentEnds) {
-                Serializer<uint64_t>::Serialize(stream, end);
-            }
-            stream.Seek(static_cast<int64_t>(memberVariableContentSize));
-            return classNameSize + baseClassContentSize + sizeof(uint64_t) * (memberVariableCount + 2) + memberVariableContentSize; // NOLINT
+            memberVariableContentEnds.Commit(memberVariableContentSize);
+            return classHeaderSize + baseClassContentSizeSize + baseClassContentSize + memberVariableCountSize + memberVariableContentEnds.SlotsSize() + memberVariableContentSize;
         }
 
         static size_t DeserializeDyn(BinaryDeserializeStream& stream, const Mirror::Class& clazz, const Mirror::Argument& obj)
@@ -1712,39 +1844,65 @@ namespace Common { // NOLINT
             const auto* baseClass = clazz.GetBaseClass();
             const auto defaultObject = clazz.GetDefaultObject();
 
-            std::string name;
-            const auto nameSize = Serializer<std::string>::Deserialize(stream, name);
-            if (name != className) {
-                return nameSize;
+            const auto* schemaTable = stream.SchemaTable();
+            const Common::SerializeSchemaTable::Schema* schema = nullptr;
+            size_t classHeaderSize = 0;
+            if (schemaTable != nullptr) {
+                uint32_t schemaIndex = 0;
+                classHeaderSize = Serializer<uint32_t>::Deserialize(stream, schemaIndex);
+                schema = schemaTable->Find(schemaIndex);
+                if (schema == nullptr || schema->name != className) {
+                    return classHeaderSize;
+                }
+            } else {
+                std::string name;
+                classHeaderSize = Serializer<std::string>::Deserialize(stream, name);
+                if (name != className) {
+                    return classHeaderSize;
+                }
             }
 
             uint64_t aspectBaseClassContentSize = 0;
-            Serializer<uint64_t>::Deserialize(stream, aspectBaseClassContentSize);
+            const auto baseClassContentSizeSize = Serializer<uint64_t>::Deserialize(stream, aspectBaseClassContentSize);
             if (aspectBaseClassContentSize != 0 && baseClass != nullptr) {
                 const auto actualBaseClassContentSize = DeserializeDyn(stream, *baseClass, obj);
                 stream.Seek(static_cast<int64_t>(aspectBaseClassContentSize) - static_cast<int64_t>(actualBaseClassContentSize));
             }
 
             uint64_t memberVariableCount = 0;
-            Serializer<uint64_t>::Deserialize(stream, memberVariableCount);
+            size_t memberVariableCountSize = 0;
+            if (schema != nullptr) {
+                memberVariableCount = schema->fieldNames.size();
+            } else {
+                memberVariableCountSize = Serializer<uint64_t>::Deserialize(stream, memberVariableCount);
+            }
 
             std::vector<uint64_t> memberVariableEnds;
             memberVariableEnds.resize(memberVariableCount);
+            size_t memberVariableContentEndsSize = 0;
             for (auto& offset : memberVariableEnds) {
-                Serializer<uint64_t>::Deserialize(stream, offset);
+                memberVariableContentEndsSize += Serializer<uint64_t>::Deserialize(stream, offset);
             }
 
+            const auto* resolvedMemberVariables = schema != nullptr ? &Mirror::Internal::ResolveSchema(*schema, clazz) : nullptr;
             uint64_t memberVariableContentCur = 0;
-            for (const auto& end : memberVariableEnds) {
-                std::string memberVariableName;
-                memberVariableContentCur += Serializer<std::string>::Deserialize(stream, memberVariableName);
+            for (auto i = 0; i < memberVariableEnds.size(); i++) {
+                const auto end = memberVariableEnds[i];
+                const Mirror::MemberVariable* memberVariablePtr;
+                if (resolvedMemberVariables != nullptr) {
+                    memberVariablePtr = static_cast<const Mirror::MemberVariable*>((*resolvedMemberVariables)[i]);
+                } else {
+                    std::string memberVariableName;
+                    memberVariableContentCur += Serializer<std::string>::Deserialize(stream, memberVariableName);
+                    memberVariablePtr = clazz.FindMemberVariable(memberVariableName);
+                }
 
-                if (!clazz.HasMemberVariable(memberVariableName)) {
+                if (memberVariablePtr == nullptr) {
                     stream.Seek(static_cast<int64_t>(end) - static_cast<int64_t>(memberVariableContentCur));
                     memberVariableContentCur = end;
                     continue;
                 }
-                const auto& memberVariable = clazz.GetMemberVariable(memberVariableName);
+                const auto& memberVariable = *memberVariablePtr;
 
                 bool sameAsDefaultObject = false;
                 memberVariableContentCur += Serializer<bool>::Deserialize(stream, sameAsDefaultObject);
@@ -1759,7 +1917,7 @@ namespace Common { // NOLINT
                 stream.Seek(static_cast<int64_t>(end) - static_cast<int64_t>(memberVariableContentCur));
                 memberVariableContentCur = end;
             }
-            return nameSize + aspectBaseClassContentSize + sizeof(uint64_t) * (memberVariableCount + 2) + memberVariableContentCur;
+            return classHeaderSize + baseClassContentSizeSize + aspectBaseClassContentSize + memberVariableCountSize + memberVariableContentEndsSize + memberVariableContentCur;
         }
 
         static size_t Serialize(BinarySerializeStream& stream, const T& value)
@@ -2174,6 +2332,82 @@ namespace Common { // NOLINT
         {
             JsonDeserializeDyn(inValue, Mirror::Class::Get<T>(), Mirror::ForwardAsArg(outValue));
         }
+
+        static void JsonWriteDyn(JsonWriter& inWriter, const Mirror::Class& clazz, const Mirror::Argument& inObj)
+        {
+            const auto* baseClass = clazz.GetBaseClass();
+            const auto defaultObject = clazz.GetDefaultObject();
+
+            inWriter.StartObject();
+            if (baseClass != nullptr) {
+                inWriter.Key("_base");
+                JsonWriteDyn(inWriter, *baseClass, inObj);
+            }
+
+            for (const auto& memberVariable : clazz.GetMemberVariables() | std::views::values) {
+                if (memberVariable.IsTransient()) {
+                    continue;
+                }
+
+                bool sameAsDefault = defaultObject.Empty() || !memberVariable.GetTypeInfo()->equalComparable
+                    ? false
+                    : memberVariable.GetDyn(inObj) == memberVariable.GetDyn(defaultObject);
+
+                if (sameAsDefault) {
+                    continue;
+                }
+                inWriter.Key(memberVariable.GetName());
+                memberVariable.GetDyn(inObj).JsonWrite(inWriter);
+            }
+            inWriter.EndObject();
+        }
+
+        static void JsonReadDyn(JsonReader& inReader, const Mirror::Class& clazz, const Mirror::Argument& outObj)
+        {
+            const auto* baseClass = clazz.GetBaseClass();
+            const auto defaultObject = clazz.GetDefaultObject();
+
+            if (!inReader.StartObject()) {
+                return;
+            }
+
+            // members are visited in json order, remember them so that absent ones can be reset to default later
+            std::vector<const Mirror::MemberVariable*> readMembers;
+            std::string_view key;
+            while (inReader.NextKey(key)) {
+                if (baseClass != nullptr && key == "_base") {
+                    JsonReadDyn(inReader, *baseClass, outObj);
+                    continue;
+                }
+
+                const auto* memberVariable = clazz.FindMemberVariable(std::string(key));
+                if (memberVariable == nullptr) {
+                    inReader.Skip();
+                    continue;
+                }
+                memberVariable->GetDyn(outObj).JsonRead(inReader);
+                readMembers.emplace_back(memberVariable);
+            }
+
+            if (defaultObject.Empty()) {
+                return;
+            }
+            for (const auto& memberVariable : clazz.GetMemberVariables() | std::views::values) {
+                if (std::ranges::find(readMembers, &memberVariable) == readMembers.end()) {
+                    memberVariable.SetDyn(outObj, memberVariable.GetDyn(defaultObject));
+                }
+            }
+        }
+
+        static void JsonWrite(JsonWriter& inWriter, const T& inValue)
+        {
+            JsonWriteDyn(inWriter, Mirror::Class::Get<T>(), Mirror::ForwardAsArg(inValue));
+        }
+
+        static void JsonRead(JsonReader& inReader, T& outValue)
+        {
+            JsonReadDyn(inReader, Mirror::Class::Get<T>(), Mirror::ForwardAsArg(outValue));
+        }
     };
 
     template <CppEnum E>
@@ -2227,6 +2461,43 @@ namespace Common { // NOLINT
                 outValue = static_cast<E>(unlderlyingValue);
             }
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const E& inValue)
+        {
+            if (const Mirror::Enum* metaEnum = Mirror::Enum::Find<E>();
+                metaEnum == nullptr) {
+                JsonSerializer<std::underlying_type_t<E>>::JsonWrite(inWriter, static_cast<std::underlying_type_t<E>>(inValue));
+            } else {
+                Mirror::Internal::JsonWriteNamePair(inWriter, metaEnum->GetName(), metaEnum->GetValue(inValue).GetName());
+            }
+        }
+
+        static void JsonRead(JsonReader& inReader, E& outValue)
+        {
+            if (inReader.Peek() == JsonTokenType::startArray) {
+                std::string metaEnumName;
+                std::string metaEnumValueName;
+                if (!Mirror::Internal::JsonReadNamePair(inReader, metaEnumName, metaEnumValueName)) {
+                    return;
+                }
+
+                const Mirror::Enum* aspectMetaEnum = Mirror::Enum::Find(metaEnumName);
+                const Mirror::Enum* metaEnum = Mirror::Enum::Find<E>();
+                if (aspectMetaEnum != metaEnum || metaEnum == nullptr) {
+                    return;
+                }
+
+                const auto* metaEnumValue = metaEnum->FindValue(metaEnumValueName);
+                if (metaEnumValue == nullptr) {
+                    return;
+                }
+                metaEnumValue->Set(outValue);
+            } else {
+                std::underlying_type_t<E> unlderlyingValue;
+                JsonSerializer<std::underlying_type_t<E>>::JsonRead(inReader, unlderlyingValue);
+                outValue = static_cast<E>(unlderlyingValue);
+            }
+        }
     };
 
     template <>
@@ -2266,6 +2537,30 @@ namespace Common { // NOLINT
             const Mirror::Class* owner = Mirror::Class::Find(ownerName);
             outValue = owner != nullptr ? owner->FindStaticVariable(name) : Mirror::GlobalScope::Get().FindVariable(name);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::Variable* inValue)
+        {
+            std::string ownerName;
+            std::string name;
+
+            if (inValue != nullptr) {
+                ownerName = inValue->GetOwnerName();
+                name = inValue->GetName();
+            }
+            Mirror::Internal::JsonWriteNamePair(inWriter, ownerName, name);
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::Variable*& outValue)
+        {
+            std::string ownerName;
+            std::string name;
+            if (!Mirror::Internal::JsonReadNamePair(inReader, ownerName, name)) {
+                return;
+            }
+
+            const Mirror::Class* owner = Mirror::Class::Find(ownerName);
+            outValue = owner != nullptr ? owner->FindStaticVariable(name) : Mirror::GlobalScope::Get().FindVariable(name);
+        }
     };
 
     template <>
@@ -2305,6 +2600,30 @@ namespace Common { // NOLINT
             const Mirror::Class* owner = Mirror::Class::Find(ownerName);
             outValue = owner != nullptr ? owner->FindStaticFunction(name) : Mirror::GlobalScope::Get().FindFunction(name);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::Function* inValue)
+        {
+            std::string ownerName;
+            std::string name;
+
+            if (inValue != nullptr) {
+                ownerName = inValue->GetOwnerName();
+                name = inValue->GetName();
+            }
+            Mirror::Internal::JsonWriteNamePair(inWriter, ownerName, name);
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::Function*& outValue)
+        {
+            std::string ownerName;
+            std::string name;
+            if (!Mirror::Internal::JsonReadNamePair(inReader, ownerName, name)) {
+                return;
+            }
+
+            const Mirror::Class* owner = Mirror::Class::Find(ownerName);
+            outValue = owner != nullptr ? owner->FindStaticFunction(name) : Mirror::GlobalScope::Get().FindFunction(name);
+        }
     };
 
     template <>
@@ -2344,6 +2663,30 @@ namespace Common { // NOLINT
             const Mirror::Class* owner = Mirror::Class::Find(ownerName);
             outValue = owner != nullptr ? owner->FindConstructor(name) : nullptr;
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::Constructor* inValue)
+        {
+            std::string ownerName;
+            std::string name;
+
+            if (inValue != nullptr) {
+                ownerName = inValue->GetOwnerName();
+                name = inValue->GetName();
+            }
+            Mirror::Internal::JsonWriteNamePair(inWriter, ownerName, name);
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::Constructor*& outValue)
+        {
+            std::string ownerName;
+            std::string name;
+            if (!Mirror::Internal::JsonReadNamePair(inReader, ownerName, name)) {
+                return;
+            }
+
+            const Mirror::Class* owner = Mirror::Class::Find(ownerName);
+            outValue = owner != nullptr ? owner->FindConstructor(name) : nullptr;
+        }
     };
 
     template <>
@@ -2362,6 +2705,20 @@ namespace Common { // NOLINT
             const Mirror::Class* owner = Mirror::Class::Find(ownerName);
             outValue = owner != nullptr ? &owner->GetDestructor() : nullptr;
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::Destructor* inValue)
+        {
+            inWriter.String(inValue != nullptr ? inValue->GetOwnerName() : "");
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::Destructor*& outValue)
+        {
+            std::string ownerName;
+            JsonSerializer<std::string>::JsonRead(inReader, ownerName);
+
+            const Mirror::Class* owner = Mirror::Class::Find(ownerName);
+            outValue = owner != nullptr ? &owner->GetDestructor() : nullptr;
+        }
     };
 
     template <>
@@ -2401,6 +2758,30 @@ namespace Common { // NOLINT
             const Mirror::Class* owner = Mirror::Class::Find(ownerName);
             outValue = owner != nullptr ? owner->FindMemberVariable(name) : nullptr;
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::MemberVariable* inValue)
+        {
+            std::string ownerName;
+            std::string name;
+
+            if (inValue != nullptr) {
+                ownerName = inValue->GetOwnerName();
+                name = inValue->GetName();
+            }
+            Mirror::Internal::JsonWriteNamePair(inWriter, ownerName, name);
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::MemberVariable*& outValue)
+        {
+            std::string ownerName;
+            std::string name;
+            if (!Mirror::Internal::JsonReadNamePair(inReader, ownerName, name)) {
+                return;
+            }
+
+            const Mirror::Class* owner = Mirror::Class::Find(ownerName);
+            outValue = owner != nullptr ? owner->FindMemberVariable(name) : nullptr;
+        }
     };
 
     template <>
@@ -2440,6 +2821,30 @@ namespace Common { // NOLINT
             const Mirror::Class* owner = Mirror::Class::Find(ownerName);
             outValue = owner != nullptr ? owner->FindMemberFunction(name) : nullptr;
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::MemberFunction* inValue)
+        {
+            std::string ownerName;
+            std::string name;
+
+            if (inValue != nullptr) {
+                ownerName = inValue->GetOwnerName();
+                name = inValue->GetName();
+            }
+            Mirror::Internal::JsonWriteNamePair(inWriter, ownerName, name);
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::MemberFunction*& outValue)
+        {
+            std::string ownerName;
+            std::string name;
+            if (!Mirror::Internal::JsonReadNamePair(inReader, ownerName, name)) {
+                return;
+            }
+
+            const Mirror::Class* owner = Mirror::Class::Find(ownerName);
+            outValue = owner != nullptr ? owner->FindMemberFunction(name) : nullptr;
+        }
     };
 
     template <>
@@ -2456,6 +2861,18 @@ namespace Common { // NOLINT
             JsonSerializer<std::string>::JsonDeserialize(inJsonValue, name);
             outValue = Mirror::Class::Find(name);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::Class* inValue)
+        {
+            inWriter.String(inValue != nullptr ? inValue->GetName() : "");
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::Class*& outValue)
+        {
+            std::string name;
+            JsonSerializer<std::string>::JsonRead(inReader, name);
+            outValue = Mirror::Class::Find(name);
+        }
     };
 
     template <>
@@ -2495,6 +2912,30 @@ namespace Common { // NOLINT
             const Mirror::Enum* owner = Mirror::Enum::Find(ownerName);
             outValue = owner != nullptr ? owner->FindValue(name) : nullptr;
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::EnumValue* inValue)
+        {
+            std::string ownerName;
+            std::string name;
+
+            if (inValue != nullptr) {
+                ownerName = inValue->GetOwnerName();
+                name = inValue->GetName();
+            }
+            Mirror::Internal::JsonWriteNamePair(inWriter, ownerName, name);
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::EnumValue*& outValue)
+        {
+            std::string ownerName;
+            std::string name;
+            if (!Mirror::Internal::JsonReadNamePair(inReader, ownerName, name)) {
+                return;
+            }
+
+            const Mirror::Enum* owner = Mirror::Enum::Find(ownerName);
+            outValue = owner != nullptr ? owner->FindValue(name) : nullptr;
+        }
     };
 
     template <>
@@ -2511,6 +2952,18 @@ namespace Common { // NOLINT
             JsonSerializer<std::string>::JsonDeserialize(inJsonValue, name);
             outValue = Mirror::Enum::Find(name);
         }
+
+        static void JsonWrite(JsonWriter& inWriter, const Mirror::Enum* inValue)
+        {
+            inWriter.String(inValue != nullptr ? inValue->GetName() : "");
+        }
+
+        static void JsonRead(JsonReader& inReader, const Mirror::Enum*& outValue)
+        {
+            std::string name;
+            JsonSerializer<std::string>::JsonRead(inReader, name);
+            outValue = Mirror::Enum::Find(name);
+        }
     };
 
     template <Mirror::MetaClass T>
@@ -2858,6 +3311,18 @@ namespace Mirror {
         Common::JsonDeserialize(inJsonValue, *static_cast<T*>(inThis));
     }
 
+    template <typename T>
+    void AnyRtti::JsonWrite(const void* inThis, Common::JsonWriter& inWriter)
+    {
+        Common::JsonWrite(inWriter, *static_cast<const T*>(inThis));
+    }
+
+    template <typename T>
+    void AnyRtti::JsonRead(void* inThis, Common::JsonReader& inReader)
+    {
+        Common::JsonRead(inReader, *static_cast<T*>(inThis));
+    }
+
     template <typename T>
     std::string AnyRtti::ToString(const void* inThis)
     {
@@ -3088,6 +3553,7 @@ namespace Mirror {
     void Any::ConstructFromValue(T&& inValue)
     {
         using RawType = std::remove_cvref_t<T>;
+        static_assert(alignof(RawType) <= HolderInfo::MaxAlignment, "over-aligned types can only be held by reference");
 
         arrayLength = 0;
         policy = AnyPolicy::memoryHolder;
@@ -3111,6 +3577,7 @@ namespace Mirror {
     void Any::ConstructFromArrayValue(T(& inValue)[N])
     {
         using RawType = std::remove_cv_t<T>;
+        static_assert(alignof(RawType) <= HolderInfo::MaxAlignment, "over-aligned types can only be held by reference");
 
         arrayLength = N;
         policy = AnyPolicy::memoryHolder;
@@ -3125,6 +3592,7 @@ namespace Mirror {
     void Any::ConstructFromArrayValue(T(&& inValue)[N])
     {
         using RawType = std::remove_cv_t<T>;
+        static_assert(alignof(RawType) <= HolderInfo::MaxAlignment, "over-aligned types can only be held by reference");
 
         arrayLength = N;
         policy = AnyPolicy::memoryHolder;
@@ -3209,6 +3677,12 @@ namespace Mirror {
         return result;
     }
 
+    template <typename... Args>
+    std::array<Argument, sizeof...(Args)> ForwardAsArgArray(Args&&... args)
+    {
+        return { ForwardAsArg(std::forward<Args>(args))... };
+    }
+
     template <typename T>
     Any ForwardAsAnyByValue(T&& value)
     {
@@ -3251,91 +3725,112 @@ namespace Mirror {
     template <typename... Args>
     Any Function::Invoke(Args&&... args) const
     {
-        return InvokeDyn(ForwardAsArgList(std::forward<Args>(args)...));
+        return invoker(ForwardAsArgArray(std::forward<Args>(args)...));
     }
 
     template <typename... Args>
     Any Constructor::Construct(Args&&... args) const
     {
-        return ConstructDyn(ForwardAsArgList(std::forward<Args>(args)...));
+        return stackConstructor(ForwardAsArgArray(std::forward<Args>(args)...));
     }
 
     template <typename... Args>
     Any Constructor::New(Args&&... args) const
     {
-        return NewDyn(ForwardAsArgList(std::forward<Args>(args)...));
+        return heapConstructor(ForwardAsArgArray(std::forward<Args>(args)...));
     }
 
     template <typename ... Args>
-    Any Constructor::InplaceNew(Args&&... args) const
+    Any Constructor::InplaceNew(void* ptr, Args&&... args) const
     {
-        return InplaceNewDyn(ForwardAsArgList(std::forward<Args>(args)...));
+        return inplaceConstructor(ptr, ForwardAsArgArray(std::forward<Args>(args)...));
     }
 
     template <typename C>
     void Destructor::Destruct(C&& object) const
     {
-        DestructDyn(ForwardAsArg(std::forward<C>(object)));
+        destructor(ForwardAsArg(std::forward<C>(object)));
     }
 
     template <typename C>
     void Destructor::Delete(C* object) const
     {
-        DeleteDyn(ForwardAsArg(object));
+        deleter(ForwardAsArg(object));
     }
 
     template <typename C, typename T>
     void MemberVariable::Set(C&& object, T&& value) const
     {
-        SetDyn(ForwardAsArg(std::forward<C>(object)), ForwardAsArg(std::forward<T>(value)));
+        setter(ForwardAsArg(std::forward<C>(object)), ForwardAsArg(std::forward<T>(value)));
     }
 
     template <typename C>
     Any MemberVariable::Get(C&& object) const
     {
-        return GetDyn(ForwardAsArg(std::forward<C>(object)));
+        return getter(ForwardAsArg(std::forward<C>(object)));
     }
 
     template <typename C, typename... Args>
     Any MemberFunction::Invoke(C&& object, Args&&... args) const
     {
-        return InvokeDyn(ForwardAsArg(std::forward<C>(object)), ForwardAsArgList(std::forward<Args>(args)...));
+        return invoker(ForwardAsArg(std::forward<C>(object)), ForwardAsArgArray(std::forward<Args>(args)...));
     }
 
     template <Common::CppClass C>
     bool Class::Has()
     {
-        return Has(Mirror::GetTypeInfo<C>());
+        return Find<C>() != nullptr;
     }
 
     template <Common::CppClass C>
     const Class* Class::Find()
     {
-        return Find(Mirror::GetTypeInfo<C>());
+        auto& cachedIndex = Internal::ClassIndexCache<C>::value;
+        const auto index = cachedIndex.load(std::memory_order_relaxed);
+        if (index != classIndexNull) {
+            return indexedClasses[index];
+        }
+
+        const auto* clazz = Find(Mirror::GetTypeInfo<C>());
+        if (clazz != nullptr) {
+            cachedIndex.store(clazz->index, std::memory_order_relaxed);
+        }
+        return clazz;
     }
 
     template <Common::CppClass C>
     const Class& Class::Get()
     {
-        return Get(Mirror::GetTypeInfo<C>());
+        const auto* clazz = Find<C>();
+        AssertWithReason(clazz != nullptr, "did you forget add EClass() annotation to class ?");
+        return *clazz;
     }
 
     template <typename ... Args>
     Any Class::Construct(Args&&... args) const
     {
-        return ConstructDyn(ForwardAsArgList(std::forward<Args>(args)...));
+        const auto arguments = ForwardAsArgArray(std::forward<Args>(args)...);
+        const auto* constructor = FindSuitableConstructor(arguments);
+        Assert(constructor != nullptr);
+        return constructor->stackConstructor(arguments);
     }
 
     template <typename ... Args>
     Any Class::New(Args&&... args) const
     {
-        return NewDyn(ForwardAsArgList(std::forward<Args>(args)...));
+        const auto arguments = ForwardAsArgArray(std::forward<Args>(args)...);
+        const auto* constructor = FindSuitableConstructor(arguments);
+        Assert(constructor != nullptr);
+        return constructor->heapConstructor(arguments);
     }
 
     template <typename ... Args>
     Any Class::InplaceNew(void* ptr, Args&&... args) const
     {
-        return InplaceNewDyn(ptr, ForwardAsArgList(std::forward<Args>(args)...));
+        const auto arguments = ForwardAsArgArray(std::forward<Args>(args)...);
+        const auto* constructor = FindSuitableConstructor(arguments);
+        Assert(constructor != nullptr);
+        return constructor->inplaceConstructor(ptr, arguments);
     }
 
     template <typename C>
@@ -3353,8 +3848,8 @@ namespace Mirror {
     template <Common::CppEnum T>
     const Enum* Enum::Find()
     {
-        auto iter = typeToIdMap.find(Mirror::GetTypeInfo<T>()->id);
-        if (iter == typeToIdMap.end()) {
+        auto iter = typeToIdMap.Find(Mirror::GetTypeInfo<T>()->id);
+        if (iter == typeToIdMap.End()) {
             return nullptr;
         }
         return Find(iter->second);
@@ -3363,8 +3858,8 @@ namespace Mirror {
     template <Common::CppEnum T>
     const Enum& Enum::Get()
     {
-        auto iter = typeToIdMap.find(Mirror::GetTypeInfo<T>()->id);
-        Assert(iter != typeToIdMap.end());
+        auto iter = typeToIdMap.Find(Mirror::GetTypeInfo<T>()->id);
+        Assert(iter != typeToIdMap.End());
         return Get(iter->second);
     }
 
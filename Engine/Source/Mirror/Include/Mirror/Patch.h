@@ -0,0 +1,138 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <vector>
+#include <optional>
+#include <cstdint>
+
+#include <Common/Serialization.h>
+#include <Mirror/Api.h>
+#include <Mirror/Mirror.h>
+
+namespace Mirror {
+    // changed member variables of a reflected object with their new values, e.g. for undo, replication deltas or saving only what changed
+    class MIRROR_API ObjectPatch {
+    public:
+        // records member variables (including base class ones, excluding transient ones) of target that differ from base
+        static ObjectPatch DiffDyn(const Class& inClass, const Argument& inBase, const Argument& inTarget);
+        template <Common::CppClass C> static ObjectPatch Diff(const C& inBase, const C& inTarget);
+
+        ObjectPatch();
+        ObjectPatch(const ObjectPatch& inOther);
+        ObjectPatch(ObjectPatch&& inOther) noexcept;
+        ~ObjectPatch();
+        ObjectPatch& operator=(const ObjectPatch& inOther);
+        ObjectPatch& operator=(ObjectPatch&& inOther) noexcept;
+
+        const Class* GetClass() const;
+        bool Empty() const;
+        size_t MemberVariableNum() const;
+        const MemberVariable& GetMemberVariable(size_t inIndex) const;
+        bool HasMemberVariable(const Id& inId) const;
+        size_t DataSize() const;
+        template <Common::CppClass C> void Apply(C& inObject) const;
+        // inObject must be an object of patch class or a class derived from it
+        void ApplyDyn(const Argument& inObject) const;
+
+    private:
+        friend struct Common::Serializer<ObjectPatch>;
+
+        struct Entry {
+            const MemberVariable* memberVariable;
+            // byte offset of member variable in object of patch class, includes offset of base class subobject owning it
+            size_t offset;
+            size_t dataBegin;
+            size_t dataSize;
+        };
+
+        // empty when member variable is not owned by patch class or its base classes
+        std::optional<size_t> FindMemberVariableOffset(const MemberVariable& inMemberVariable) const;
+        void EmplaceEntry(const MemberVariable& inMemberVariable, size_t inOffset, const void* inObject);
+
+        const Class* clazz;
+        std::vector<Entry> entries;
+        // raw bytes for memory comparable member variables, serialized value for others
+        std::vector<uint8_t> data;
+    };
+}
+
+namespace Common { // NOLINT
+    template <>
+    struct Serializer<Mirror::ObjectPatch> {
+        static constexpr size_t typeId = HashUtils::StrCrc32("Mirror::ObjectPatch");
+
+        // raw bytes of memory comparable member variables are written as is, so patches are only exchangeable between same endian platforms
+        static size_t Serialize(BinarySerializeStream& stream, const Mirror::ObjectPatch& value)
+        {
+            size_t serialized = 0;
+            serialized += Serializer<const Mirror::Class*>::Serialize(stream, value.clazz);
+            serialized += Serializer<uint64_t>::Serialize(stream, value.entries.size());
+            for (const auto& entry : value.entries) {
+                serialized += Serializer<const Mirror::MemberVariable*>::Serialize(stream, entry.memberVariable);
+                serialized += Serializer<uint64_t>::Serialize(stream, entry.dataSize);
+            }
+            serialized += Serializer<std::vector<uint8_t>>::Serialize(stream, value.data);
+            return serialized;
+        }
+
+        static size_t Deserialize(BinaryDeserializeStream& stream, Mirror::ObjectPatch& value)
+        {
+            size_t deserialized = 0;
+            value = Mirror::ObjectPatch();
+            deserialized += Serializer<const Mirror::Class*>::Deserialize(stream, value.clazz);
+
+            uint64_t entryNum = 0;
+            deserialized += Serializer<uint64_t>::Deserialize(stream, entryNum);
+            std::vector<Mirror::ObjectPatch::Entry> entries(entryNum);
+            size_t dataBegin = 0;
+            for (auto& entry : entries) {
+                uint64_t dataSize = 0;
+                deserialized += Serializer<const Mirror::MemberVariable*>::Deserialize(stream, entry.memberVariable);
+                deserialized += Serializer<uint64_t>::Deserialize(stream, dataSize);
+                entry.dataBegin = dataBegin;
+                entry.dataSize = dataSize;
+                dataBegin += dataSize;
+            }
+
+            std::vector<uint8_t> data;
+            deserialized += Serializer<std::vector<uint8_t>>::Deserialize(stream, data);
+            if (value.clazz == nullptr || data.size() != dataBegin) {
+                value = Mirror::ObjectPatch();
+                return deserialized;
+            }
+
+            // member variables removed or moved to another class since the patch was written are dropped, memory comparable ones must keep their size
+            value.data.reserve(data.size());
+            for (const auto& entry : entries) {
+                if (entry.memberVariable == nullptr
+                    || (entry.memberVariable->IsMemoryComparable() && entry.memberVariable->SizeOf() != entry.dataSize)) {
+                    continue;
+                }
+                const auto offset = value.FindMemberVariableOffset(*entry.memberVariable);
+                if (!offset.has_value()) {
+                    continue;
+                }
+                value.entries.emplace_back(Mirror::ObjectPatch::Entry { entry.memberVariable, offset.value(), value.data.size(), entry.dataSize });
+                value.data.insert(value.data.end(), data.begin() + entry.dataBegin, data.begin() + entry.dataBegin + entry.dataSize);
+            }
+            return deserialized;
+        }
+    };
+}
+
+namespace Mirror {
+    template <Common::CppClass C>
+    ObjectPatch ObjectPatch::Diff(const C& inBase, const C& inTarget)
+    {
+        return DiffDyn(Class::Get<C>(), ForwardAsArg(inBase), ForwardAsArg(inTarget));
+    }
+
+    template <Common::CppClass C>
+    void ObjectPatch::Apply(C& inObject) const
+    {
+        ApplyDyn(ForwardAsArg(inObject));
+    }
+}
@@ -15,12 +15,14 @@ namespace Mirror::Internal {
     template <typename T> struct MemberVariableTraits {};
     template <typename T> struct MemberFunctionTraits {};
 
+    template <auto Ptr> size_t GetMemberVariableOffset();
+    template <typename Derived, typename Base> size_t GetBaseClassOffset();
     template <typename ArgsTuple, size_t... I> auto GetArgTypeInfosByArgsTuple(std::index_sequence<I...>);
-    template <auto Ptr, typename ArgsTuple, size_t... I> decltype(auto) InvokeFunction(const ArgumentList& args, std::index_sequence<I...>);
-    template <typename Class, auto Ptr, typename ArgsTuple, size_t... I> decltype(auto) InvokeMemberFunction(Class& object, const ArgumentList& args, std::index_sequence<I...>);
-    template <typename Class, typename ArgsTuple, size_t... I> decltype(auto) InvokeConstructorStack(const ArgumentList& args, std::index_sequence<I...>);
-    template <typename Class, typename ArgsTuple, size_t... I> decltype(auto) InvokeConstructorNew(const ArgumentList& args, std::index_sequence<I...>);
-    template <typename Class, typename ArgsTuple, size_t... I> decltype(auto) InvokeConstructorInplace(void* ptr, const ArgumentList& args, std::index_sequence<I...>);
+    template <auto Ptr, typename ArgsTuple, size_t... I> decltype(auto) InvokeFunction(ArgumentSpan args, std::index_sequence<I...>);
+    template <typename Class, auto Ptr, typename ArgsTuple, size_t... I> decltype(auto) InvokeMemberFunction(Class& object, ArgumentSpan args, std::index_sequence<I...>);
+    template <typename Class, typename ArgsTuple, size_t... I> decltype(auto) InvokeConstructorStack(ArgumentSpan args, std::index_sequence<I...>);
+    template <typename Class, typename ArgsTuple, size_t... I> decltype(auto) InvokeConstructorNew(ArgumentSpan args, std::index_sequence<I...>);
+    template <typename Class, typename ArgsTuple, size_t... I> decltype(auto) InvokeConstructorInplace(void* ptr, ArgumentSpan args, std::index_sequence<I...>);
 
     class MIRROR_API ScopedReleaser {
     public:
@@ -164,6 +166,31 @@ namespace Mirror::Internal {
         using ArgsTupleType = std::tuple<Args...>;
     };
 
+    template <typename Class>
+    struct MemberOffsetProbe {
+        // storage with layout of Class, only used for address arithmetic, never read or written
+        alignas(Class) static inline std::byte storage[sizeof(Class)];
+    };
+
+    template <auto Ptr>
+    size_t GetMemberVariableOffset()
+    {
+        using ClassType = typename MemberVariableTraits<decltype(Ptr)>::ClassType;
+        const auto* storage = MemberOffsetProbe<ClassType>::storage;
+        const auto* object = reinterpret_cast<const ClassType*>(storage);
+        return reinterpret_cast<const std::byte*>(&(object->*Ptr)) - storage;
+    }
+
+    template <typename Derived, typename Base>
+    size_t GetBaseClassOffset()
+    {
+        // converting to a virtual base reads vptr of the object, which the probe storage does not have
+        static_assert(requires(Base* base) { static_cast<Derived*>(base); }, "virtual base class is not supported");
+        const auto* storage = MemberOffsetProbe<Derived>::storage;
+        const auto* object = reinterpret_cast<const Derived*>(storage);
+        return reinterpret_cast<const std::byte*>(static_cast<const Base*>(object)) - storage;
+    }
+
     template <typename ArgsTuple, size_t... I>
     auto GetArgTypeInfosByArgsTuple(std::index_sequence<I...>)
     {
@@ -171,31 +198,31 @@ namespace Mirror::Internal {
     }
 
     template <auto Ptr, typename ArgsTuple, size_t... I>
-    decltype(auto) InvokeFunction(const ArgumentList& args, std::index_sequence<I...>)
+    decltype(auto) InvokeFunction(ArgumentSpan args, std::index_sequence<I...>)
     {
         return Ptr(args[I].template As<std::tuple_element_t<I, ArgsTuple>>()...);
     }
 
     template <typename Class, auto Ptr, typename ArgsTuple, size_t... I>
-    decltype(auto) InvokeMemberFunction(Class& object, const ArgumentList& args, std::index_sequence<I...>)
+    decltype(auto) InvokeMemberFunction(Class& object, ArgumentSpan args, std::index_sequence<I...>)
     {
         return (object.*Ptr)(args[I].template As<std::tuple_element_t<I, ArgsTuple>>()...);
     }
 
     template <typename Class, typename ArgsTuple, size_t... I>
-    decltype(auto) InvokeConstructorStack(const ArgumentList& args, std::index_sequence<I...>)
+    decltype(auto) InvokeConstructorStack(ArgumentSpan args, std::index_sequence<I...>)
     {
         return Class(args[I].template As<std::tuple_element_t<I, ArgsTuple>>()...);
     }
 
     template <typename Class, typename ArgsTuple, size_t... I>
-    decltype(auto) InvokeConstructorNew(const ArgumentList& args, std::index_sequence<I...>)
+    decltype(auto) InvokeConstructorNew(ArgumentSpan args, std::index_sequence<I...>)
     {
         return new Class(args[I].template As<std::tuple_element_t<I, ArgsTuple>>()...);
     }
 
     template <typename Class, typename ArgsTuple, size_t... I>
-    decltype(auto) InvokeConstructorInplace(void* ptr, const ArgumentList& args, std::index_sequence<I...>)
+    decltype(auto) InvokeConstructorInplace(void* ptr, ArgumentSpan args, std::index_sequence<I...>)
     {
         new(ptr) Class(args[I].template As<std::tuple_element_t<I, ArgsTuple>>()...);
         return *static_cast<Class*>(ptr);
@@ -255,7 +282,7 @@ namespace Mirror {
         params.argTypeInfos = { GetTypeInfo<Args>()... };
         params.argRemoveRefTypeInfos = { GetTypeInfo<std::remove_reference_t<Args>>()... };
         params.argRemovePointerTypeInfos = { GetTypeInfo<std::remove_pointer_t<Args>>()... };
-        params.stackConstructor = [](const ArgumentList& args) -> Any {
+        params.stackConstructor = [](ArgumentSpan args) -> Any {
             if constexpr (std::is_copy_constructible_v<C> || std::is_move_constructible_v<C>) {
                 Assert(argsTupleSize == args.size());
                 return ForwardAsAny(Internal::InvokeConstructorStack<C, ArgsTupleType>(args, std::make_index_sequence<argsTupleSize> {}));
@@ -264,11 +291,11 @@ namespace Mirror {
                 return {};
             }
         };
-        params.heapConstructor = [](const ArgumentList& args) -> Any {
+        params.heapConstructor = [](ArgumentSpan args) -> Any {
             Assert(argsTupleSize == args.size());
             return ForwardAsAny(Internal::InvokeConstructorNew<C, ArgsTupleType>(args, std::make_index_sequence<argsTupleSize> {}));
         };
-        params.inplaceConstructor = [](void* ptr, const ArgumentList& args) -> Any {
+        params.inplaceConstructor = [](void* ptr, ArgumentSpan args) -> Any {
             Assert(argsTupleSize == args.size());
             return ForwardAsAny(std::ref(Internal::InvokeConstructorInplace<C, ArgsTupleType>(ptr, args, std::make_index_sequence<argsTupleSize> {})));
         };
@@ -324,7 +351,7 @@ namespace Mirror {
         params.retTypeInfo = GetTypeInfo<RetType>();
         params.argsNum = argsTupleSize;
         params.argTypeInfos = Internal::GetArgTypeInfosByArgsTuple<ArgsTupleType>(std::make_index_sequence<argsTupleSize> {});
-        params.invoker = [](const ArgumentList& args) -> Any {
+        params.invoker = [](ArgumentSpan args) -> Any {
             Assert(argsTupleSize == args.size());
 
             if constexpr (std::is_void_v<RetType>) {
@@ -353,7 +380,11 @@ namespace Mirror {
         params.owner = clazz.GetId();
         params.access = Access;
         params.memorySize = sizeof(ValueType);
+        params.offset = Internal::GetMemberVariableOffset<Ptr>();
+        // floating point values are compared bitwise too, a diff then never misses a change and stays stable with NaN
+        params.memoryComparable = std::has_unique_object_representations_v<ValueType> || std::is_floating_point_v<ValueType>;
         params.typeInfo = GetTypeInfo<ValueType>();
+        params.rtti = &anyRttiImpl<ValueType>;
         params.setter = [](const Argument& object, const Argument& value) -> void {
             Assert(!object.IsConstRef());
             object.As<ClassType&>().*Ptr = value.As<const ValueType&>();
@@ -388,7 +419,7 @@ namespace Mirror {
         params.retTypeInfo = GetTypeInfo<RetType>();
         params.argsNum = argsTupleSize;
         params.argTypeInfos = Internal::GetArgTypeInfosByArgsTuple<ArgsTupleType>(std::make_index_sequence<argsTupleSize> {});
-        params.invoker = [](const Argument& object, const ArgumentList& args) -> Any {
+        params.invoker = [](const Argument& object, ArgumentSpan args) -> Any {
             Assert(argsTupleSize == args.size());
 
             if constexpr (std::is_void_v<RetType>) {
@@ -444,7 +475,7 @@ namespace Mirror {
         params.retTypeInfo = GetTypeInfo<RetType>();
         params.argsNum = argsTupleSize;
         params.argTypeInfos = Internal::GetArgTypeInfosByArgsTuple<ArgsTupleType>(std::make_index_sequence<argsTupleSize> {});
-        params.invoker = [](const ArgumentList& args) -> Any {
+        params.invoker = [](ArgumentSpan args) -> Any {
             Assert(argsTupleSize == args.size());
 
             if constexpr (std::is_void_v<RetType>) {
@@ -497,18 +528,25 @@ namespace Mirror {
     ClassRegistry<C> Registry::Class(const Id& inId)
     {
         const auto typeId = GetTypeInfo<C>()->id;
-        Assert(!Class::typeToIdMap.contains(typeId));
+        Assert(!Class::Has(typeId));
         Assert(!classes.Contains(inId));
 
         Class::ConstructParams params;
         params.id = inId;
         params.typeInfo = GetTypeInfo<C>();
         params.memorySize = sizeof(C);
+        // reflected base can be any of multiple bases or follow a vptr, so its subobject does not always start at 0
+        if constexpr (std::is_void_v<B>) {
+            params.baseClassOffset = 0;
+        } else {
+            params.baseClassOffset = Internal::GetBaseClassOffset<C, B>();
+        }
         params.baseClassGetter = []() -> const Mirror::Class* {
             if constexpr (std::is_void_v<B>) {
                 return nullptr;
             } else {
-                return &Mirror::Class::Get<B>();
+                // base class can be a non-reflected mixin, e.g. Common::RefCounted
+                return Mirror::Class::Find<B>();
             }
         };
         params.inplaceGetter = [](void* ptr) -> Any {
@@ -540,7 +578,7 @@ namespace Mirror {
             ctorParams.argTypeInfos = {};
             ctorParams.argRemoveRefTypeInfos = {};
             ctorParams.argRemovePointerTypeInfos = {};
-            ctorParams.stackConstructor = [](const ArgumentList& args) -> Any {
+            ctorParams.stackConstructor = [](ArgumentSpan args) -> Any {
                 if constexpr (std::is_copy_constructible_v<C> || std::is_move_constructible_v<C>) {
                     Assert(args.empty());
                     return { C() };
@@ -549,11 +587,11 @@ namespace Mirror {
                     return {};
                 }
             };
-            ctorParams.heapConstructor = [](const ArgumentList& args) -> Any {
+            ctorParams.heapConstructor = [](ArgumentSpan args) -> Any {
                 Assert(args.empty());
                 return { new C() };
             };
-            ctorParams.inplaceConstructor = [](void* ptr, const ArgumentList& args) -> Any {
+            ctorParams.inplaceConstructor = [](void* ptr, ArgumentSpan args) -> Any {
                 Assert(ptr != nullptr && args.empty());
                 new(ptr) C();
                 return std::ref(*static_cast<C*>(ptr));
@@ -569,7 +607,7 @@ namespace Mirror {
             copyCtorParams.argTypeInfos = { GetTypeInfo<const C&>() };
             copyCtorParams.argRemoveRefTypeInfos = { GetTypeInfo<std::remove_reference_t<const C&>>() };
             copyCtorParams.argRemovePointerTypeInfos = { GetTypeInfo<std::remove_pointer_t<const C&>>() };
-            copyCtorParams.stackConstructor = [](const ArgumentList& args) -> Any {
+            copyCtorParams.stackConstructor = [](ArgumentSpan args) -> Any {
                 if constexpr (std::is_copy_constructible_v<C> || std::is_move_constructible_v<C>) {
                     Assert(args.size() == 1);
                     return { C(args[0].As<const C&>()) };
@@ -578,11 +616,11 @@ namespace Mirror {
                     return {};
                 }
             };
-            copyCtorParams.heapConstructor = [](const ArgumentList& args) -> Any {
+            copyCtorParams.heapConstructor = [](ArgumentSpan args) -> Any {
                 Assert(args.size() == 1);
                 return { new C(args[0].As<const C&>()) };
             };
-            copyCtorParams.inplaceConstructor = [](void* ptr, const ArgumentList& args) -> Any {
+            copyCtorParams.inplaceConstructor = [](void* ptr, ArgumentSpan args) -> Any {
                 Assert(ptr != nullptr && args.size() == 1);
                 new(ptr) C(args[0].As<const C&>());
                 return std::ref(*static_cast<C*>(ptr));
@@ -598,7 +636,7 @@ namespace Mirror {
             moveCtorParams.argTypeInfos = { GetTypeInfo<C&&>() };
             moveCtorParams.argRemoveRefTypeInfos = { GetTypeInfo<std::remove_reference_t<C&&>>() };
             moveCtorParams.argRemovePointerTypeInfos = { GetTypeInfo<std::remove_pointer_t<C&&>>() };
-            moveCtorParams.stackConstructor = [](const ArgumentList& args) -> Any {
+            moveCtorParams.stackConstructor = [](ArgumentSpan args) -> Any {
                 if constexpr (std::is_copy_constructible_v<C> || std::is_move_constructible_v<C>) {
                     Assert(args.size() == 1);
                     return { C(args[0].As<C&&>()) };
@@ -607,11 +645,11 @@ namespace Mirror {
                     return {};
                 }
             };
-            moveCtorParams.heapConstructor = [](const ArgumentList& args) -> Any {
+            moveCtorParams.heapConstructor = [](ArgumentSpan args) -> Any {
                 Assert(args.size() == 1);
                 return { new C(args[0].As<C&&>()) };
             };
-            moveCtorParams.inplaceConstructor = [](void* ptr, const ArgumentList& args) -> Any {
+            moveCtorParams.inplaceConstructor = [](void* ptr, ArgumentSpan args) -> Any {
                 Assert(ptr != nullptr && args.size() == 1);
                 new(ptr) C(args[0].As<C&&>());
                 return std::ref(*static_cast<C*>(ptr));
@@ -619,7 +657,6 @@ namespace Mirror {
             params.moveConstructorParams = std::move(moveCtorParams);
         }
 
-        Class::typeToIdMap[typeId] = inId;
         return ClassRegistry<C>(EmplaceClass(inId, std::move(params)));
     }
 
@@ -627,13 +664,13 @@ namespace Mirror {
     EnumRegistry<T> Registry::Enum(const Id& inId)
     {
         const auto typeId = GetTypeInfo<T>()->id;
-        Assert(!Enum::typeToIdMap.contains(typeId));
+        Assert(!Enum::typeToIdMap.Contains(typeId));
         Assert(!enums.Contains(inId));
 
         Enum::ConstructParams params;
         params.id = inId;
 
-        Enum::typeToIdMap[typeId] = inId;
+        Enum::typeToIdMap.Emplace(typeId, inId);
         return EnumRegistry<T>(EmplaceEnum(inId, std::move(params)));
     }
 }
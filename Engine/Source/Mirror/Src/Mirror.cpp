@@ -5,12 +5,14 @@
 #include <ranges>
 #include <utility>
 #include <sstream>
+#include <cstring>
 
 #include <Mirror/Mirror.h>
 #include <Mirror/Registry.h>
 #include <Common/Debug.h>
 #include <Common/String.h>
 #include <Common/Hash.h>
+#include <Common/Allocator.h>
 
 namespace Mirror {
     bool PointerConvertible(const TypeInfoCompact& inSrcType, const TypeInfoCompact& inDstType)
@@ -74,17 +76,15 @@ namespace Mirror {
     }
 
     Any::Any()
+        : arrayLength(0)
+        , policy(AnyPolicy::max)
+        , rtti(nullptr)
     {
-        Reset();
     }
 
     Any::~Any()
     {
-        if (IsMemoryHolder() && rtti != nullptr) {
-            for (auto i = 0; i < ElementNum(); i++) {
-                rtti->detor(Data(i));
-            }
-        }
+        Reset();
     }
 
     Any::Any(Any& inOther)
@@ -125,6 +125,10 @@ namespace Mirror {
 
     Any& Any::operator=(Any&& inOther) noexcept
     {
+        if (&inOther == this) {
+            return *this;
+        }
+
         Reset();
         PerformMoveConstruct(std::move(inOther));
         return *this;
@@ -588,6 +592,12 @@ namespace Mirror {
 
     void Any::Reset()
     {
+        // held elements must be destructed before their memory is released, re-assigning an any goes through here
+        if (IsMemoryHolder() && rtti != nullptr) {
+            for (auto i = 0; i < ElementNum(); i++) {
+                rtti->detor(Data(i));
+            }
+        }
         arrayLength = 0;
         policy = AnyPolicy::max;
         rtti = nullptr;
@@ -635,6 +645,24 @@ namespace Mirror {
         return rtti->jsonDeserialize(Data(), inJsonValue);
     }
 
+    void Any::JsonWrite(Common::JsonWriter& inWriter) const
+    {
+        Assert(!IsArray() && rtti != nullptr);
+        rtti->jsonWrite(Data(), inWriter);
+    }
+
+    void Any::JsonRead(Common::JsonReader& inReader)
+    {
+        Assert(!IsArray() && rtti != nullptr && !IsConstRef());
+        rtti->jsonRead(Data(), inReader);
+    }
+
+    void Any::JsonRead(Common::JsonReader& inReader) const
+    {
+        Assert(!IsArray() && rtti != nullptr && IsNonConstRef());
+        rtti->jsonRead(Data(), inReader);
+    }
+
     std::string Any::ToString() const
     {
         Assert(!IsArray());
@@ -682,38 +710,95 @@ namespace Mirror {
         return !operator==(inAny);
     }
 
-    Any::HolderInfo::HolderInfo() = default;
+    Any::HolderInfo::HolderInfo()
+        : memorySize(0)
+        , heapMemory(nullptr)
+    {
+    }
 
     Any::HolderInfo::HolderInfo(size_t inMemorySize)
+        : memorySize(0)
+        , heapMemory(nullptr)
     {
         ResizeMemory(inMemorySize);
     }
 
+    Any::HolderInfo::HolderInfo(const HolderInfo& inOther)
+        : memorySize(0)
+        , heapMemory(nullptr)
+    {
+        ResizeMemory(inOther.memorySize);
+        memcpy(Ptr(), inOther.Ptr(), memorySize);
+    }
+
+    Any::HolderInfo::HolderInfo(HolderInfo&& inOther) noexcept
+        : memorySize(inOther.memorySize)
+        , heapMemory(inOther.heapMemory)
+    {
+        if (heapMemory == nullptr) {
+            memcpy(inlineMemory, inOther.inlineMemory, memorySize);
+        }
+        inOther.memorySize = 0;
+        inOther.heapMemory = nullptr;
+    }
+
+    Any::HolderInfo& Any::HolderInfo::operator=(const HolderInfo& inOther)
+    {
+        if (&inOther == this) {
+            return *this;
+        }
+        ResizeMemory(inOther.memorySize);
+        memcpy(Ptr(), inOther.Ptr(), memorySize);
+        return *this;
+    }
+
+    Any::HolderInfo& Any::HolderInfo::operator=(HolderInfo&& inOther) noexcept
+    {
+        if (&inOther == this) {
+            return *this;
+        }
+        ReleaseMemory();
+        memorySize = inOther.memorySize;
+        heapMemory = inOther.heapMemory;
+        if (heapMemory == nullptr) {
+            memcpy(inlineMemory, inOther.inlineMemory, memorySize);
+        }
+        inOther.memorySize = 0;
+        inOther.heapMemory = nullptr;
+        return *this;
+    }
+
+    Any::HolderInfo::~HolderInfo()
+    {
+        ReleaseMemory();
+    }
+
     void Any::HolderInfo::ResizeMemory(size_t inSize)
     {
-        if (inSize <= MaxStackMemorySize) {
-            memory = InplaceMemory {};
-            std::get<InplaceMemory>(memory).Resize(inSize);
-        } else {
-            memory = HeapMemory {};
-            std::get<HeapMemory>(memory).resize(inSize);
+        ReleaseMemory();
+        if (inSize > InlineCapacity) {
+            heapMemory = static_cast<uint8_t*>(Common::SmallObjectAllocator::Allocate(inSize, Common::MemoryTag::reflection));
         }
+        memorySize = inSize;
     }
 
     void* Any::HolderInfo::Ptr() const
     {
-        if (memory.index() == 0) {
-            return const_cast<uint8_t*>(std::get<InplaceMemory>(memory).Data());
-        }
-        return const_cast<uint8_t*>(std::get<HeapMemory>(memory).data());
+        return heapMemory != nullptr ? heapMemory : const_cast<uint8_t*>(inlineMemory);
     }
 
     size_t Any::HolderInfo::Size() const
     {
-        if (memory.index() == 0) {
-            return std::get<InplaceMemory>(memory).Size();
+        return memorySize;
+    }
+
+    void Any::HolderInfo::ReleaseMemory()
+    {
+        if (heapMemory != nullptr) {
+            Common::SmallObjectAllocator::Deallocate(heapMemory, memorySize, Common::MemoryTag::reflection);
+            heapMemory = nullptr;
         }
-        return std::get<HeapMemory>(memory).size();
+        memorySize = 0;
     }
 
     Any::RefInfo::RefInfo()
@@ -836,6 +921,13 @@ namespace Mirror {
         });
     }
 
+    void* Argument::Data() const
+    {
+        return Delegate([](auto&& value) -> void* {
+            return value.Data();
+        });
+    }
+
     Id Id::null = Id();
 
     Id::Id()
@@ -1187,7 +1279,10 @@ namespace Mirror {
         , owner(std::move(params.owner))
         , access(params.access)
         , memorySize(params.memorySize)
+        , offset(params.offset)
+        , memoryComparable(params.memoryComparable)
         , typeInfo(params.typeInfo)
+        , rtti(params.rtti)
         , setter(std::move(params.setter))
         , getter(std::move(params.getter))
     {
@@ -1242,6 +1337,11 @@ namespace Mirror {
         return HasMeta("transient") && GetMetaBool("transient");
     }
 
+    bool MemberVariable::IsMemoryComparable() const
+    {
+        return memoryComparable;
+    }
+
     MemberFunction::MemberFunction(ConstructParams&& params)
         : ReflNode(std::move(params.id))
         , owner(std::move(params.owner))
@@ -1367,12 +1467,15 @@ namespace Mirror {
         return functions.At(inId);
     }
 
-    std::unordered_map<TypeId, Id> Class::typeToIdMap = {};
+    Common::FlatHashMap<TypeId, ClassIndex> Class::typeToIndexMap = {};
+    std::vector<const Class*> Class::indexedClasses = {};
 
     Class::Class(ConstructParams&& params)
         : ReflNode(std::move(params.id))
         , typeInfo(params.typeInfo)
+        , index(params.index)
         , memorySize(params.memorySize)
+        , baseClassOffset(params.baseClassOffset)
         , baseClassGetter(std::move(params.baseClassGetter))
         , inplaceGetter(std::move(params.inplaceGetter))
     {
@@ -1414,7 +1517,7 @@ namespace Mirror {
     bool Class::Has(const TypeInfo* typeInfo)
     {
         Assert(typeInfo != nullptr && typeInfo->isClass && !typeInfo->isConst);
-        return typeToIdMap.contains(typeInfo->id); // NOLINT
+        return Has(typeInfo->id); // NOLINT
     }
 
     const Class* Class::Find(const TypeInfo* typeInfo)
@@ -1431,27 +1534,35 @@ namespace Mirror {
 
     bool Class::Has(TypeId typeId)
     {
-        const auto iter = typeToIdMap.find(typeId);
-        if (iter == typeToIdMap.end()) {
-            return false;
-        }
-        return Has(iter->second);
+        return Find(typeId) != nullptr;
     }
 
     const Class* Class::Find(const TypeId typeId)
     {
-        const auto iter = typeToIdMap.find(typeId);
-        if (iter == typeToIdMap.end()) {
+        const auto iter = typeToIndexMap.Find(typeId);
+        if (iter == typeToIndexMap.End()) {
             return nullptr;
         }
-        return Find(iter->second);
+        return indexedClasses[iter->second];
     }
 
     const Class& Class::Get(TypeId typeId)
     {
-        const auto iter = typeToIdMap.find(typeId);
-        AssertWithReason(iter != typeToIdMap.end(), "did you forget add EClass() annotation to class ?");
-        return Get(iter->second);
+        const auto* clazz = Find(typeId);
+        AssertWithReason(clazz != nullptr, "did you forget add EClass() annotation to class ?");
+        return *clazz;
+    }
+
+    const Class* Class::FindByIndex(ClassIndex inIndex)
+    {
+        return inIndex < indexedClasses.size() ? indexedClasses[inIndex] : nullptr;
+    }
+
+    const Class& Class::GetByIndex(ClassIndex inIndex)
+    {
+        const auto* clazz = FindByIndex(inIndex);
+        Assert(clazz != nullptr);
+        return *clazz;
     }
 
     std::vector<const Class*> Class::GetAll()
@@ -1565,6 +1676,11 @@ namespace Mirror {
         return typeInfo;
     }
 
+    ClassIndex Class::GetIndex() const
+    {
+        return index;
+    }
+
     size_t Class::SizeOf() const
     {
         return memorySize;
@@ -1580,6 +1696,11 @@ namespace Mirror {
         return baseClassGetter();
     }
 
+    size_t Class::GetBaseClassOffset() const
+    {
+        return baseClassOffset;
+    }
+
     bool Class::IsBaseOf(const Class* derivedClass) const
     {
         return derivedClass->IsDerivedFrom(this);
@@ -1628,7 +1749,7 @@ namespace Mirror {
         return constructors.contains(inId);
     }
 
-    const Constructor* Class::FindSuitableConstructor(const ArgumentList& arguments) const
+    const Constructor* Class::FindSuitableConstructor(ArgumentSpan arguments) const
     {
         std::vector<std::pair<const Constructor*, uint32_t>> candidateAndRates;
         candidateAndRates.reserve(constructors.size());
@@ -1862,7 +1983,7 @@ namespace Mirror {
         return enums.At(inId);
     }
 
-    std::unordered_map<TypeId, Id> Enum::typeToIdMap = {};
+    Common::FlatHashMap<TypeId, Id> Enum::typeToIdMap = {};
 
     Enum::Enum(ConstructParams&& params)
         : ReflNode(std::move(params.id))
@@ -0,0 +1,155 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <cstring>
+#include <ranges>
+
+#include <Mirror/Patch.h>
+
+namespace Mirror {
+    // offset of inBase subobject in object of inDerived, member variable offsets are relative to the class declaring them
+    static std::optional<size_t> FindBaseClassOffset(const Class& inDerived, const Class& inBase)
+    {
+        size_t offset = 0;
+        for (const auto* clazz = &inDerived; clazz != nullptr; clazz = clazz->GetBaseClass()) {
+            if (clazz == &inBase) {
+                return offset;
+            }
+            offset += clazz->GetBaseClassOffset();
+        }
+        return {};
+    }
+
+    ObjectPatch ObjectPatch::DiffDyn(const Class& inClass, const Argument& inBase, const Argument& inTarget)
+    {
+        const auto* base = static_cast<const uint8_t*>(inBase.Data());
+        const auto* target = static_cast<const uint8_t*>(inTarget.Data());
+        Assert(base != nullptr && target != nullptr);
+
+        ObjectPatch result;
+        result.clazz = &inClass;
+        size_t classOffset = 0;
+        for (const auto* clazz = &inClass; clazz != nullptr; classOffset += clazz->GetBaseClassOffset(), clazz = clazz->GetBaseClass()) {
+            for (const auto& memberVariable : clazz->GetMemberVariables() | std::views::values) {
+                const auto offset = classOffset + memberVariable.offset;
+                const auto* baseMember = base + offset;
+                const auto* targetMember = target + offset;
+                bool same;
+                if (memberVariable.memoryComparable) {
+                    same = std::memcmp(baseMember, targetMember, memberVariable.memorySize) == 0;
+                } else if (memberVariable.typeInfo->equalComparable) {
+                    same = memberVariable.rtti->equal(baseMember, targetMember);
+                } else {
+                    // no way to tell, always carry the value
+                    same = false;
+                }
+
+                // transient check looks up metas, so it is only done for changed member variables
+                if (!same && !memberVariable.IsTransient()) {
+                    result.EmplaceEntry(memberVariable, offset, target);
+                }
+            }
+        }
+        return result;
+    }
+
+    ObjectPatch::ObjectPatch()
+        : clazz(nullptr)
+    {
+    }
+
+    ObjectPatch::ObjectPatch(const ObjectPatch& inOther) = default;
+
+    ObjectPatch::ObjectPatch(ObjectPatch&& inOther) noexcept = default;
+
+    ObjectPatch::~ObjectPatch() = default;
+
+    ObjectPatch& ObjectPatch::operator=(const ObjectPatch& inOther) = default;
+
+    ObjectPatch& ObjectPatch::operator=(ObjectPatch&& inOther) noexcept = default;
+
+    const Class* ObjectPatch::GetClass() const
+    {
+        return clazz;
+    }
+
+    bool ObjectPatch::Empty() const
+    {
+        return entries.empty();
+    }
+
+    size_t ObjectPatch::MemberVariableNum() const
+    {
+        return entries.size();
+    }
+
+    const MemberVariable& ObjectPatch::GetMemberVariable(size_t inIndex) const
+    {
+        Assert(inIndex < entries.size());
+        return *entries[inIndex].memberVariable;
+    }
+
+    bool ObjectPatch::HasMemberVariable(const Id& inId) const
+    {
+        for (const auto& entry : entries) {
+            if (entry.memberVariable->GetId() == inId) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t ObjectPatch::DataSize() const
+    {
+        return data.size();
+    }
+
+    void ObjectPatch::ApplyDyn(const Argument& inObject) const
+    {
+        if (entries.empty()) {
+            return;
+        }
+
+        Assert(!inObject.IsConstRef());
+        const auto* objectClass = Class::Find(inObject.RemoveRefType());
+        const auto objectOffset = objectClass != nullptr ? FindBaseClassOffset(*objectClass, *clazz) : std::nullopt;
+        AssertWithReason(objectOffset.has_value(), "object must be of patch class or a class derived from it");
+        auto* object = static_cast<uint8_t*>(inObject.Data());
+        Assert(object != nullptr);
+        object += objectOffset.value();
+
+        for (const auto& entry : entries) {
+            const auto& memberVariable = *entry.memberVariable;
+            auto* member = object + entry.offset;
+            if (memberVariable.memoryComparable) {
+                std::memcpy(member, data.data() + entry.dataBegin, entry.dataSize);
+            } else {
+                Common::MemoryDeserializeStream stream(data, entry.dataBegin);
+                memberVariable.rtti->deserialize(member, stream);
+            }
+        }
+    }
+
+    std::optional<size_t> ObjectPatch::FindMemberVariableOffset(const MemberVariable& inMemberVariable) const
+    {
+        const auto classOffset = FindBaseClassOffset(*clazz, inMemberVariable.GetOwner());
+        if (!classOffset.has_value()) {
+            return {};
+        }
+        return classOffset.value() + inMemberVariable.offset;
+    }
+
+    void ObjectPatch::EmplaceEntry(const MemberVariable& inMemberVariable, size_t inOffset, const void* inObject)
+    {
+        const auto* member = static_cast<const uint8_t*>(inObject) + inOffset;
+        const auto dataBegin = data.size();
+        if (inMemberVariable.memoryComparable) {
+            data.insert(data.end(), member, member + inMemberVariable.memorySize);
+        } else {
+            Common::MemorySerializeStream stream(data, dataBegin);
+            inMemberVariable.rtti->serialize(member, stream);
+        }
+        entries.emplace_back(Entry { &inMemberVariable, inOffset, dataBegin, data.size() - dataBegin });
+    }
+}
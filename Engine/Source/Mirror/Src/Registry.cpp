@@ -56,8 +56,17 @@ namespace Mirror {
 
     Class& Registry::EmplaceClass(const Id& inId, Class::ConstructParams&& inParams)
     {
+        const auto [iter, inserted] = Class::typeToIndexMap.Emplace(inParams.typeInfo->id, static_cast<ClassIndex>(Class::indexedClasses.size()));
+        if (inserted) {
+            Class::indexedClasses.emplace_back(nullptr);
+        }
+        const auto index = iter->second;
+        inParams.index = index;
+
         classes.Emplace(inId, Mirror::Class(std::move(inParams)));
-        return classes.At(inId);
+        auto& clazz = classes.At(inId);
+        Class::indexedClasses[index] = &clazz;
+        return clazz;
     }
 
     Enum& Registry::EmplaceEnum(const Id& inId, Enum::ConstructParams&& inParams)
@@ -68,6 +77,8 @@ namespace Mirror {
 
     void Registry::UnloadClass(const Id& inId) // NOLINT
     {
+        // keep type -> index mapping, a reloaded class reuses its slot
+        Class::indexedClasses[classes.At(inId).index] = nullptr;
         classes.Erase(inId);
     }
 
@@ -3,6 +3,7 @@
 //
 
 #include <string>
+#include <array>
 #include <vector>
 #include <unordered_map>
 
@@ -138,6 +139,53 @@ TEST(AnyTest, DetorTest)
         ASSERT_TRUE(live);
     }
     ASSERT_FALSE(live);
+
+    live = false;
+    {
+        Any a2 = AnyDtorTest(live);
+        ASSERT_TRUE(live);
+        a2 = 1;
+        ASSERT_FALSE(live);
+
+        a2 = AnyDtorTest(live);
+        ASSERT_TRUE(live);
+        a2.Reset();
+        ASSERT_FALSE(live);
+    }
+}
+
+TEST(AnyTest, HolderMemoryTest)
+{
+    const auto isInline = [](const Any& inAny) -> bool {
+        const auto* begin = reinterpret_cast<const uint8_t*>(&inAny);
+        const auto* data = static_cast<const uint8_t*>(inAny.Data());
+        return data >= begin && data < begin + sizeof(Any);
+    };
+
+    const Any a0 = std::array<uint8_t, MIRROR_ANY_INLINE_CAPACITY> {};
+    ASSERT_TRUE(isInline(a0));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(a0.Data()) % alignof(std::max_align_t), 0);
+
+    Any a1 = std::string("inline string");
+    ASSERT_TRUE(isInline(a1));
+    ASSERT_EQ(a1.As<const std::string&>(), "inline string");
+
+    std::array<uint64_t, MIRROR_ANY_INLINE_CAPACITY / sizeof(uint64_t) + 1> large {};
+    large.back() = 42;
+    a1 = large;
+    ASSERT_FALSE(isInline(a1));
+    ASSERT_EQ(a1.MemorySize(), sizeof(large));
+
+    Any a2 = a1;
+    ASSERT_NE(a1.Data(), a2.Data());
+    ASSERT_EQ(a2.As<const decltype(large)&>().back(), 42);
+
+    const Any a3 = std::move(a2);
+    ASSERT_EQ(a3.As<const decltype(large)&>().back(), 42);
+
+    a1 = std::string("value");
+    ASSERT_TRUE(isInline(a1));
+    ASSERT_EQ(a1.As<const std::string&>(), "value");
 }
 
 TEST(AnyTest, CopyCtorTest)
@@ -267,6 +315,21 @@ TEST(AnyTest, MoveAssignTest)
     ASSERT_EQ(a0.TypeId(), a1.TypeId());
 }
 
+TEST(AnyTest, SelfMoveAssignTest)
+{
+    Any a0 = std::string("inline string");
+    Any& r0 = a0;
+    a0 = std::move(r0);
+    ASSERT_EQ(a0.As<const std::string&>(), "inline string");
+
+    std::array<uint64_t, MIRROR_ANY_INLINE_CAPACITY / sizeof(uint64_t) + 1> large {};
+    large.back() = 42;
+    Any a1 = large;
+    Any& r1 = a1;
+    a1 = std::move(r1);
+    ASSERT_EQ(a1.As<const decltype(large)&>().back(), 42);
+}
+
 TEST(AnyTest, ValueCopyAssignTest)
 {
     Any a0 = AnyCopyAssignTest();
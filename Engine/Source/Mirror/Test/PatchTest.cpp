@@ -0,0 +1,135 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <Test/Test.h>
+
+#include <Mirror/Patch.h>
+#include <SerializationTest.h>
+#include <PatchTest.h>
+
+PatchTestMixin::~PatchTestMixin() = default;
+
+TEST(PatchTest, DiffAndApplyTest)
+{
+    const SerializationTestStruct0 base { 1, 2.0f, "3" };
+    SerializationTestStruct0 target = base;
+
+    auto patch = Mirror::ObjectPatch::Diff(base, target);
+    ASSERT_TRUE(patch.Empty());
+    ASSERT_EQ(patch.GetClass(), &Mirror::Class::Get<SerializationTestStruct0>());
+
+    target.a = 4;
+    target.c = "hello";
+    patch = Mirror::ObjectPatch::Diff(base, target);
+    ASSERT_EQ(patch.MemberVariableNum(), 2);
+    ASSERT_TRUE(patch.HasMemberVariable("a"));
+    ASSERT_FALSE(patch.HasMemberVariable("b"));
+    ASSERT_TRUE(patch.HasMemberVariable("c"));
+
+    SerializationTestStruct0 object = base;
+    patch.Apply(object);
+    ASSERT_EQ(object, target);
+}
+
+TEST(PatchTest, BaseClassTest)
+{
+    SerializationTestStruct2 base;
+    base.a = 1;
+    base.b = 2.0f;
+    base.c = "3";
+    base.d = 4.0;
+
+    SerializationTestStruct2 target = base;
+    target.b = 5.0f;
+    target.d = 6.0;
+
+    const auto patch = Mirror::ObjectPatch::Diff(base, target);
+    ASSERT_EQ(patch.MemberVariableNum(), 2);
+    ASSERT_TRUE(patch.HasMemberVariable("b"));
+    ASSERT_TRUE(patch.HasMemberVariable("d"));
+
+    SerializationTestStruct2 object = base;
+    patch.ApplyDyn(Mirror::ForwardAsArg(object));
+    ASSERT_EQ(object, target);
+}
+
+TEST(PatchTest, SerializationTest)
+{
+    const SerializationTestStruct1 base { { 1, 2 }, { "a" }, { { 1, "b" } }, { { true } }, { { 1, 2.0f, "3" } } };
+    SerializationTestStruct1 target = base;
+    target.a.emplace_back(3);
+    target.e[0].c = "4";
+
+    std::vector<uint8_t> buffer;
+    {
+        Common::MemorySerializeStream stream(buffer);
+        Common::Serialize(stream, Mirror::ObjectPatch::Diff(base, target));
+    }
+
+    Mirror::ObjectPatch patch;
+    {
+        Common::MemoryDeserializeStream stream(buffer);
+        Common::Deserialize(stream, patch);
+    }
+    ASSERT_EQ(patch.MemberVariableNum(), 2);
+
+    SerializationTestStruct1 object = base;
+    patch.Apply(object);
+    ASSERT_EQ(object, target);
+}
+
+TEST(PatchTest, BaseClassOffsetTest)
+{
+    PatchTestStruct1 base;
+    base.mixinValue = 1;
+    base.a = 2;
+    base.b = "3";
+    base.c = 4.0;
+
+    PatchTestStruct1 target = base;
+    target.a = 5;
+    target.b = "6";
+    target.c = 7.0;
+
+    // reflected base is the second base class behind vptr, its member variables are not at object begin
+    ASSERT_NE(Mirror::Class::Get<PatchTestStruct1>().GetBaseClassOffset(), 0);
+    const auto patch = Mirror::ObjectPatch::Diff(base, target);
+    ASSERT_EQ(patch.MemberVariableNum(), 3);
+
+    PatchTestStruct1 object = base;
+    patch.Apply(object);
+    ASSERT_EQ(object, target);
+
+    std::vector<uint8_t> buffer;
+    {
+        Common::MemorySerializeStream stream(buffer);
+        Common::Serialize(stream, patch);
+    }
+    Mirror::ObjectPatch restored;
+    {
+        Common::MemoryDeserializeStream stream(buffer);
+        Common::Deserialize(stream, restored);
+    }
+    object = base;
+    restored.ApplyDyn(Mirror::ForwardAsArg(object));
+    ASSERT_EQ(object, target);
+}
+
+TEST(PatchTest, ApplyToDerivedTest)
+{
+    const PatchTestStruct0 base { 1, "2" };
+    const PatchTestStruct0 target { 3, "4" };
+    const auto patch = Mirror::ObjectPatch::Diff(base, target);
+
+    // patch of base class is applied to base class subobject of derived object
+    PatchTestStruct1 object;
+    object.mixinValue = 5;
+    object.a = 1;
+    object.b = "2";
+    object.c = 6.0;
+    patch.ApplyDyn(Mirror::ForwardAsArg(object));
+    ASSERT_EQ(object.mixinValue, 5);
+    ASSERT_EQ(static_cast<const PatchTestStruct0&>(object), target);
+    ASSERT_EQ(object.c, 6.0);
+}
@@ -0,0 +1,43 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+#include <Mirror/Meta.h>
+
+// non-reflected polymorphic mixin placed first, so the reflected base sits behind vptr and mixin members
+struct PatchTestMixin {
+    virtual ~PatchTestMixin();
+
+    int64_t mixinValue = 0;
+};
+
+struct EClass() PatchTestStruct0 {
+    EClassBody(PatchTestStruct0)
+
+    EProperty() int a;
+    EProperty() std::string b;
+
+    bool operator==(const PatchTestStruct0& rhs) const
+    {
+        return a == rhs.a
+            && b == rhs.b;
+    }
+};
+
+struct EClass() PatchTestStruct1 : PatchTestMixin, PatchTestStruct0 {
+    EPolyClassBody(PatchTestStruct1)
+
+    EProperty() double c;
+
+    bool operator==(const PatchTestStruct1& rhs) const
+    {
+        return mixinValue == rhs.mixinValue
+            && PatchTestStruct0::operator==(rhs)
+            && c == rhs.c;
+    }
+};
@@ -248,6 +248,42 @@ TEST(RegistryTest, ClassTest)
         ASSERT_EQ(c2Obj->a, 1);
         ASSERT_EQ(c2Obj->b, 2);
     }
+
+    {
+        const auto& clazz = Mirror::Class::Get<C2>();
+        const auto& constructor = clazz.GetConstructor("const int, const int");
+
+        auto object = clazz.Construct(1, 2);
+        ASSERT_EQ(object.As<const C2&>().a, 1);
+        ASSERT_EQ(object.As<const C2&>().b, 2);
+
+        alignas(C2) uint8_t memory[sizeof(C2)];
+        auto inplaceObject = constructor.InplaceNew(memory, 3, 4);
+        ASSERT_EQ(inplaceObject.As<C2&>().a, 3);
+        ASSERT_EQ(reinterpret_cast<C2*>(memory)->b, 4);
+        clazz.Destruct(inplaceObject.As<C2&>());
+
+        inplaceObject = clazz.InplaceNew(memory, 5, 6);
+        ASSERT_EQ(reinterpret_cast<C2*>(memory)->a, 5);
+        clazz.GetDestructor().Destruct(inplaceObject.As<C2&>());
+    }
+}
+
+TEST(RegistryTest, ClassIndexTest)
+{
+    const auto& c1 = Mirror::Class::Get<C1>();
+    const auto& c2 = Mirror::Class::Get<C2>();
+    ASSERT_NE(c1.GetIndex(), Mirror::classIndexNull);
+    ASSERT_NE(c1.GetIndex(), c2.GetIndex());
+    ASSERT_EQ(&Mirror::Class::GetByIndex(c1.GetIndex()), &c1);
+    ASSERT_EQ(Mirror::Class::FindByIndex(c2.GetIndex()), &c2);
+    ASSERT_EQ(Mirror::Class::FindByIndex(Mirror::classIndexNull), nullptr);
+
+    // second lookup goes through cached index
+    ASSERT_EQ(Mirror::Class::Find<C1>(), &c1);
+    ASSERT_EQ(&Mirror::Class::Get("C1"), &c1);
+    ASSERT_EQ(&Mirror::Class::Get(Mirror::GetTypeInfo<C1>()), &c1);
+    ASSERT_TRUE(Mirror::Class::Has<C2>());
 }
 
 TEST(RegistryTest, EnumTest)
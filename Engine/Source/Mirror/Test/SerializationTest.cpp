@@ -3,6 +3,7 @@
 //
 
 #include <filesystem>
+#include <sstream>
 
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -49,6 +50,61 @@ void PerformSerializationTest(const std::filesystem::path& fileName, const T& ob
         Deserialize(stream, restored);
         ASSERT_EQ(restored, object);
     }
+
+    // seek free framing must produce the same bytes with a pure append stream
+    std::vector<uint8_t> memory;
+    {
+        Common::MemorySerializeStream stream(memory);
+        Serialize(stream, object);
+    }
+    std::ostringstream appendOnly;
+    {
+        Common::OStreamSerializeStream stream(appendOnly);
+        Serialize(stream, object);
+    }
+    const auto appendOnlyBytes = appendOnly.str();
+    ASSERT_EQ(appendOnlyBytes.size(), memory.size());
+    ASSERT_EQ(memcmp(appendOnlyBytes.data(), memory.data(), memory.size()), 0);
+
+    std::vector<uint8_t> varint;
+    size_t serialized;
+    {
+        Common::MemorySerializeStream stream(varint);
+        Common::WriteSerializeHeader(stream, Common::SerializeIntEncoding::varint);
+        serialized = Serialize(stream, object);
+    }
+    ASSERT_LT(varint.size(), memory.size());
+
+    {
+        Common::MemoryDeserializeStream stream(varint);
+        ASSERT_TRUE(Common::ReadSerializeHeader(stream));
+
+        T restored;
+        const auto [success, deserialized] = Deserialize(stream, restored);
+        ASSERT_TRUE(success);
+        ASSERT_EQ(deserialized, serialized);
+        ASSERT_EQ(stream.Loc(), varint.size());
+        ASSERT_EQ(restored, object);
+    }
+
+    std::vector<uint8_t> schema;
+    {
+        Common::SerializeSchemaTable schemaTable;
+        Common::MemorySerializeStream stream(schema);
+        Common::WriteSerializeHeader(stream, Common::SerializeIntEncoding::varint, &schemaTable);
+        Serialize(stream, object);
+        Common::WriteSerializeFooter(stream);
+    }
+
+    {
+        Common::SerializeSchemaTable schemaTable;
+        Common::MemoryDeserializeStream stream(schema);
+        ASSERT_TRUE(Common::ReadSerializeHeader(stream, &schemaTable));
+
+        T restored;
+        ASSERT_TRUE(Deserialize(stream, restored).first);
+        ASSERT_EQ(restored, object);
+    }
 }
 
 template <typename T>
@@ -83,6 +139,19 @@ void PerformJsonSerializationTest(const T& inValue, const std::string& inExceptJ
         Common::JsonDeserialize<T>(jsonValue, value);
         ASSERT_EQ(inValue, value);
     }
+
+    {
+        Common::JsonWriter writer;
+        Common::JsonWrite<T>(writer, inValue);
+        ASSERT_TRUE(writer.IsComplete());
+        ASSERT_EQ(writer.Str(), json);
+
+        Common::JsonReader reader(json);
+        T value;
+        Common::JsonRead<T>(reader, value);
+        ASSERT_EQ(reader.Peek(), Common::JsonTokenType::end);
+        ASSERT_EQ(inValue, value);
+    }
 }
 
 TEST(SerializationTest, VariableFileTest)
@@ -149,6 +218,52 @@ TEST(SerializationTest, MetaObjectWithBaseClassTest)
         SerializationTestStruct2 { { 1, 2, "3.0" }, 4.0 });
 }
 
+TEST(SerializationTest, MetaObjectSchemaTableTest)
+{
+    std::vector<SerializationTestStruct0> objects(1000);
+    for (auto i = 0; i < objects.size(); i++) {
+        objects[i] = { i, static_cast<float>(i) * 0.5f, std::to_string(i) };
+    }
+
+    std::vector<uint8_t> plain;
+    {
+        Common::MemorySerializeStream stream(plain);
+        Common::WriteSerializeHeader(stream, Common::SerializeIntEncoding::varint);
+        Serialize(stream, objects);
+    }
+
+    // record c under a name the reader does not know, as if it was removed since the payload was written
+    const auto& clazz = Class::Get<SerializationTestStruct0>();
+    Common::SerializeSchemaTable layoutTable;
+    auto schema = *layoutTable.Find(Mirror::Internal::FindOrAddSchema(layoutTable, clazz));
+    std::ranges::replace(schema.fieldNames, std::string("c"), std::string("removedC"));
+
+    std::vector<uint8_t> memory;
+    {
+        Common::SerializeSchemaTable schemaTable;
+        Common::MemorySerializeStream stream(memory);
+        Common::WriteSerializeHeader(stream, Common::SerializeIntEncoding::varint, &schemaTable);
+        schemaTable.FindOrAdd(clazz.GetName(), [&]() -> Common::SerializeSchemaTable::Schema { return schema; });
+        Serialize(stream, objects);
+        Common::WriteSerializeFooter(stream);
+        ASSERT_EQ(schemaTable.Num(), 1);
+    }
+    ASSERT_LT(memory.size(), plain.size() * 3 / 5);
+
+    Common::SerializeSchemaTable schemaTable;
+    Common::MemoryDeserializeStream stream(memory);
+    ASSERT_TRUE(Common::ReadSerializeHeader(stream, &schemaTable));
+
+    std::vector<SerializationTestStruct0> restored;
+    ASSERT_TRUE(Deserialize(stream, restored).first);
+    ASSERT_EQ(restored.size(), objects.size());
+    for (auto i = 0; i < objects.size(); i++) {
+        ASSERT_EQ(restored[i].a, objects[i].a);
+        ASSERT_EQ(restored[i].b, objects[i].b);
+        ASSERT_TRUE(restored[i].c.empty());
+    }
+}
+
 TEST(SerializationTest, EnumSerializationTest)
 {
     PerformSerializationTest<SerializationTestEnum>(
@@ -196,6 +311,20 @@ TEST(SerializationTest, MetaObjectSerializationTest)
         "");
 }
 
+TEST(SerializationTest, MetaObjectJsonStreamTest)
+{
+    SerializationTestStruct1 value;
+    value.b = { "1" };
+    value.c = { { 2, "3" } };
+    value.d = { { true } };
+
+    // members are matched by name in any order, unknown ones are skipped and absent ones reset to default
+    Common::JsonReader reader(R"({"zz":[1,{"q":2}],"e":[{"c":"3","a":1,"b":2.0}],"a":[1,2]})");
+    Common::JsonRead(reader, value);
+    ASSERT_EQ(reader.Peek(), Common::JsonTokenType::end);
+    ASSERT_EQ(value, (SerializationTestStruct1 { { 1, 2 }, {}, {}, {}, { SerializationTestStruct0 { 1, 2.0f, "3" } } }));
+}
+
 TEST(SerializationTest, EnumJsonSerializationTest)
 {
     PerformJsonSerializationTest<SerializationTestEnum>(
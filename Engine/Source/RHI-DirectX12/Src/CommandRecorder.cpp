@@ -212,7 +212,7 @@ namespace RHI::DirectX12 {
         , commandBuffer(inCmdBuffer)
     {
         // set render targets
-        std::vector<CD3DX12_CPU_DESCRIPTOR_HANDLE> rtvHandles(inBeginInfo.colorAttachments.size());
+        std::vector<CD3DX12_CPU_DESCRIPTOR_HANDLE> rtvHandles(inBeginInfo.colorAttachments.Size());
         for (auto i = 0; i < rtvHandles.size(); i++) {
             auto* view = static_cast<DX12TextureView*>(inBeginInfo.colorAttachments[i].view);
             Assert(view);
@@ -50,8 +50,8 @@ namespace RHI::DirectX12 {
         desc.AlphaToCoverageEnable = createInfo.multiSampleState.alphaToCoverage;
         desc.IndependentBlendEnable = true;
 
-        Assert(createInfo.fragmentState.colorTargets.size() <= 8);
-        for (auto i = 0; i < createInfo.fragmentState.colorTargets.size(); i++) {
+        Assert(createInfo.fragmentState.colorTargets.Size() <= 8);
+        for (auto i = 0; i < createInfo.fragmentState.colorTargets.Size(); i++) {
             desc.RenderTarget[i] = GetDX12RenderTargetBlendDesc(createInfo.fragmentState.colorTargets[i]);
         }
         return desc;
@@ -97,8 +97,8 @@ namespace RHI::DirectX12 {
     void UpdateDX12RenderTargetsDesc(D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const RasterPipelineCreateInfo& createInfo)
     {
         // have been checked num in function #GetDX12BlendDesc()
-        desc.NumRenderTargets = createInfo.fragmentState.colorTargets.size();
-        for (auto i = 0; i < createInfo.fragmentState.colorTargets.size(); i++) {
+        desc.NumRenderTargets = createInfo.fragmentState.colorTargets.Size();
+        for (auto i = 0; i < createInfo.fragmentState.colorTargets.Size(); i++) {
             desc.RTVFormats[i] = EnumCast<PixelFormat, DXGI_FORMAT>(createInfo.fragmentState.colorTargets[i].format);
         }
     }
@@ -19,7 +19,7 @@ namespace RHI::DirectX12 {
         const auto* commandBuffer = static_cast<DX12CommandBuffer*>(inCmdBuffer);
         Assert(commandBuffer);
 
-        for (auto i = 0; i < inSubmitInfo.waitSemaphores.size(); i++) {
+        for (auto i = 0; i < inSubmitInfo.waitSemaphores.Size(); i++) {
             auto* waitSemaphore = static_cast<DX12Semaphore*>(inSubmitInfo.waitSemaphores[i]);
             Assert(SUCCEEDED(nativeCmdQueue->Wait(waitSemaphore->GetNative(), 1)));
         }
@@ -27,7 +27,7 @@ namespace RHI::DirectX12 {
         std::array<ID3D12CommandList*, 1> cmdListsToExecute = { commandBuffer->GetNative() };
         nativeCmdQueue->ExecuteCommandLists(cmdListsToExecute.size(), cmdListsToExecute.data());
 
-        for (auto i = 0; i < inSubmitInfo.signalSemaphores.size(); i++) {
+        for (auto i = 0; i < inSubmitInfo.signalSemaphores.Size(); i++) {
             auto* signalSemaphore = static_cast<DX12Semaphore*>(inSubmitInfo.signalSemaphores[i]);
             auto* nativeFence = signalSemaphore->GetNative();
             Assert(SUCCEEDED(nativeFence->Signal(0)));
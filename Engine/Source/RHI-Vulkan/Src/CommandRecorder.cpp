@@ -341,8 +341,8 @@ namespace RHI::Vulkan {
         , commandBuffer(inCmdBuffer)
         , rasterPipeline(nullptr)
     {
-        std::vector<VkRenderingAttachmentInfo> colorAttachmentInfos(inBeginInfo.colorAttachments.size());
-        for (size_t i = 0; i < inBeginInfo.colorAttachments.size(); i++)
+        std::vector<VkRenderingAttachmentInfo> colorAttachmentInfos(inBeginInfo.colorAttachments.Size());
+        for (size_t i = 0; i < inBeginInfo.colorAttachments.Size(); i++)
         {
             auto* colorTextureView = static_cast<VulkanTextureView*>(inBeginInfo.colorAttachments[i].view);
             colorAttachmentInfos[i].sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
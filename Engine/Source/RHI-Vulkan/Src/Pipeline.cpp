@@ -99,11 +99,11 @@ namespace RHI::Vulkan {
 
     static VkPipelineColorBlendStateCreateInfo ConstructAttachmentInfo(const RasterPipelineCreateInfo& createInfo, std::vector<VkPipelineColorBlendAttachmentState>& blendStates)
     {
-        blendStates.resize(createInfo.fragmentState.colorTargets.size());
+        blendStates.resize(createInfo.fragmentState.colorTargets.Size());
 
         VkPipelineColorBlendStateCreateInfo colorInfo = {};
         colorInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
-        for (auto i = 0; i < createInfo.fragmentState.colorTargets.size(); ++i) {
+        for (auto i = 0; i < createInfo.fragmentState.colorTargets.Size(); ++i) {
             const auto& srcState = createInfo.fragmentState.colorTargets[i];
             blendStates[i].blendEnable = srcState.blendEnabled ? VK_TRUE : VK_FALSE;
             blendStates[i].colorWriteMask = srcState.writeFlags.Value();
@@ -223,8 +223,8 @@ namespace RHI::Vulkan {
         std::vector<VkVertexInputBindingDescription> bindings;
         VkPipelineVertexInputStateCreateInfo vtxInput = ConstructVertexInput(inCreateInfo, attributes, bindings);
 
-        std::vector<VkFormat> pixelFormats(inCreateInfo.fragmentState.colorTargets.size());
-        for (size_t i = 0; i < inCreateInfo.fragmentState.colorTargets.size(); i++)
+        std::vector<VkFormat> pixelFormats(inCreateInfo.fragmentState.colorTargets.Size());
+        for (size_t i = 0; i < inCreateInfo.fragmentState.colorTargets.Size(); i++)
         {
             auto format = inCreateInfo.fragmentState.colorTargets[i].format;
             pixelFormats[i] = EnumCast<PixelFormat, VkFormat>(format);
@@ -232,7 +232,7 @@ namespace RHI::Vulkan {
 
         VkPipelineRenderingCreateInfo pipelineRenderingCreateInfo;
         pipelineRenderingCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO;
-        pipelineRenderingCreateInfo.colorAttachmentCount = inCreateInfo.fragmentState.colorTargets.size();
+        pipelineRenderingCreateInfo.colorAttachmentCount = inCreateInfo.fragmentState.colorTargets.Size();
         pipelineRenderingCreateInfo.pColorAttachmentFormats = pixelFormats.data();
         pipelineRenderingCreateInfo.depthAttachmentFormat = inCreateInfo.depthStencilState.depthEnabled ? EnumCast<PixelFormat, VkFormat>(inCreateInfo.depthStencilState.format) : VK_FORMAT_UNDEFINED;
         pipelineRenderingCreateInfo.stencilAttachmentFormat = inCreateInfo.depthStencilState.stencilEnabled ? EnumCast<PixelFormat, VkFormat>(inCreateInfo.depthStencilState.format) : VK_FORMAT_UNDEFINED;
@@ -27,17 +27,17 @@ namespace RHI::Vulkan {
 
         std::vector<VkSemaphore> waitSemaphores;
         std::vector<VkPipelineStageFlags> waitStageFlags;
-        waitSemaphores.resize(inSubmitInfo.waitSemaphores.size());
-        waitStageFlags.resize(inSubmitInfo.waitSemaphores.size());
-        for (auto i = 0; i < inSubmitInfo.waitSemaphores.size(); i++) {
+        waitSemaphores.resize(inSubmitInfo.waitSemaphores.Size());
+        waitStageFlags.resize(inSubmitInfo.waitSemaphores.Size());
+        for (auto i = 0; i < inSubmitInfo.waitSemaphores.Size(); i++) {
             const auto* vkSemaphore = static_cast<VulkanSemaphore*>(inSubmitInfo.waitSemaphores[i]);
             waitSemaphores[i] = vkSemaphore->GetNative();
             waitStageFlags[i] = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
         }
 
         std::vector<VkSemaphore> signalSemaphores;
-        signalSemaphores.resize(inSubmitInfo.signalSemaphores.size());
-        for (auto i = 0; i < inSubmitInfo.signalSemaphores.size(); i++) {
+        signalSemaphores.resize(inSubmitInfo.signalSemaphores.Size());
+        for (auto i = 0; i < inSubmitInfo.signalSemaphores.Size(); i++) {
             const auto* vkSemaphore = static_cast<VulkanSemaphore*>(inSubmitInfo.signalSemaphores[i]);
             signalSemaphores[i] = vkSemaphore->GetNative();
         }
@@ -8,6 +8,7 @@
 #include <optional>
 
 #include <Common/Utility.h>
+#include <Common/Container.h>
 #include <Common/Math/Rect.h>
 #include <Common/Math/Color.h>
 #include <RHI/Common.h>
@@ -173,7 +174,7 @@ namespace RHI {
 
     struct RasterPassBeginInfo {
         std::optional<DepthStencilAttachment> depthStencilAttachment;
-        std::vector<ColorAttachment> colorAttachments;
+        Common::SmallVector<ColorAttachment, 8> colorAttachments;
 
         RasterPassBeginInfo();
         RasterPassBeginInfo& SetDepthStencilAttachment(const DepthStencilAttachment& inDepthStencilAttachment);
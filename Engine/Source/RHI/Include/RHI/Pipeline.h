@@ -8,6 +8,7 @@
 #include <variant>
 
 #include <Common/Utility.h>
+#include <Common/Container.h>
 #include <RHI/Common.h>
 
 namespace RHI {
@@ -214,7 +215,7 @@ namespace RHI {
     };
 
     struct FragmentState {
-        std::vector<ColorTargetState> colorTargets;
+        Common::SmallVector<ColorTargetState, 8> colorTargets;
 
         FragmentState();
         FragmentState& AddColorTarget(const ColorTargetState& inState);
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include <Common/Utility.h>
+#include <Common/Container.h>
 
 namespace RHI {
     class CommandBuffer;
@@ -15,8 +16,8 @@ namespace RHI {
     class Semaphore;
 
     struct QueueSubmitInfo {
-        std::vector<Semaphore*> waitSemaphores;
-        std::vector<Semaphore*> signalSemaphores;
+        Common::SmallVector<Semaphore*, 4> waitSemaphores;
+        Common::SmallVector<Semaphore*, 4> signalSemaphores;
         Fence* signalFence;
 
         QueueSubmitInfo();
@@ -186,7 +186,7 @@ namespace RHI {
 
     RasterPassBeginInfo& RasterPassBeginInfo::AddColorAttachment(const ColorAttachment& inColorAttachment)
     {
-        colorAttachments.emplace_back(inColorAttachment);
+        colorAttachments.EmplaceBack(inColorAttachment);
         return *this;
     }
 
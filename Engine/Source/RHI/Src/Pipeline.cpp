@@ -318,19 +318,17 @@ namespace RHI {
 
     FragmentState& FragmentState::AddColorTarget(const ColorTargetState& inState)
     {
-        colorTargets.emplace_back(inState);
+        colorTargets.EmplaceBack(inState);
         return *this;
     }
 
     size_t FragmentState::Hash() const
     {
-        std::vector<size_t> values;
-        values.reserve(colorTargets.size());
-
+        Common::Hasher hasher;
         for (const auto& colorTarget : colorTargets) {
-            values.emplace_back(colorTarget.Hash());
+            hasher.Update(colorTarget.Hash());
         }
-        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(size_t));
+        return hasher.Finish();
     }
 
     ComputePipelineCreateInfo::ComputePipelineCreateInfo()
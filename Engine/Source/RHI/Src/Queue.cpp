@@ -12,13 +12,13 @@ namespace RHI {
 
     QueueSubmitInfo& QueueSubmitInfo::AddWaitSemaphore(Semaphore* inSemaphore)
     {
-        waitSemaphores.emplace_back(inSemaphore);
+        waitSemaphores.EmplaceBack(inSemaphore);
         return *this;
     }
 
     QueueSubmitInfo& QueueSubmitInfo::AddSignalSemaphore(Semaphore* inSemaphore)
     {
-        signalSemaphores.emplace_back(inSemaphore);
+        signalSemaphores.EmplaceBack(inSemaphore);
         return *this;
     }
 
@@ -30,13 +30,13 @@ namespace RHI {
 
     QueueSubmitInfo& QueueSubmitInfo::SetWaitSemaphores(const std::vector<Semaphore*>& inSemaphores)
     {
-        waitSemaphores = inSemaphores;
+        waitSemaphores = { inSemaphores.begin(), inSemaphores.end() };
         return *this;
     }
 
     QueueSubmitInfo& QueueSubmitInfo::SetSignalSemaphores(const std::vector<Semaphore*>& inSemaphores)
     {
-        signalSemaphores = inSemaphores;
+        signalSemaphores = { inSemaphores.begin(), inSemaphores.end() };
         return *this;
     }
 
@@ -6,6 +6,8 @@
 
 #include <unordered_map>
 
+#include <Common/Container.h>
+#include <Common/Concurrent.h>
 #include <RHI/RHI.h>
 #include <Render/Shader.h>
 
@@ -225,22 +227,32 @@ namespace Render {
         Common::UniqueRef<RHI::RasterPipeline> rhiHandle;
     };
 
+    // render caches are safe to use from parallel pass recording threads. eviction only happens in Tick(), which should be called
+    // once per frame by the frame owner, entries used by in flight frames are retained. capacity and max idle frames of 0 disable eviction
     class SamplerCache {
     public:
+        static constexpr size_t defaultCapacity = 1024;
+
         static SamplerCache& Get(RHI::Device& device);
         ~SamplerCache();
 
         Sampler* GetOrCreate(const RSamplerDesc& desc);
+        void Tick();
+        void SetCapacity(size_t inCapacity);
+        void SetMaxIdleFrames(uint64_t inMaxIdleFrames);
+        Common::CacheStats GetStats() const;
 
     private:
         explicit SamplerCache(RHI::Device& inDevice);
 
         RHI::Device& device;
-        std::unordered_map<size_t, Common::UniqueRef<Sampler>> samplers;
+        Common::ShardedLruCache<size_t, Common::UniqueRef<Sampler>> samplers;
     };
 
     class PipelineCache {
     public:
+        static constexpr size_t defaultCapacity = 4096;
+
         static PipelineCache& Get(RHI::Device& device);
         ~PipelineCache();
 
@@ -248,17 +260,25 @@ namespace Render {
         void Invalidate();
         ComputePipelineState* GetOrCreate(const ComputePipelineStateDesc& desc);
         RasterPipelineState* GetOrCreate(const RasterPipelineStateDesc& desc);
+        void Tick();
+        // capacity is applied to compute and raster pipelines separately
+        void SetCapacity(size_t inCapacity);
+        void SetMaxIdleFrames(uint64_t inMaxIdleFrames);
+        Common::CacheStats GetStats() const;
 
     private:
         explicit PipelineCache(RHI::Device& inDevice);
 
         RHI::Device& device;
-        std::unordered_map<size_t, Common::UniqueRef<ComputePipelineState>> computePipelines;
-        std::unordered_map<size_t, Common::UniqueRef<RasterPipelineState>> rasterPipelines;
+        Common::ShardedLruCache<size_t, Common::UniqueRef<ComputePipelineState>> computePipelines;
+        Common::ShardedLruCache<size_t, Common::UniqueRef<RasterPipelineState>> rasterPipelines;
     };
 
     class ResourceViewCache {
     public:
+        // counted by resources, all views of an evicted resource are released together
+        static constexpr size_t defaultCapacity = 8192;
+
         static ResourceViewCache& Get(RHI::Device& device);
         ~ResourceViewCache();
 
@@ -267,12 +287,17 @@ namespace Render {
         void Invalidate(RHI::Texture* texture);
         RHI::BufferView* GetOrCreate(RHI::Buffer* buffer, const RHI::BufferViewCreateInfo& inDesc);
         RHI::TextureView* GetOrCreate(RHI::Texture* texture, const RHI::TextureViewCreateInfo& inDesc);
+        void Tick();
+        // capacity is applied to buffers and textures separately
+        void SetCapacity(size_t inCapacity);
+        void SetMaxIdleFrames(uint64_t inMaxIdleFrames);
+        Common::CacheStats GetStats() const;
 
     private:
         explicit ResourceViewCache(RHI::Device& inDevice);
 
         RHI::Device& device;
-        std::unordered_map<RHI::Buffer*, std::unordered_map<size_t, Common::UniqueRef<RHI::BufferView>>> bufferViews;
-        std::unordered_map<RHI::Texture*, std::unordered_map<size_t, Common::UniqueRef<RHI::TextureView>>> textureViews;
+        Common::ShardedLruCache<RHI::Buffer*, Common::FlatHashMap<size_t, Common::UniqueRef<RHI::BufferView>>> bufferViews;
+        Common::ShardedLruCache<RHI::Texture*, Common::FlatHashMap<size_t, Common::UniqueRef<RHI::TextureView>>> textureViews;
     };
 }
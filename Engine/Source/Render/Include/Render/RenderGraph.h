@@ -9,6 +9,8 @@
 #include <optional>
 
 #include <Common/Memory.h>
+#include <Common/Allocator.h>
+#include <Common/Container.h>
 #include <RHI/RHI.h>
 #include <Render/ResourcePool.h>
 #include <Render/RenderCache.h>
@@ -188,7 +190,7 @@ namespace Render {
     };
 
     struct RGRasterPassDesc {
-        std::vector<RGColorAttachment> colorAttachments;
+        Common::SmallVector<RGColorAttachment, 8> colorAttachments;
         std::optional<RGDepthStencilAttachment> depthStencilAttachment;
 
         RGRasterPassDesc& AddColorAttachment(const RGColorAttachment& inAttachment);
@@ -357,26 +359,39 @@ namespace Render {
         void TransitionResourcesForBindGroups(RHI::CommandCommandRecorder& inRecoder, const std::vector<RGBindGroupRef>& inBindGroups);
         void TransitionBuffer(RHI::CommandCommandRecorder& inRecoder, RGBufferRef inBuffer, RHI::BufferState inState);
         void TransitionTexture(RHI::CommandCommandRecorder& inRecoder, RGTextureRef inTexture, RHI::TextureState inState);
+        template <typename T, typename... Args> T* NewObject(Args&&... inArgs);
+
+        template <typename T> using ArenaVector = std::vector<T, Common::ArenaAllocator<T>>;
 
         bool executed;
         RHI::Device& device;
-        std::vector<Common::UniqueRef<RGResource>> resources;
-        std::vector<Common::UniqueRef<RGResourceView>> views;
-        std::vector<Common::UniqueRef<RGBindGroup>> bindGroups;
-        std::vector<Common::UniqueRef<RGPass>> passes;
+        // graph objects live in builder's arena, and will be destructed with builder
+        Common::LinearAllocator allocator;
+        ArenaVector<RGResourceRef> resources;
+        ArenaVector<RGResourceViewRef> views;
+        ArenaVector<RGBindGroupRef> bindGroups;
+        ArenaVector<RGPassRef> passes;
         std::unordered_map<RGQueueType, std::vector<RGPassRef>> recordingAsyncTimeline;
         std::vector<std::unordered_map<RGQueueType, std::vector<RGPassRef>>> asyncTimelines;
 
         // execute context
-        std::unordered_map<RGResourceRef, uint32_t> resourceReadCounts;
+        Common::FlatHashMap<RGResourceRef, uint32_t> resourceReadCounts;
         std::unordered_map<RGPassRef, std::unordered_set<RGResourceRef>> passReadsMap;
         std::unordered_map<RGPassRef, std::unordered_set<RGResourceRef>> passWritesMap;
-        std::unordered_set<RGResourceRef> culledResources;
-        std::unordered_set<RGPassRef> culledPasses;
-        std::unordered_map<RGResourceRef, std::variant<RHI::BufferState, RHI::TextureState>> resourceStates;
+        Common::FlatHashSet<RGResourceRef> culledResources;
+        Common::FlatHashSet<RGPassRef> culledPasses;
+        Common::FlatHashMap<RGResourceRef, std::variant<RHI::BufferState, RHI::TextureState>> resourceStates;
         std::vector<AsyncTimelineExecuteContext> asyncTimelineExecuteContexts;
-        std::unordered_map<RGResourceRef, std::variant<PooledBufferRef, PooledTextureRef>> devirtualizedResources;
-        std::unordered_map<RGResourceViewRef, std::variant<RHI::BufferView*, RHI::TextureView*>> devirtualizedResourceViews;
-        std::unordered_map<RGBindGroupRef, Common::UniqueRef<RHI::BindGroup>> devirtualizedBindGroups;
+        Common::FlatHashMap<RGResourceRef, std::variant<PooledBufferRef, PooledTextureRef>> devirtualizedResources;
+        Common::FlatHashMap<RGResourceViewRef, std::variant<RHI::BufferView*, RHI::TextureView*>> devirtualizedResourceViews;
+        Common::FlatHashMap<RGBindGroupRef, Common::UniqueRef<RHI::BindGroup>> devirtualizedBindGroups;
     };
 }
+
+namespace Render {
+    template <typename T, typename... Args>
+    T* RGBuilder::NewObject(Args&&... inArgs)
+    {
+        return new(allocator.Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(inArgs)...);
+    }
+}
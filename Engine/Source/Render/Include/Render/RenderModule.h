@@ -6,6 +6,7 @@
 
 #include <Common/Memory.h>
 #include <Common/Concurrent.h>
+#include <Common/Coroutine.h>
 #include <Common/Debug.h>
 #include <Core/Module.h>
 #include <Render/Scene.h>
@@ -33,7 +34,13 @@ namespace Render {
         Common::UniqueRef<Scene> NewScene();
         Common::UniqueRef<View> NewView();
         void ShutdownRenderingThread();
+        // called by frame owner once per frame after all rendering commands of the frame are enqueued
+        void EndFrame();
         void FlushAllRenderingCommands() const;
+        // co_await SwitchToRenderingThread() to continue the coroutine in rendering thread
+        Common::WorkerThreadAwaiter SwitchToRenderingThread() const;
+        // non-blocking version of FlushAllRenderingCommands(), coroutine will be resumed in task executor
+        Common::WorkerThreadAwaiter WaitAllRenderingCommands() const;
 
         template <typename F, typename... Args>
         auto EnqueueRenderingCommand(F&& command, Args&&... args)
@@ -42,6 +49,13 @@ namespace Render {
             return renderingThread->EmplaceTask(std::forward<F>(command), std::forward<Args>(args)...);
         }
 
+        template <typename F, typename... Args>
+        void DispatchRenderingCommand(F&& command, Args&&... args)
+        {
+            Assert(renderingThread != nullptr);
+            renderingThread->DispatchTask(std::forward<F>(command), std::forward<Args>(args)...);
+        }
+
     private:
         bool initialized;
         Common::UniqueRef<Common::WorkerThread> renderingThread;
@@ -16,12 +16,12 @@ namespace Render {
     struct RHIResTraits {};
 
     template <typename RHIRes>
-    class PooledResource {
+    class PooledResource : public Common::RefCounted {
     public:
         using DescType = typename RHIResTraits<RHIRes>::DescType;
 
         explicit PooledResource(Common::UniqueRef<RHIRes>&& inRhiHandle, DescType inDesc);
-        ~PooledResource();
+        ~PooledResource() override;
 
         RHIRes* GetRHI() const;
         const DescType& GetDesc() const;
@@ -35,8 +35,8 @@ namespace Render {
     using PooledTexture = PooledResource<RHI::Texture>;
     using PooledBufferDesc = RHI::BufferCreateInfo;
     using PooledTextureDesc = RHI::TextureCreateInfo;
-    using PooledBufferRef = Common::SharedRef<PooledBuffer>;
-    using PooledTextureRef = Common::SharedRef<PooledTexture>;
+    using PooledBufferRef = Common::IntrusiveRef<PooledBuffer>;
+    using PooledTextureRef = Common::IntrusiveRef<PooledTexture>;
 
     template <typename PooledRes>
     struct PooledResTraits {};
@@ -143,7 +143,8 @@ namespace Render {
     typename RGResourcePool<PooledResource>::ResRefType RGResourcePool<PooledResource>::Allocate(const DescType& desc)
     {
         for (const auto& pooledResource : pooledResources) {
-            if (pooledResource.RefCount() == 1 && desc == pooledResource->GetDesc()) {
+            // only referenced by pool itself
+            if (pooledResource.IsUnique() && desc == pooledResource->GetDesc()) {
                 return pooledResource;
             }
         }
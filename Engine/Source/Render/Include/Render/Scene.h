@@ -24,6 +24,7 @@ namespace Render {
 
         LightSPH AddLight(LightSceneProxy&& inLight);
         void RemoveLight(const LightSPH& inHandle);
+        const LightSPPool& GetLights() const;
 
     private:
         LightSPPool lights;
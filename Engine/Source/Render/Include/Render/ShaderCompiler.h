@@ -9,7 +9,7 @@
 
 #include <RHI/Common.h>
 #include <Render/Shader.h>
-#include <Common/Concurrent.h>
+#include <Common/TaskGraph.h>
 
 namespace Render {
     enum class ShaderByteCodeType {
@@ -51,12 +51,10 @@ namespace Render {
     public:
         static ShaderCompiler& Get();
         ~ShaderCompiler();
-        std::future<ShaderCompileOutput> Compile(const ShaderCompileInput& inInput, const ShaderCompileOptions& inOptions);
+        Common::TaskFuture<ShaderCompileOutput> Compile(const ShaderCompileInput& inInput, const ShaderCompileOptions& inOptions);
 
     private:
         ShaderCompiler();
-
-        Common::ThreadPool threadPool;
     };
 
     class ShaderTypeCompiler {
@@ -64,12 +62,10 @@ namespace Render {
         static ShaderTypeCompiler& Get();
         ~ShaderTypeCompiler();
 
-        std::future<ShaderTypeCompileResult> Compile(const std::vector<IShaderType*>& inShaderTypes, const ShaderCompileOptions& inOptions);
-        std::future<ShaderTypeCompileResult> CompileGlobalShaderTypes(const ShaderCompileOptions& inOptions);
+        Common::TaskFuture<ShaderTypeCompileResult> Compile(const std::vector<IShaderType*>& inShaderTypes, const ShaderCompileOptions& inOptions);
+        Common::TaskFuture<ShaderTypeCompileResult> CompileGlobalShaderTypes(const ShaderCompileOptions& inOptions);
 
     private:
         ShaderTypeCompiler();
-
-        Common::ThreadPool threadPool;
     };
 }
@@ -4,6 +4,7 @@
 
 #include <Core/Thread.h>
 #include <Render/RenderModule.h>
+#include <Render/RenderCache.h>
 #include <Render/Scene.h>
 
 namespace Render {
@@ -35,7 +36,7 @@ namespace Render {
         Assert(!initialized);
 
         renderingThread = Common::MakeUnique<Common::WorkerThread>("RenderingThread");
-        renderingThread->EmplaceTask([]() -> void { Core::ThreadContext::SetTag(Core::ThreadTag::render); });
+        renderingThread->DispatchTask([]() -> void { Core::ThreadContext::SetTag(Core::ThreadTag::render); });
 
         rhiInstance = RHI::Instance::GetByType(inParams.rhiType);
         rhiDevice = rhiInstance->GetGpu(0)->RequestDevice(
@@ -75,11 +76,34 @@ namespace Render {
         renderingThread = nullptr;
     }
 
+    void RenderModule::EndFrame()
+    {
+        Assert(renderingThread != nullptr && rhiDevice != nullptr);
+        // render caches advance frame and evict in rendering thread, after all commands of this frame
+        renderingThread->DispatchTask([device = rhiDevice.Get()]() -> void {
+            SamplerCache::Get(*device).Tick();
+            PipelineCache::Get(*device).Tick();
+            ResourceViewCache::Get(*device).Tick();
+        });
+    }
+
     void RenderModule::FlushAllRenderingCommands() const
     {
         Assert(renderingThread != nullptr);
         renderingThread->Flush();
     }
+
+    Common::WorkerThreadAwaiter RenderModule::SwitchToRenderingThread() const
+    {
+        Assert(renderingThread != nullptr);
+        return Common::SwitchTo(*renderingThread);
+    }
+
+    Common::WorkerThreadAwaiter RenderModule::WaitAllRenderingCommands() const
+    {
+        Assert(renderingThread != nullptr);
+        return Common::WaitForFlush(*renderingThread);
+    }
 }
 
 IMPLEMENT_DYNAMIC_MODULE(RENDER_API, Render::RenderModule);
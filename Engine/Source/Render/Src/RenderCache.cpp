@@ -9,6 +9,7 @@
 #include <Common/IO.h>
 
 namespace Render {
+    // pipeline states hold raw pointers to layouts, so layouts are never evicted
     class PipelineLayoutCache {
     public:
         static PipelineLayoutCache& Get(RHI::Device& device);
@@ -20,29 +21,49 @@ namespace Render {
         PipelineLayout* GetLayout(const D& desc)
         {
             auto hash = desc.Hash();
-            auto iter = pipelineLayouts.find(hash);
-            if (iter == pipelineLayouts.end()) {
-                pipelineLayouts[hash] = Common::UniqueRef<PipelineLayout>(new PipelineLayout(device, desc, hash));
-            }
-            return pipelineLayouts[hash].Get();
+            return pipelineLayouts.GetOrCreate(hash, [&]() -> Common::UniqueRef<PipelineLayout> {
+                return Common::UniqueRef<PipelineLayout>(new PipelineLayout(device, desc, hash));
+            }).Get();
         }
 
     private:
         explicit PipelineLayoutCache(RHI::Device& inDevice);
 
         RHI::Device& device;
-        std::unordered_map<size_t, Common::UniqueRef<PipelineLayout>> pipelineLayouts;
+        Common::ShardedLruCache<size_t, Common::UniqueRef<PipelineLayout>> pipelineLayouts;
     };
 
-    PipelineLayoutCache& PipelineLayoutCache::Get(RHI::Device& device)
+    static std::mutex& GetRenderCacheRegistryMutex()
     {
-        static std::unordered_map<RHI::Device*, Common::UniqueRef<PipelineLayoutCache>> map;
+        static std::mutex mutex;
+        return mutex;
+    }
 
-        if (const auto iter = map.find(&device);
-            iter == map.end()) {
-            map[&device] = Common::UniqueRef(new PipelineLayoutCache(device));
+    template <typename C>
+    static C& GetOrCreateRenderCache(std::unordered_map<RHI::Device*, Common::UniqueRef<C>>& inMap, RHI::Device& inDevice, C*(*inCreator)(RHI::Device&))
+    {
+        std::unique_lock lock(GetRenderCacheRegistryMutex());
+        auto& cache = inMap[&inDevice];
+        if (cache == nullptr) {
+            cache = Common::UniqueRef<C>(inCreator(inDevice));
         }
-        return *map[&device];
+        return *cache;
+    }
+
+    static Common::CacheStats CombineCacheStats(const Common::CacheStats& inLhs, const Common::CacheStats& inRhs)
+    {
+        return {
+            inLhs.hits + inRhs.hits,
+            inLhs.misses + inRhs.misses,
+            inLhs.evictions + inRhs.evictions,
+            inLhs.size + inRhs.size
+        };
+    }
+
+    PipelineLayoutCache& PipelineLayoutCache::Get(RHI::Device& device)
+    {
+        static std::unordered_map<RHI::Device*, Common::UniqueRef<PipelineLayoutCache>> map;
+        return GetOrCreateRenderCache<PipelineLayoutCache>(map, device, [](RHI::Device& inDevice) -> PipelineLayoutCache* { return new PipelineLayoutCache(inDevice); });
     }
 
     PipelineLayoutCache::PipelineLayoutCache(RHI::Device& inDevice)
@@ -54,7 +75,7 @@ namespace Render {
 
     void PipelineLayoutCache::Invalidate()
     {
-        pipelineLayouts.clear();
+        pipelineLayouts.Clear();
     }
 }
 
@@ -86,12 +107,11 @@ namespace Render {
 
     size_t RVertexBinding::Hash() const
     {
-        // NOTICE: string can not use city hash for this ptr, cause can be change every time allocated
-        const std::vector values = {
-            Common::HashUtils::CityHash(semanticName.data(), semanticName.size()),
-            static_cast<size_t>(semanticIndex)
-        };
-        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(size_t));
+        // NOTICE: string can not be hashed by this ptr, cause can be change every time allocated
+        return Common::Hasher()
+            .Update(semanticName)
+            .Update(semanticIndex)
+            .Finish();
     }
 
     RVertexAttribute::RVertexAttribute(const RVertexBinding& inBinding, RHI::VertexFormat inFormat, size_t inOffset)
@@ -108,12 +128,11 @@ namespace Render {
 
     size_t RVertexAttribute::Hash() const
     {
-        const std::vector values = {
-            binding.Hash(),
-            static_cast<size_t>(format),
-            offset
-        };
-        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(size_t));
+        return Common::Hasher()
+            .Update(binding.Hash())
+            .Update(format)
+            .Update(offset)
+            .Finish();
     }
 
     RHI::VertexAttribute RVertexAttribute::GetRHI(const Render::ShaderReflectionData& inReflectionData) const
@@ -144,13 +163,11 @@ namespace Render {
 
     size_t RVertexBufferLayout::Hash() const
     {
-        std::vector<size_t> values;
-        values.reserve(attributes.size());
-
+        Common::Hasher hasher;
         for (const auto& attribute : attributes) {
-            values.emplace_back(attribute.Hash());
+            hasher.Update(attribute.Hash());
         }
-        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(size_t));
+        return hasher.Finish();
     }
 
     RVertexState::RVertexState() = default;
@@ -173,13 +190,11 @@ namespace Render {
 
     size_t RVertexState::Hash() const
     {
-        std::vector<size_t> values;
-        values.reserve(bufferLayouts.size());
-
+        Common::Hasher hasher;
         for (const auto& layout : bufferLayouts) {
-            values.emplace_back(layout.Hash());
+            hasher.Update(layout.Hash());
         }
-        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(size_t));
+        return hasher.Finish();
     }
 
     size_t ComputePipelineShaderSet::Hash() const
@@ -189,14 +204,13 @@ namespace Render {
 
     size_t RasterPipelineShaderSet::Hash() const
     {
-        const std::vector values = {
-            vertexShader.Hash(),
-            pixelShader.Hash(),
-            geometryShader.Hash(),
-            domainShader.Hash(),
-            hullShader.Hash()
-        };
-        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(size_t));
+        return Common::Hasher()
+            .Update(vertexShader.Hash())
+            .Update(pixelShader.Hash())
+            .Update(geometryShader.Hash())
+            .Update(domainShader.Hash())
+            .Update(hullShader.Hash())
+            .Finish();
     }
 
     size_t ComputePipelineLayoutDesc::Hash() const
@@ -278,15 +292,14 @@ namespace Render {
 
     size_t RasterPipelineStateDesc::Hash() const
     {
-        const std::vector values = {
-            shaders.Hash(),
-            vertexState.Hash(),
-            primitiveState.Hash(),
-            depthStencilState.Hash(),
-            multiSampleState.Hash(),
-            fragmentState.Hash()
-        };
-        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(size_t));
+        return Common::Hasher()
+            .Update(shaders.Hash())
+            .Update(vertexState.Hash())
+            .Update(primitiveState.Hash())
+            .Update(depthStencilState.Hash())
+            .Update(multiSampleState.Hash())
+            .Update(fragmentState.Hash())
+            .Finish();
     }
 
     Sampler::Sampler(RHI::Device& inDevice, const RSamplerDesc& inDesc)
@@ -501,16 +514,12 @@ namespace Render {
     SamplerCache& SamplerCache::Get(RHI::Device& device)
     {
         static std::unordered_map<RHI::Device*, Common::UniqueRef<SamplerCache>> map;
-
-        const auto iter = map.find(&device);
-        if (iter == map.end()) {
-            map[&device] = Common::UniqueRef(new SamplerCache(device));
-        }
-        return *map[&device];
+        return GetOrCreateRenderCache<SamplerCache>(map, device, [](RHI::Device& inDevice) -> SamplerCache* { return new SamplerCache(inDevice); });
     }
 
     SamplerCache::SamplerCache(RHI::Device& inDevice)
         : device(inDevice)
+        , samplers(defaultCapacity)
     {
     }
 
@@ -519,26 +528,41 @@ namespace Render {
     Sampler* SamplerCache::GetOrCreate(const RSamplerDesc& desc)
     {
         const size_t hash = Common::HashUtils::CityHash(&desc, sizeof(RSamplerDesc));
-        if (const auto iter = samplers.find(hash);
-            iter == samplers.end()) {
-            samplers[hash] = Common::UniqueRef(new Sampler(device, desc));
-        }
-        return samplers[hash].Get();
+        return samplers.GetOrCreate(hash, [&]() -> Common::UniqueRef<Sampler> {
+            return Common::UniqueRef(new Sampler(device, desc));
+        }).Get();
+    }
+
+    void SamplerCache::Tick()
+    {
+        samplers.Tick();
+    }
+
+    void SamplerCache::SetCapacity(size_t inCapacity)
+    {
+        samplers.SetCapacity(inCapacity);
+    }
+
+    void SamplerCache::SetMaxIdleFrames(uint64_t inMaxIdleFrames)
+    {
+        samplers.SetMaxIdleFrames(inMaxIdleFrames);
+    }
+
+    Common::CacheStats SamplerCache::GetStats() const
+    {
+        return samplers.GetStats();
     }
 
     PipelineCache& PipelineCache::Get(RHI::Device& device)
     {
         static std::unordered_map<RHI::Device*, Common::UniqueRef<PipelineCache>> map;
-
-        if (const auto iter = map.find(&device);
-            iter == map.end()) {
-            map[&device] = Common::UniqueRef(new PipelineCache(device));
-        }
-        return *map[&device];
+        return GetOrCreateRenderCache<PipelineCache>(map, device, [](RHI::Device& inDevice) -> PipelineCache* { return new PipelineCache(inDevice); });
     }
 
     PipelineCache::PipelineCache(RHI::Device& inDevice)
         : device(inDevice)
+        , computePipelines(defaultCapacity)
+        , rasterPipelines(defaultCapacity)
     {
     }
 
@@ -546,43 +570,60 @@ namespace Render {
 
     void PipelineCache::Invalidate()
     {
-        computePipelines.clear();
-        rasterPipelines.clear();
+        computePipelines.Clear();
+        rasterPipelines.Clear();
         PipelineLayoutCache::Get(device).Invalidate();
     }
 
     ComputePipelineState* PipelineCache::GetOrCreate(const ComputePipelineStateDesc& desc)
     {
         const auto hash = desc.Hash();
-        if (const auto iter = computePipelines.find(hash);
-            iter == computePipelines.end()) {
-            computePipelines[hash] = Common::UniqueRef(new ComputePipelineState(device, desc, hash));
-        }
-        return computePipelines[hash].Get();
+        return computePipelines.GetOrCreate(hash, [&]() -> Common::UniqueRef<ComputePipelineState> {
+            return Common::UniqueRef(new ComputePipelineState(device, desc, hash));
+        }).Get();
     }
 
     RasterPipelineState* PipelineCache::GetOrCreate(const RasterPipelineStateDesc& desc)
     {
         const auto hash = desc.Hash();
-        if (const auto iter = rasterPipelines.find(hash);
-            iter == rasterPipelines.end()) {
-            rasterPipelines[hash] = Common::UniqueRef(new RasterPipelineState(device, desc, hash));
-        }
-        return rasterPipelines[hash].Get();
+        return rasterPipelines.GetOrCreate(hash, [&]() -> Common::UniqueRef<RasterPipelineState> {
+            return Common::UniqueRef(new RasterPipelineState(device, desc, hash));
+        }).Get();
+    }
+
+    void PipelineCache::Tick()
+    {
+        computePipelines.Tick();
+        rasterPipelines.Tick();
+    }
+
+    void PipelineCache::SetCapacity(size_t inCapacity)
+    {
+        computePipelines.SetCapacity(inCapacity);
+        rasterPipelines.SetCapacity(inCapacity);
+    }
+
+    void PipelineCache::SetMaxIdleFrames(uint64_t inMaxIdleFrames)
+    {
+        computePipelines.SetMaxIdleFrames(inMaxIdleFrames);
+        rasterPipelines.SetMaxIdleFrames(inMaxIdleFrames);
+    }
+
+    Common::CacheStats PipelineCache::GetStats() const
+    {
+        return CombineCacheStats(computePipelines.GetStats(), rasterPipelines.GetStats());
     }
 
     ResourceViewCache& ResourceViewCache::Get(RHI::Device& device)
     {
         static std::unordered_map<RHI::Device*, Common::UniqueRef<ResourceViewCache>> map;
-
-        if (!map.contains(&device)) {
-            map.emplace(std::make_pair(&device, Common::UniqueRef(new ResourceViewCache(device))));
-        }
-        return *map.at(&device);
+        return GetOrCreateRenderCache<ResourceViewCache>(map, device, [](RHI::Device& inDevice) -> ResourceViewCache* { return new ResourceViewCache(inDevice); });
     }
 
     ResourceViewCache::ResourceViewCache(RHI::Device& inDevice)
         : device(inDevice)
+        , bufferViews(defaultCapacity)
+        , textureViews(defaultCapacity)
     {
     }
 
@@ -590,47 +631,65 @@ namespace Render {
 
     void ResourceViewCache::Invalidate()
     {
-        bufferViews.clear();
-        textureViews.clear();
+        bufferViews.Clear();
+        textureViews.Clear();
     }
 
     void ResourceViewCache::Invalidate(RHI::Buffer* buffer) // NOLINT
     {
-        if (const auto iter = bufferViews.find(buffer);
-            iter != bufferViews.end()) {
-            iter->second.clear();
-        }
+        bufferViews.Erase(buffer);
     }
 
     void ResourceViewCache::Invalidate(RHI::Texture* texture) // NOLINT
     {
-        if (const auto iter = textureViews.find(texture);
-            iter != textureViews.end()) {
-            iter->second.clear();
-        }
+        textureViews.Erase(texture);
     }
 
     RHI::BufferView* ResourceViewCache::GetOrCreate(RHI::Buffer* buffer, const RHI::BufferViewCreateInfo& inDesc)
     {
-        auto& views = bufferViews[buffer];
-
-        auto hash = inDesc.Hash();
-        if (const auto iter = views.find(hash);
-            iter == views.end()) {
-            views.emplace(std::make_pair(hash, Common::UniqueRef(buffer->CreateBufferView(inDesc))));
-        }
-        return views.at(hash).Get();
+        using ViewMap = Common::FlatHashMap<size_t, Common::UniqueRef<RHI::BufferView>>;
+        // views of one buffer are stored together, inner map is mutated with the shard locked
+        return bufferViews.Visit(buffer, []() -> ViewMap { return {}; }, [&](ViewMap& views) -> RHI::BufferView* {
+            auto [iter, inserted] = views.Emplace(inDesc.Hash());
+            if (inserted) {
+                iter->second = Common::UniqueRef(buffer->CreateBufferView(inDesc));
+            }
+            return iter->second.Get();
+        });
     }
 
     RHI::TextureView* ResourceViewCache::GetOrCreate(RHI::Texture* texture, const RHI::TextureViewCreateInfo& inDesc)
     {
-        auto& views = textureViews[texture];
+        using ViewMap = Common::FlatHashMap<size_t, Common::UniqueRef<RHI::TextureView>>;
+        return textureViews.Visit(texture, []() -> ViewMap { return {}; }, [&](ViewMap& views) -> RHI::TextureView* {
+            auto [iter, inserted] = views.Emplace(inDesc.Hash());
+            if (inserted) {
+                iter->second = Common::UniqueRef(texture->CreateTextureView(inDesc));
+            }
+            return iter->second.Get();
+        });
+    }
 
-        auto hash = inDesc.Hash();
-        if (const auto iter = views.find(hash);
-            iter == views.end()) {
-            views.emplace(std::make_pair(hash, Common::UniqueRef(texture->CreateTextureView(inDesc))));
-        }
-        return views.at(hash).Get();
+    void ResourceViewCache::Tick()
+    {
+        bufferViews.Tick();
+        textureViews.Tick();
+    }
+
+    void ResourceViewCache::SetCapacity(size_t inCapacity)
+    {
+        bufferViews.SetCapacity(inCapacity);
+        textureViews.SetCapacity(inCapacity);
+    }
+
+    void ResourceViewCache::SetMaxIdleFrames(uint64_t inMaxIdleFrames)
+    {
+        bufferViews.SetMaxIdleFrames(inMaxIdleFrames);
+        textureViews.SetMaxIdleFrames(inMaxIdleFrames);
+    }
+
+    Common::CacheStats ResourceViewCache::GetStats() const
+    {
+        return CombineCacheStats(bufferViews.GetStats(), textureViews.GetStats());
     }
 }
@@ -6,6 +6,7 @@
 
 #include <Render/RenderGraph.h>
 #include <Common/Container.h>
+#include <Common/Parallel.h>
 
 namespace Render::Internal {
     static void ComputeReadsWritesForBindGroup(const RGBindGroupDesc& inDesc, std::unordered_set<RGResourceRef>& outReads, std::unordered_set<RGResourceRef>& outWrites)
@@ -223,7 +224,7 @@ namespace Render {
 
     RGRasterPassDesc& RGRasterPassDesc::AddColorAttachment(const RGColorAttachment& inAttachment)
     {
-        colorAttachments.emplace_back(inAttachment);
+        colorAttachments.EmplaceBack(inAttachment);
         return *this;
     }
 
@@ -346,15 +347,33 @@ namespace Render {
     RGBuilder::RGBuilder(RHI::Device& inDevice)
         : executed(false)
         , device(inDevice)
+        , resources(Common::ArenaAllocator<RGResourceRef>(allocator))
+        , views(Common::ArenaAllocator<RGResourceViewRef>(allocator))
+        , bindGroups(Common::ArenaAllocator<RGBindGroupRef>(allocator))
+        , passes(Common::ArenaAllocator<RGPassRef>(allocator))
     {
     }
 
-    RGBuilder::~RGBuilder() = default;
+    RGBuilder::~RGBuilder()
+    {
+        for (auto* pass : passes) {
+            pass->~RGPass();
+        }
+        for (auto* bindGroup : bindGroups) {
+            bindGroup->~RGBindGroup();
+        }
+        for (auto* view : views) {
+            view->~RGResourceView();
+        }
+        for (auto* resource : resources) {
+            resource->~RGResource();
+        }
+    }
 
     RGBufferRef RGBuilder::CreateBuffer(const RGBufferDesc& inDesc)
     {
         Assert(!executed);
-        auto* const result = new RGBuffer(inDesc);
+        auto* const result = NewObject<RGBuffer>(inDesc);
         resources.emplace_back(result);
         return result;
     }
@@ -362,7 +381,7 @@ namespace Render {
     RGTextureRef RGBuilder::CreateTexture(const RGTextureDesc& inDesc)
     {
         Assert(!executed);
-        auto* const result = new RGTexture(inDesc);
+        auto* const result = NewObject<RGTexture>(inDesc);
         resources.emplace_back(result);
         return result;
     }
@@ -370,7 +389,7 @@ namespace Render {
     RGBufferViewRef RGBuilder::CreateBufferView(RGBufferRef inBuffer, const RGBufferViewDesc& inDesc)
     {
         Assert(!executed);
-        auto* const result = new RGBufferView(inBuffer, inDesc);
+        auto* const result = NewObject<RGBufferView>(inBuffer, inDesc);
         views.emplace_back(result);
         return result;
     }
@@ -378,7 +397,7 @@ namespace Render {
     RGTextureViewRef RGBuilder::CreateTextureView(RGTextureRef inTexture, const RGTextureViewDesc& inDesc)
     {
         Assert(!executed);
-        auto* const result = new RGTextureView(inTexture, inDesc);
+        auto* const result = NewObject<RGTextureView>(inTexture, inDesc);
         views.emplace_back(result);
         return result;
     }
@@ -386,7 +405,7 @@ namespace Render {
     RGBufferRef RGBuilder::ImportBuffer(RHI::Buffer* inBuffer, RHI::BufferState inInitialState)
     {
         Assert(!executed);
-        auto* const result = new RGBuffer(inBuffer, inInitialState);
+        auto* const result = NewObject<RGBuffer>(inBuffer, inInitialState);
         resources.emplace_back(result);
         return result;
     }
@@ -394,7 +413,7 @@ namespace Render {
     RGTextureRef RGBuilder::ImportTexture(RHI::Texture* inTexture, RHI::TextureState inInitialState)
     {
         Assert(!executed);
-        auto* const result = new RGTexture(inTexture, inInitialState);
+        auto* const result = NewObject<RGTexture>(inTexture, inInitialState);
         resources.emplace_back(result);
         return result;
     }
@@ -402,29 +421,28 @@ namespace Render {
     RGBindGroupRef RGBuilder::AllocateBindGroup(const RGBindGroupDesc& inDesc)
     {
         Assert(!executed);
-        bindGroups.emplace_back(new RGBindGroup(inDesc));
-        return bindGroups.back().Get();
+        return bindGroups.emplace_back(NewObject<RGBindGroup>(inDesc));
     }
 
     void RGBuilder::AddCopyPass(const std::string& inName, const RGCopyPassDesc& inPassDesc, const RGCopyPassExecuteFunc& inFunc, bool inAsyncCopy)
     {
         Assert(!executed);
-        const auto& pass = passes.emplace_back(new RGCopyPass(inName, inPassDesc, inFunc));
-        recordingAsyncTimeline[inAsyncCopy ? RGQueueType::asyncCopy : RGQueueType::main].emplace_back(pass.Get());
+        auto* pass = passes.emplace_back(NewObject<RGCopyPass>(inName, inPassDesc, inFunc));
+        recordingAsyncTimeline[inAsyncCopy ? RGQueueType::asyncCopy : RGQueueType::main].emplace_back(pass);
     }
 
     void RGBuilder::AddComputePass(const std::string& inName, const std::vector<RGBindGroupRef>& inBindGroups, const RGComputePassExecuteFunc& inFunc, bool inAsyncCompute)
     {
         Assert(!executed);
-        const auto& pass = passes.emplace_back(new RGComputePass(inName, inBindGroups, inFunc));
-        recordingAsyncTimeline[inAsyncCompute ? RGQueueType::asyncCompute : RGQueueType::main].emplace_back(pass.Get());
+        auto* pass = passes.emplace_back(NewObject<RGComputePass>(inName, inBindGroups, inFunc));
+        recordingAsyncTimeline[inAsyncCompute ? RGQueueType::asyncCompute : RGQueueType::main].emplace_back(pass);
     }
 
     void RGBuilder::AddRasterPass(const std::string& inName, const RGRasterPassDesc& inPassDesc, const std::vector<RGBindGroupRef>& inBindGroupds, const RGRasterPassExecuteFunc& inFunc)
     {
         Assert(!executed);
-        const auto& pass = passes.emplace_back(new RGRasterPass(inName, inPassDesc, inBindGroupds, inFunc));
-        recordingAsyncTimeline[RGQueueType::main].emplace_back(pass.Get());
+        auto* pass = passes.emplace_back(NewObject<RGRasterPass>(inName, inPassDesc, inBindGroupds, inFunc));
+        recordingAsyncTimeline[RGQueueType::main].emplace_back(pass);
     }
 
     void RGBuilder::AddSyncPoint()
@@ -451,9 +469,9 @@ namespace Render {
         if (inBuffer->imported) {
             return inBuffer->rhiHandleImported;
         }
-        AssertWithReason(!culledResources.contains(inBuffer), "resource has been culled");
-        AssertWithReason(devirtualizedResources.contains(inBuffer), "resource was not devirtualized or has been released");
-        return std::get<PooledBufferRef>(devirtualizedResources.at(inBuffer))->GetRHI();
+        AssertWithReason(!culledResources.Contains(inBuffer), "resource has been culled");
+        AssertWithReason(devirtualizedResources.Contains(inBuffer), "resource was not devirtualized or has been released");
+        return std::get<PooledBufferRef>(devirtualizedResources.At(inBuffer))->GetRHI();
     }
 
     RHI::Texture* RGBuilder::GetRHI(RGTextureRef inTexture) const
@@ -461,33 +479,33 @@ namespace Render {
         if (inTexture->imported) {
             return inTexture->rhiHandleImported;
         }
-        AssertWithReason(!culledResources.contains(inTexture), "resource has been culled");
-        AssertWithReason(devirtualizedResources.contains(inTexture), "resource was not devirtualized or has been released");
-        return std::get<PooledTextureRef>(devirtualizedResources.at(inTexture))->GetRHI();
+        AssertWithReason(!culledResources.Contains(inTexture), "resource has been culled");
+        AssertWithReason(devirtualizedResources.Contains(inTexture), "resource was not devirtualized or has been released");
+        return std::get<PooledTextureRef>(devirtualizedResources.At(inTexture))->GetRHI();
     }
 
     RHI::BufferView* RGBuilder::GetRHI(RGBufferViewRef inBufferView) const
     {
         auto* resource = inBufferView->GetResource();
-        AssertWithReason(!culledResources.contains(resource), "resource has been culled");
-        AssertWithReason(resource->imported || devirtualizedResources.contains(resource), "resource was not devirtualized or has been released");
-        AssertWithReason(devirtualizedResourceViews.contains(inBufferView), "resource view was not devirtualized or has been released");
-        return std::get<RHI::BufferView*>(devirtualizedResourceViews.at(inBufferView));
+        AssertWithReason(!culledResources.Contains(resource), "resource has been culled");
+        AssertWithReason(resource->imported || devirtualizedResources.Contains(resource), "resource was not devirtualized or has been released");
+        AssertWithReason(devirtualizedResourceViews.Contains(inBufferView), "resource view was not devirtualized or has been released");
+        return std::get<RHI::BufferView*>(devirtualizedResourceViews.At(inBufferView));
     }
 
     RHI::TextureView* RGBuilder::GetRHI(RGTextureViewRef inTextureView) const
     {
         auto* resource = inTextureView->GetResource();
-        AssertWithReason(!culledResources.contains(resource), "resource has been culled");
-        AssertWithReason(resource->imported || devirtualizedResources.contains(resource), "resource was not devirtualized or has been released");
-        AssertWithReason(devirtualizedResourceViews.contains(inTextureView), "resource view was not devirtualized or has been released");
-        return std::get<RHI::TextureView*>(devirtualizedResourceViews.at(inTextureView));
+        AssertWithReason(!culledResources.Contains(resource), "resource has been culled");
+        AssertWithReason(resource->imported || devirtualizedResources.Contains(resource), "resource was not devirtualized or has been released");
+        AssertWithReason(devirtualizedResourceViews.Contains(inTextureView), "resource view was not devirtualized or has been released");
+        return std::get<RHI::TextureView*>(devirtualizedResourceViews.At(inTextureView));
     }
 
     RHI::BindGroup* RGBuilder::GetRHI(RGBindGroupRef inBindGroup) const
     {
-        AssertWithReason(devirtualizedBindGroups.contains(inBindGroup), "bind group was not devirtualized or has been released");
-        return devirtualizedBindGroups.at(inBindGroup).Get();
+        AssertWithReason(devirtualizedBindGroups.Contains(inBindGroup), "bind group was not devirtualized or has been released");
+        return devirtualizedBindGroups.At(inBindGroup).Get();
     }
 
     RGBuilder::AsyncTimelineExecuteContext::AsyncTimelineExecuteContext() = default;
@@ -546,7 +564,7 @@ namespace Render {
                 {
                     auto commandRecorder = commandBufferToRecord->Begin();
                     for (auto* pass : passes) {
-                        if (culledPasses.contains(pass)) {
+                        if (culledPasses.Contains(pass)) {
                             continue;
                         }
 
@@ -589,12 +607,16 @@ namespace Render {
 
     void RGBuilder::CompilePassReadWrites() // NOLINT
     {
-        for (const auto& pass : passes) {
-            auto* passRef = pass.Get();
+        for (auto* passRef : passes) {
             Assert(!passReadsMap.contains(passRef));
             Assert(!passWritesMap.contains(passRef));
             passReadsMap.emplace(std::make_pair(passRef, std::unordered_set<RGResourceRef> {}));
             passWritesMap.emplace(std::make_pair(passRef, std::unordered_set<RGResourceRef> {}));
+        }
+
+        // map layout is fixed above, each pass only fills its own sets
+        Common::ParallelFor(0, passes.size(), [this](size_t inIndex) -> void {
+            auto* passRef = passes[inIndex];
             auto& passReads = passReadsMap.at(passRef);
             auto& passWrites = passWritesMap.at(passRef);
 
@@ -627,13 +649,13 @@ namespace Render {
             } else {
                 Unimplement();
             }
-        }
+        }, 32);
 
-        for (const auto& resource : resources) {
-            resourceReadCounts[resource.Get()] = resource->forceUsed || resource->imported ? 1 : 0;
+        for (auto* resource : resources) {
+            resourceReadCounts[resource] = resource->forceUsed || resource->imported ? 1 : 0;
         }
-        for (const auto& pass : passes) {
-            for (auto* read : passReadsMap.at(pass.Get())) {
+        for (auto* pass : passes) {
+            for (auto* read : passReadsMap.at(pass)) {
                 resourceReadCounts[read]++;
             }
         }
@@ -680,21 +702,20 @@ namespace Render {
     void RGBuilder::PerformCull()
     {
         // initial cull
-        for (const auto& resource : resources) {
-            if (auto* resourceRef = resource.Get();
-                resourceReadCounts.at(resourceRef) == 0) {
-                culledResources.emplace(resourceRef);
+        for (auto* resourceRef : resources) {
+            if (resourceReadCounts.At(resourceRef) == 0) {
+                culledResources.Emplace(resourceRef);
             }
         }
 
         // iterative cull
         for (auto riter = passes.rbegin(); riter != passes.rend(); ++riter) {
-            const auto& pass = riter->Get();
+            auto* pass = *riter;
             const auto& passWrites = passWritesMap.at(pass);
 
             bool allWritesCulled = true;
             for (auto* write : passWrites) {
-                if (!culledResources.contains(write)) {
+                if (!culledResources.Contains(write)) {
                     allWritesCulled = false;
                     break;
                 }
@@ -703,12 +724,12 @@ namespace Render {
             if (!allWritesCulled) {
                 continue;
             }
-            culledPasses.emplace(pass);
+            culledPasses.Emplace(pass);
             for (const auto& passReads = passReadsMap.at(pass);
                 auto* read : passReads) {
-                if (auto& readCount = resourceReadCounts.at(read);
+                if (auto& readCount = resourceReadCounts.At(read);
                     --readCount == 0) {
-                    culledResources.emplace(read);
+                    culledResources.Emplace(read);
                 }
             }
         }
@@ -716,9 +737,8 @@ namespace Render {
 
     void RGBuilder::ComputeResourcesInitialState()
     {
-        for (const auto& resource : resources) {
-            auto* resourceRef = resource.Get();
-            if (culledResources.contains(resourceRef)) {
+        for (auto* resourceRef : resources) {
+            if (culledResources.Contains(resourceRef)) {
                 continue;
             }
 
@@ -782,20 +802,19 @@ namespace Render {
 
     void RGBuilder::DevirtualizeViewsCreatedOnImportedResources()
     {
-        for (const auto& view : views) {
-            if (!view->GetResource()->imported) {
+        for (auto* viewRef : views) {
+            if (!viewRef->GetResource()->imported) {
                 continue;
             }
 
-            if (auto* viewRef = view.Get();
-                viewRef->Type() == RGResViewType::bufferView) {
+            if (viewRef->Type() == RGResViewType::bufferView) {
                 const auto* bufferView = static_cast<RGBufferViewRef>(viewRef);
                 auto* buffer = bufferView->GetBuffer();
-                devirtualizedResourceViews.emplace(std::make_pair(viewRef, ResourceViewCache::Get(device).GetOrCreate(GetRHI(buffer), bufferView->desc)));
+                devirtualizedResourceViews.Emplace(viewRef, ResourceViewCache::Get(device).GetOrCreate(GetRHI(buffer), bufferView->desc));
             } else if (viewRef->Type() == RGResViewType::textureView) {
                 const auto* textureView = static_cast<RGTextureViewRef>(viewRef);
                 auto* texture = textureView->GetTexture();
-                devirtualizedResourceViews.emplace(std::make_pair(viewRef, ResourceViewCache::Get(device).GetOrCreate(GetRHI(texture), textureView->desc)));
+                devirtualizedResourceViews.Emplace(viewRef, ResourceViewCache::Get(device).GetOrCreate(GetRHI(texture), textureView->desc));
             } else {
                 Unimplement();
             }
@@ -806,15 +825,15 @@ namespace Render {
     {
         for (auto* resource : inResources) {
             if (resource->imported
-                || culledResources.contains(resource)
-                || devirtualizedResources.contains(resource)) {
+                || culledResources.Contains(resource)
+                || devirtualizedResources.Contains(resource)) {
                 continue;
             }
 
             if (resource->type == RGResType::buffer) {
-                devirtualizedResources.emplace(std::make_pair(resource, BufferPool::Get(device).Allocate(static_cast<RGBufferRef>(resource)->desc)));
+                devirtualizedResources.Emplace(resource, BufferPool::Get(device).Allocate(static_cast<RGBufferRef>(resource)->desc));
             } else if (resource->type == RGResType::texture) {
-                devirtualizedResources.emplace(std::make_pair(resource, TexturePool::Get(device).Allocate(static_cast<RGTextureRef>(resource)->desc)));
+                devirtualizedResources.Emplace(resource, TexturePool::Get(device).Allocate(static_cast<RGTextureRef>(resource)->desc));
             } else {
                 Unimplement();
             }
@@ -833,14 +852,14 @@ namespace Render {
 
                 if (item.type == RHI::BindingType::uniformBuffer || item.type == RHI::BindingType::storageBuffer) {
                     auto* bufferView = std::get<RGBufferViewRef>(item.view);
-                    if (!devirtualizedResourceViews.contains(bufferView)) {
-                        devirtualizedResourceViews.emplace(std::make_pair(bufferView, ResourceViewCache::Get(device).GetOrCreate(GetRHI(bufferView->GetBuffer()), bufferView->desc)));
+                    if (!devirtualizedResourceViews.Contains(bufferView)) {
+                        devirtualizedResourceViews.Emplace(bufferView, ResourceViewCache::Get(device).GetOrCreate(GetRHI(bufferView->GetBuffer()), bufferView->desc));
                     }
                     createInfo.AddEntry(RHI::BindGroupEntry(*binding, GetRHI(bufferView)));
                 } else if (item.type == RHI::BindingType::texture || item.type == RHI::BindingType::storageTexture) {
                     auto* textureView = std::get<RGTextureViewRef>(item.view);
-                    if (!devirtualizedResourceViews.contains(textureView)) {
-                        devirtualizedResourceViews.emplace(std::make_pair(textureView, ResourceViewCache::Get(device).GetOrCreate(GetRHI(textureView->GetTexture()), textureView->desc)));
+                    if (!devirtualizedResourceViews.Contains(textureView)) {
+                        devirtualizedResourceViews.Emplace(textureView, ResourceViewCache::Get(device).GetOrCreate(GetRHI(textureView->GetTexture()), textureView->desc));
                     }
                     createInfo.AddEntry(RHI::BindGroupEntry(*binding, GetRHI(textureView)));
                 } else if (item.type == RHI::BindingType::sampler) {
@@ -849,7 +868,7 @@ namespace Render {
                     Unimplement();
                 }
             }
-            devirtualizedBindGroups.emplace(std::make_pair(bindGroup, device.CreateBindGroup(createInfo)));
+            devirtualizedBindGroups.Emplace(bindGroup, device.CreateBindGroup(createInfo));
         }
     }
 
@@ -857,14 +876,14 @@ namespace Render {
     {
         if (inDesc.depthStencilAttachment.has_value()) {
             if (auto* view = inDesc.depthStencilAttachment->view;
-                !devirtualizedResourceViews.contains(view)) {
-                devirtualizedResourceViews.emplace(std::make_pair(view, ResourceViewCache::Get(device).GetOrCreate(GetRHI(view->GetTexture()), view->desc)));
+                !devirtualizedResourceViews.Contains(view)) {
+                devirtualizedResourceViews.Emplace(view, ResourceViewCache::Get(device).GetOrCreate(GetRHI(view->GetTexture()), view->desc));
             }
         }
         for (const auto& colorAttachment : inDesc.colorAttachments) {
             if (auto* view = colorAttachment.view;
-                !devirtualizedResourceViews.contains(view)) {
-                devirtualizedResourceViews.emplace(std::make_pair(view, ResourceViewCache::Get(device).GetOrCreate(GetRHI(view->GetTexture()), view->desc)));
+                !devirtualizedResourceViews.Contains(view)) {
+                devirtualizedResourceViews.Emplace(view, ResourceViewCache::Get(device).GetOrCreate(GetRHI(view->GetTexture()), view->desc));
             }
         }
     }
@@ -872,16 +891,16 @@ namespace Render {
     void RGBuilder::FinalizePassResources(const std::unordered_set<RGResourceRef>& inResources)
     {
         for (auto* resource : inResources) {
-            if (auto& readCount = resourceReadCounts.at(resource);
+            if (auto& readCount = resourceReadCounts.At(resource);
                 --readCount == 0) {
                 if (resource->type == RGResType::buffer) {
-                    ResourceViewCache::Get(device).Invalidate(std::get<PooledBufferRef>(devirtualizedResources.at(resource))->GetRHI());
+                    ResourceViewCache::Get(device).Invalidate(std::get<PooledBufferRef>(devirtualizedResources.At(resource))->GetRHI());
                 } else if (resource->type == RGResType::texture) {
-                    ResourceViewCache::Get(device).Invalidate(std::get<PooledTextureRef>(devirtualizedResources.at(resource))->GetRHI());
+                    ResourceViewCache::Get(device).Invalidate(std::get<PooledTextureRef>(devirtualizedResources.At(resource))->GetRHI());
                 } else {
                     Unimplement();
                 }
-                devirtualizedResources.erase(resource);
+                devirtualizedResources.Erase(resource);
             }
         }
     }
@@ -889,7 +908,7 @@ namespace Render {
     void RGBuilder::FinalizePassBindGroups(const std::vector<RGBindGroupRef>& inBindGroups)
     {
         for (auto* bindGroup : inBindGroups) {
-            devirtualizedBindGroups.erase(bindGroup);
+            devirtualizedBindGroups.Erase(bindGroup);
         }
     }
 
@@ -947,7 +966,7 @@ namespace Render {
 
     void RGBuilder::TransitionBuffer(RHI::CommandCommandRecorder& inRecoder, RGBufferRef inBuffer, RHI::BufferState inState)
     {
-        auto& currentState = std::get<RHI::BufferState>(resourceStates.at(inBuffer));
+        auto& currentState = std::get<RHI::BufferState>(resourceStates.At(inBuffer));
         if (currentState == inState) {
             return;
         }
@@ -957,7 +976,7 @@ namespace Render {
 
     void RGBuilder::TransitionTexture(RHI::CommandCommandRecorder& inRecoder, RGTextureRef inTexture, RHI::TextureState inState)
     {
-        auto& currentState = std::get<RHI::TextureState>(resourceStates.at(inTexture));
+        auto& currentState = std::get<RHI::TextureState>(resourceStates.At(inTexture));
         if (currentState == inState) {
             return;
         }
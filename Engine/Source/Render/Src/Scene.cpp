@@ -18,4 +18,9 @@ namespace Render {
     {
         lights.Erase(inHandle);
     }
+
+    const LightSPPool& Scene::GetLights() const
+    {
+        return lights;
+    }
 }
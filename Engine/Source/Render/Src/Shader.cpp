@@ -86,11 +86,10 @@ namespace Render {
             return 0;
         }
 
-        const std::vector values = {
-            typeKey,
-            variantKey
-        };
-        return Common::HashUtils::CityHash(values.data(), values.size() * sizeof(size_t));
+        return Common::Hasher()
+            .Update(typeKey)
+            .Update(variantKey)
+            .Finish();
     }
 
     GlobalShaderRegistry& GlobalShaderRegistry::Get()
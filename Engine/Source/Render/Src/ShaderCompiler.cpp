@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <tuple>
 #include <utility>
+#include <algorithm>
 
 #if PLATFORM_WINDOWS
 #include <windows.h>
@@ -324,19 +325,17 @@ namespace Render {
         return instance;
     }
 
-    ShaderCompiler::ShaderCompiler() : threadPool("ShaderCompiler", 16)
-    {
-    }
+    ShaderCompiler::ShaderCompiler() = default;
 
     ShaderCompiler::~ShaderCompiler() = default;
 
-    std::future<ShaderCompileOutput> ShaderCompiler::Compile(const ShaderCompileInput& inInput, const ShaderCompileOptions& inOptions)
+    Common::TaskFuture<ShaderCompileOutput> ShaderCompiler::Compile(const ShaderCompileInput& inInput, const ShaderCompileOptions& inOptions)
     {
-        return threadPool.EmplaceTask([](const ShaderCompileInput& input, const ShaderCompileOptions& options) -> ShaderCompileOutput {
+        return Common::TaskExecutor::Shared().Async([input = inInput, options = inOptions]() -> ShaderCompileOutput {
             ShaderCompileOutput output;
             CompileDxilOrSpriv(input, options, output);
             return output;
-        }, inInput, inOptions);
+        });
     }
 
     ShaderTypeCompiler& ShaderTypeCompiler::Get()
@@ -345,64 +344,80 @@ namespace Render {
         return instance;
     }
 
-    ShaderTypeCompiler::ShaderTypeCompiler()
-        : threadPool("ShaderTypeCompiler", 4)
-    {
-    }
+    ShaderTypeCompiler::ShaderTypeCompiler() = default;
 
     ShaderTypeCompiler::~ShaderTypeCompiler() = default;
 
-    std::future<ShaderTypeCompileResult> ShaderTypeCompiler::Compile(const std::vector<IShaderType*>& inShaderTypes, const ShaderCompileOptions& inOptions)
+    Common::TaskFuture<ShaderTypeCompileResult> ShaderTypeCompiler::Compile(const std::vector<IShaderType*>& inShaderTypes, const ShaderCompileOptions& inOptions)
     {
-        return threadPool.EmplaceTask([](const std::vector<IShaderType*>& shaderTypes, const ShaderCompileOptions& options) -> ShaderTypeCompileResult {
-            std::unordered_map<ShaderTypeKey, std::unordered_map<VariantKey, std::future<ShaderCompileOutput>>> compileOutputs;
-            compileOutputs.reserve(shaderTypes.size());
-            for (auto* shaderType : shaderTypes) {
-                auto typeKey = shaderType->GetKey();
-                auto stage = shaderType->GetStage();
-                const auto& entryPoint = shaderType->GetEntryPoint();
-                const auto& code = shaderType->GetCode();
-
-                Assert(!compileOutputs.contains(typeKey));
-                compileOutputs.emplace(std::make_pair(typeKey, std::unordered_map<VariantKey, std::future<ShaderCompileOutput>> {}));
-                auto& variantCompileOutputs = compileOutputs.at(typeKey);
-
-                for ( const auto& variants = shaderType->GetVariants();
-                    const auto& variantKey : variants) {
-                    ShaderCompileInput input {};
-                    input.source = code;
-                    input.entryPoint = entryPoint;
-                    input.stage = stage;
-                    input.definitions = shaderType->GetDefinitions(variantKey);
-
-                    variantCompileOutputs.emplace(std::make_pair(variantKey, ShaderCompiler::Get().Compile(input, options)));
-                }
+        std::vector<ShaderTypeKey> typeKeys;
+        std::vector<std::pair<ShaderTypeKey, VariantKey>> compileKeys;
+        std::vector<ShaderCompileInput> compileInputs;
+        typeKeys.reserve(inShaderTypes.size());
+        for (auto* shaderType : inShaderTypes) {
+            auto typeKey = shaderType->GetKey();
+            auto stage = shaderType->GetStage();
+            const auto& entryPoint = shaderType->GetEntryPoint();
+            const auto& code = shaderType->GetCode();
+
+            Assert(std::find(typeKeys.begin(), typeKeys.end(), typeKey) == typeKeys.end());
+            typeKeys.emplace_back(typeKey);
+
+            for ( const auto& variants = shaderType->GetVariants();
+                const auto& variantKey : variants) {
+                ShaderCompileInput input {};
+                input.source = code;
+                input.entryPoint = entryPoint;
+                input.stage = stage;
+                input.definitions = shaderType->GetDefinitions(variantKey);
+
+                compileKeys.emplace_back(typeKey, variantKey);
+                compileInputs.emplace_back(std::move(input));
+            }
+        }
+
+        // each variant compiles straight into its own slot, so the fan-in continuation can move byte code into archives
+        // instead of copying it out of task results
+        auto outputs = std::make_shared<std::vector<ShaderCompileOutput>>(compileInputs.size());
+        std::vector<Common::TaskFuture<void>> compileTasks;
+        compileTasks.reserve(compileInputs.size());
+        for (auto i = 0; i < compileInputs.size(); i++) {
+            compileTasks.emplace_back(Common::TaskExecutor::Shared().Async([outputs, i, input = std::move(compileInputs[i]), options = inOptions]() -> void {
+                CompileDxilOrSpriv(input, options, (*outputs)[i]);
+            }));
+        }
+
+        // fan-in with continuation instead of blocking a worker thread on each variant's compile output
+        return Common::WhenAll(compileTasks).Then([typeKeys = std::move(typeKeys), compileKeys = std::move(compileKeys), outputs = std::move(outputs)]() -> ShaderTypeCompileResult {
+            std::unordered_map<ShaderTypeKey, ShaderArchivePackage> archivePackages;
+            archivePackages.reserve(typeKeys.size());
+            for (const auto& typeKey : typeKeys) {
+                archivePackages.emplace(typeKey, ShaderArchivePackage {});
             }
 
             ShaderTypeCompileResult result;
-            for (auto& [typeKey, variantCompileOutputs] : compileOutputs) {
-                ShaderArchivePackage archivePackage;
-
-                for (auto& [variantKey, compileFuture] : variantCompileOutputs) {
-                    ShaderCompileOutput output = compileFuture.get(); // NOLINT
-                    if (output.success) {
-                        ShaderArchive archive;
-                        archive.byteCode = std::move(output.byteCode);
-                        archive.reflectionData = std::move(output.reflectionData);
-
-                        archivePackage.emplace(std::make_pair(variantKey, std::move(archive)));
-                    } else {
-                        result.errorInfos.emplace(std::make_pair(std::make_pair(typeKey, variantKey), output.errorInfo));
-                    }
+            for (auto i = 0; i < outputs->size(); i++) {
+                const auto& [typeKey, variantKey] = compileKeys[i];
+                auto& output = (*outputs)[i];
+                if (output.success) {
+                    ShaderArchive archive;
+                    archive.byteCode = std::move(output.byteCode);
+                    archive.reflectionData = std::move(output.reflectionData);
+
+                    archivePackages.at(typeKey).emplace(std::make_pair(variantKey, std::move(archive)));
+                } else {
+                    result.errorInfos.emplace(std::make_pair(std::make_pair(typeKey, variantKey), std::move(output.errorInfo)));
                 }
+            }
+            for (auto& [typeKey, archivePackage] : archivePackages) {
                 ShaderArchiveStorage::Get().UpdateShaderArchivePackage(typeKey, std::move(archivePackage));
             }
             result.success = result.errorInfos.empty();
             return result;
-        }, inShaderTypes, inOptions);
+        });
     }
 
-    std::future<ShaderTypeCompileResult> ShaderTypeCompiler::CompileGlobalShaderTypes(const ShaderCompileOptions& inOptions)
+    Common::TaskFuture<ShaderTypeCompileResult> ShaderTypeCompiler::CompileGlobalShaderTypes(const ShaderCompileOptions& inOptions)
     {
         return Compile(GlobalShaderRegistry::Get().GetShaderTypes(), inOptions);
     }
@@ -0,0 +1,55 @@
+//
+// Created by johnk on 2026/10/19.
+//
+
+#include <Test/Test.h>
+
+#include <Render/RenderCache.h>
+
+using namespace Render;
+
+struct RenderCacheTest : testing::Test {
+    void SetUp() override
+    {
+        instance = RHI::Instance::GetByType(RHI::RHIType::dummy);
+
+        device = instance->GetGpu(0)->RequestDevice(
+            RHI::DeviceCreateInfo()
+                .AddQueueRequest(RHI::QueueRequestInfo(RHI::QueueType::graphics, 1)));
+    }
+
+    void TearDown() override {}
+
+    RHI::Instance* instance;
+    Common::UniqueRef<RHI::Device> device;
+};
+
+TEST_F(RenderCacheTest, SamplerEvictionTest)
+{
+    auto& samplerCache = SamplerCache::Get(*device);
+    samplerCache.SetMaxIdleFrames(2);
+
+    const auto usedDesc = RSamplerDesc()
+        .SetMinFilter(RHI::FilterMode::linear)
+        .SetMagFilter(RHI::FilterMode::linear);
+    const auto unusedDesc = RSamplerDesc()
+        .SetMinFilter(RHI::FilterMode::nearest)
+        .SetMagFilter(RHI::FilterMode::nearest);
+
+    auto* usedSampler = samplerCache.GetOrCreate(usedDesc);
+    samplerCache.GetOrCreate(unusedDesc);
+    const auto statsBefore = samplerCache.GetStats();
+
+    // tick past retain frames and max idle frames, only the entry used every frame survives
+    for (auto i = 0; i < 8; i++) {
+        ASSERT_EQ(samplerCache.GetOrCreate(usedDesc), usedSampler);
+        samplerCache.Tick();
+    }
+
+    const auto statsAfter = samplerCache.GetStats();
+    ASSERT_EQ(statsAfter.evictions - statsBefore.evictions, 1);
+    ASSERT_EQ(statsAfter.size, statsBefore.size - 1);
+    ASSERT_EQ(samplerCache.GetOrCreate(usedDesc), usedSampler);
+
+    samplerCache.SetMaxIdleFrames(0);
+}
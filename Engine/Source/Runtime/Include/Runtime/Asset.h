@@ -11,7 +11,7 @@
 
 #include <Common/Memory.h>
 #include <Common/Serialization.h>
-#include <Common/Concurrent.h>
+#include <Common/Coroutine.h>
 #include <Common/Concepts.h>
 #include <Core/Uri.h>
 #include <Mirror/Meta.h>
@@ -19,7 +19,7 @@
 #include <Runtime/Api.h>
 
 namespace Runtime {
-    struct EClass() Asset {
+    struct EClass() Asset : public Common::RefCounted {
         EClassBody(Asset)
 
         Asset()
@@ -37,25 +37,26 @@ namespace Runtime {
     template <Common::DerivedFrom<Asset> A>
     class AssetRef {
     public:
-        template <typename A2> AssetRef(Common::SharedRef<A2>& inRef) : ref(inRef) {} // NOLINT
-        template <typename A2> AssetRef(Common::SharedRef<A2>&& inRef) noexcept : ref(std::move(inRef)) {} // NOLINT
+        template <typename A2> AssetRef(const Common::IntrusiveRef<A2>& inRef) : ref(inRef) {} // NOLINT
+        template <typename A2> AssetRef(Common::IntrusiveRef<A2>&& inRef) noexcept : ref(std::move(inRef)) {} // NOLINT
         AssetRef(A* pointer) : ref(pointer) {} // NOLINT
-        AssetRef(AssetRef& other) : ref(other.ref) {} // NOLINT
+        AssetRef(nullptr_t) : ref(nullptr) {} // NOLINT
+        AssetRef(const AssetRef& other) : ref(other.ref) {} // NOLINT
         AssetRef(AssetRef&& other) noexcept : ref(std::move(other.ref)) {} // NOLINT
         AssetRef() = default;
         ~AssetRef() = default;
 
         template <typename A2>
-        AssetRef& operator=(Common::SharedRef<A2>& inRef)
+        AssetRef& operator=(const Common::IntrusiveRef<A2>& inRef)
         {
             ref = inRef;
             return *this;
         }
 
         template <typename A2>
-        AssetRef& operator=(Common::SharedRef<A2>&& inRef) noexcept
+        AssetRef& operator=(Common::IntrusiveRef<A2>&& inRef) noexcept
         {
-            ref = inRef;
+            ref = std::move(inRef);
             return *this;
         }
 
@@ -65,7 +66,7 @@ namespace Runtime {
             return *this;
         }
 
-        AssetRef& operator=(AssetRef& other) // NOLINT
+        AssetRef& operator=(const AssetRef& other)
         {
             ref = other.ref;
             return *this;
@@ -118,48 +119,53 @@ namespace Runtime {
             return ref.RefCount();
         }
 
-        Common::SharedRef<A>& GetSharedRef()
+        bool IsUnique() const
+        {
+            return ref.IsUnique();
+        }
+
+        const Common::IntrusiveRef<A>& GetIntrusiveRef() const
         {
             return ref;
         }
 
         template <typename A2>
-        AssetRef<A2> StaticCast()
+        AssetRef<A2> StaticCast() const
         {
             return ref.template StaticCast<A2>();
         }
 
         template <typename A2>
-        AssetRef<A2> DynamicCast()
+        AssetRef<A2> DynamicCast() const
         {
             return ref.template DynamicCast<A2>();
         }
 
         template <typename A2>
-        AssetRef<A2> ReinterpretCast()
+        AssetRef<A2> ReinterpretCast() const
         {
             return ref.template ReinterpretCast<A2>();
         }
 
     private:
-        Common::SharedRef<A> ref;
+        Common::IntrusiveRef<A> ref;
     };
 
     template <Common::DerivedFrom<Asset> A>
     class WeakAssetRef {
     public:
-        template <typename A2> WeakAssetRef(AssetRef<A2>& inRef) : ref(inRef.GetSharedRef()) {} // NOLINT
-        WeakAssetRef(WeakAssetRef& other) : ref(other.ref) {} // NOLINT
+        template <typename A2> WeakAssetRef(const AssetRef<A2>& inRef) : ref(inRef.GetIntrusiveRef()) {} // NOLINT
+        WeakAssetRef(const WeakAssetRef& other) : ref(other.ref) {} // NOLINT
         WeakAssetRef(WeakAssetRef&& other) noexcept : ref(std::move(other.ref)) {} // NOLINT
 
         template <typename A2>
-        WeakAssetRef& operator=(AssetRef<A2>& inRef)
+        WeakAssetRef& operator=(const AssetRef<A2>& inRef)
         {
-            ref = inRef.GetSharedRef();
+            ref = inRef.GetIntrusiveRef();
             return *this;
         }
 
-        WeakAssetRef& operator=(WeakAssetRef& other) // NOLINT
+        WeakAssetRef& operator=(const WeakAssetRef& other)
         {
             ref = other.ref;
             return *this;
@@ -187,7 +193,7 @@ namespace Runtime {
         }
 
     private:
-        Common::WeakRef<A> ref;
+        Common::IntrusiveWeakRef<A> ref;
     };
 
     template <typename A>
@@ -205,7 +211,7 @@ namespace Runtime {
         {
         }
 
-        explicit SoftAssetRef(AssetRef<A>& inAsset)
+        explicit SoftAssetRef(const AssetRef<A>& inAsset)
             : uri(inAsset.Uri())
             , asset(inAsset)
         {
@@ -232,7 +238,7 @@ namespace Runtime {
             return *this;
         }
 
-        SoftAssetRef& operator=(AssetRef<A>& inAsset)
+        SoftAssetRef& operator=(const AssetRef<A>& inAsset)
         {
             uri = inAsset.Uri();
             asset = inAsset;
@@ -319,33 +325,40 @@ namespace Runtime {
         }
 
         template <typename A>
-        void AsyncLoad(const Core::Uri& uri, const OnAssetLoaded<A>& onAssetLoaded)
+        Common::Task<AssetRef<A>> CoLoad(Core::Uri uri)
         {
-            threadPool.EmplaceTask([=]() -> void {
-                AssetRef<A> result = nullptr;
-                {
-                    std::unique_lock<std::mutex> lock(mutex);
-                    auto iter = weakAssetRefs.find(uri);
-                    if (iter != weakAssetRefs.end() && !iter->second.Expired()) {
-                        result = iter->second.Lock().StaticCast<A>();
-                    }
-                }
+            co_await Common::SwitchTo(Common::TaskExecutor::Shared());
 
-                if (result == nullptr) {
-                    result = LoadInternal<A>(uri);
+            AssetRef<A> result = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                auto iter = weakAssetRefs.find(uri);
+                if (iter != weakAssetRefs.end() && !iter->second.Expired()) {
+                    result = iter->second.Lock().StaticCast<A>();
                 }
+            }
+
+            if (result == nullptr) {
+                result = LoadInternal<A>(uri);
+            }
 
-                AssetRef<Asset> tempRef = result.template StaticCast<Asset>();
-                {
-                    std::unique_lock<std::mutex> lock(mutex);
-                    auto iter = weakAssetRefs.find(uri);
-                    if (iter == weakAssetRefs.end()) {
-                        weakAssetRefs.emplace(std::make_pair(uri, WeakAssetRef<Asset>(tempRef)));
-                    } else {
-                        iter->second = tempRef;
-                    }
+            AssetRef<Asset> tempRef = result.template StaticCast<Asset>();
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                auto iter = weakAssetRefs.find(uri);
+                if (iter == weakAssetRefs.end()) {
+                    weakAssetRefs.emplace(std::make_pair(uri, WeakAssetRef<Asset>(tempRef)));
+                } else {
+                    iter->second = tempRef;
                 }
+            }
+            co_return result;
+        }
 
+        template <typename A>
+        void AsyncLoad(const Core::Uri& uri, const OnAssetLoaded<A>& onAssetLoaded)
+        {
+            Common::Launch(CoLoad<A>(uri)).Then([onAssetLoaded](const AssetRef<A>& result) -> void {
                 onAssetLoaded(result);
             });
         }
@@ -353,11 +366,9 @@ namespace Runtime {
         template <typename A>
         void AsyncLoadSoft(SoftAssetRef<A>& softAssetRef, const OnSoftAssetLoaded<A>& onSoftAssetLoaded)
         {
-            threadPool.EmplaceTask([this, softAssetRef, onSoftAssetLoaded]() -> void {
-                AsyncLoad(softAssetRef.Uri(), [&](AssetRef<A>& ref) -> void {
-                    softAssetRef = ref;
-                    onSoftAssetLoaded();
-                });
+            AsyncLoad<A>(softAssetRef.Uri(), [&softAssetRef, onSoftAssetLoaded](AssetRef<A> ref) -> void {
+                softAssetRef = ref;
+                onSoftAssetLoaded();
             });
         }
 
@@ -371,9 +382,13 @@ namespace Runtime {
             Core::AssetUriParser parser(assetRef.Uri());
             auto pathString = parser.AbsoluteFilePath().String();
             Common::BinaryFileSerializeStream stream(pathString);
+            Common::CompressedSerializeStream compressedStream(stream);
+            Common::SerializeSchemaTable schemaTable;
+            Common::WriteSerializeHeader(compressedStream, Common::SerializeIntEncoding::varint, &schemaTable);
 
             Mirror::Any ref = std::ref(*assetRef.Get());
-            ref.Serialize(stream);
+            ref.Serialize(compressedStream);
+            Common::WriteSerializeFooter(compressedStream);
         }
 
         template <typename A>
@@ -388,11 +403,24 @@ namespace Runtime {
         {
             Core::AssetUriParser parser(uri);
             auto pathString = parser.AbsoluteFilePath().String();
-            Common::BinaryFileDeserializeStream stream(pathString);
+            Common::MappedFileDeserializeStream stream(pathString);
 
-            AssetRef<A> result = Common::SharedRef<A>(new A());
+            AssetRef<A> result = Common::MakeIntrusive<A>();
             Mirror::Any ref = std::ref(*result.Get());
-            ref.Deserialize(stream);
+            Common::SerializeSchemaTable schemaTable;
+            // assets saved before compression or serialize header was introduced are still loadable
+            if (Common::CompressedDeserializeStream::IsCompressed(stream)) {
+                Common::CompressedDeserializeStream compressedStream(stream);
+                Common::ReadSerializeHeader(compressedStream, &schemaTable);
+                ref.Deserialize(compressedStream);
+                // corrupt or truncated file
+                if (!compressedStream.IsValid()) {
+                    return nullptr;
+                }
+            } else {
+                Common::ReadSerializeHeader(stream, &schemaTable);
+                ref.Deserialize(stream);
+            }
 
             // reset uri is useful for moved asset
             result->uri = uri;
@@ -403,7 +431,6 @@ namespace Runtime {
 
         std::mutex mutex;
         std::unordered_map<Core::Uri, WeakAssetRef<Asset>> weakAssetRefs;
-        Common::ThreadPool threadPool;
     };
 }
 
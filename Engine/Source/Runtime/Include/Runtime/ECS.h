@@ -5,12 +5,14 @@
 #pragma once
 
 #include <set>
+#include <span>
 #include <unordered_set>
 #include <unordered_map>
 
 #include <Common/Delegate.h>
 #include <Common/Utility.h>
 #include <Common/Memory.h>
+#include <Common/Container.h>
 #include <Mirror/Mirror.h>
 #include <Mirror/Meta.h>
 #include <Runtime/Api.h>
@@ -72,15 +74,18 @@ namespace Runtime::Internal {
         size_t offset;
     };
 
+    // archetypes rarely have more than a handful of components
+    using CompRttiVec = Common::SmallVector<CompRtti, 8>;
+
     class RUNTIME_API Archetype {
     public:
-        explicit Archetype(const std::vector<CompRtti>& inRttiVec);
+        explicit Archetype(const CompRttiVec& inRttiVec);
 
         bool Contains(CompClass inClazz) const;
         bool ContainsAll(const std::vector<CompClass>& inClasses) const;
         bool NotContainsAny(const std::vector<CompClass>& inClasses) const;
         ElemPtr EmplaceElem(Entity inEntity);
-        ElemPtr EmplaceElem(Entity inEntity, ElemPtr inSrcElem, const std::vector<CompRtti>& inSrcRttiVec);
+        ElemPtr EmplaceElem(Entity inEntity, ElemPtr inSrcElem, const CompRttiVec& inSrcRttiVec);
         Mirror::Any EmplaceComp(Entity inEntity, CompClass inCompClass, const Mirror::Any& inCompRef);
         void EraseElem(Entity inEntity);
         ElemPtr GetElem(Entity inEntity) const;
@@ -88,10 +93,10 @@ namespace Runtime::Internal {
         Mirror::Any GetComp(Entity inEntity, CompClass inCompClass) const;
         size_t Size() const;
         auto All() const;
-        const std::vector<CompRtti>& GetRttiVec() const;
+        const CompRttiVec& GetRttiVec() const;
         ArchetypeId Id() const;
-        std::vector<CompRtti> NewRttiVecByAdd(const CompRtti& inRtti) const;
-        std::vector<CompRtti> NewRttiVecByRemove(const CompRtti& inRtti) const;
+        CompRttiVec NewRttiVecByAdd(const CompRtti& inRtti) const;
+        CompRttiVec NewRttiVecByRemove(const CompRtti& inRtti) const;
 
     private:
         using CompRttiIndex = size_t;
@@ -108,10 +113,10 @@ namespace Runtime::Internal {
         ArchetypeId id;
         size_t size;
         size_t elemSize;
-        std::vector<CompRtti> rttiVec;
-        std::unordered_map<CompClass, CompRttiIndex> rttiMap;
-        std::unordered_map<Entity, ElemIndex> entityMap;
-        std::unordered_map<ElemIndex, Entity> elemMap;
+        CompRttiVec rttiVec;
+        Common::FlatHashMap<CompClass, CompRttiIndex> rttiMap;
+        Common::FlatHashMap<Entity, ElemIndex> entityMap;
+        Common::FlatHashMap<ElemIndex, Entity> elemMap;
         std::vector<uint8_t> memory;
     };
 
@@ -411,12 +416,20 @@ namespace Runtime {
         using DynUpdateFunc = std::function<void(const Mirror::Any&)>;
         using ConstIter = Internal::EntityPool::ConstIter;
         using CompEvent = Common::Delegate<ECRegistry&, Entity>;
+        using CompBatchEvent = Common::Delegate<ECRegistry&, std::span<const Entity>>;
         using GCompEvent = Common::Delegate<ECRegistry&>;
 
         struct CompEvents {
             CompEvent onConstructed;
             CompEvent onUpdated;
             CompEvent onRemove;
+            // batch events are broadcast once per FlushEvents() with all entities notified since last flush
+            CompBatchEvent onConstructedBatch;
+            CompBatchEvent onUpdatedBatch;
+            CompBatchEvent onRemoveBatch;
+            std::vector<Entity> pendingConstructed;
+            std::vector<Entity> pendingUpdated;
+            std::vector<Entity> pendingRemove;
         };
 
         struct GCompEvents {
@@ -434,6 +447,7 @@ namespace Runtime {
         ECRegistry& operator=(ECRegistry&& inOther) noexcept;
 
         void ResetTransients();
+        void FlushEvents();
 
         // entity
         // TODO create with hint
@@ -525,7 +539,7 @@ namespace Runtime {
 
         Internal::EntityPool entities;
         std::unordered_map<GCompClass, Mirror::Any> globalComps;
-        std::unordered_map<Internal::ArchetypeId, Internal::Archetype> archetypes;
+        Common::FlatHashMap<Internal::ArchetypeId, Internal::Archetype> archetypes;
         // transients
         std::unordered_map<CompClass, CompEvents> compEvents;
         std::unordered_map<GCompClass, GCompEvents> globalCompEvents;
@@ -4,6 +4,7 @@
 
 #include <taskflow/taskflow.hpp>
 
+#include <Common/Parallel.h>
 #include <Runtime/ECS.h>
 
 namespace Runtime {
@@ -72,17 +73,17 @@ namespace Runtime::Internal {
         return clazz->SizeOf();
     }
 
-    Archetype::Archetype(const std::vector<CompRtti>& inRttiVec)
+    Archetype::Archetype(const CompRttiVec& inRttiVec)
         : id(0)
         , size(0)
         , elemSize(1)
         , rttiVec(inRttiVec)
     {
-        rttiMap.reserve(rttiVec.size());
-        for (auto i = 0; i < rttiVec.size(); i++) {
+        rttiMap.Reserve(rttiVec.Size());
+        for (auto i = 0; i < rttiVec.Size(); i++) {
             auto& rtti = rttiVec[i];
             const auto clazz = rtti.Class();
-            rttiMap.emplace(clazz, i);
+            rttiMap.Emplace(clazz, i);
 
             id += clazz->GetTypeInfo()->id;
             rtti.Bind(elemSize);
@@ -124,12 +125,12 @@ namespace Runtime::Internal {
     {
         ElemPtr result = AllocateNewElemBack();
         auto backElem = size - 1;
-        entityMap.emplace(inEntity, backElem);
-        elemMap.emplace(backElem, inEntity);
+        entityMap.Emplace(inEntity, backElem);
+        elemMap.Emplace(backElem, inEntity);
         return result;
     }
 
-    ElemPtr Archetype::EmplaceElem(Entity inEntity, ElemPtr inSrcElem, const std::vector<CompRtti>& inSrcRttiVec)
+    ElemPtr Archetype::EmplaceElem(Entity inEntity, ElemPtr inSrcElem, const CompRttiVec& inSrcRttiVec)
     {
         ElemPtr newElem = EmplaceElem(inEntity);
         for (const auto& srcRtti : inSrcRttiVec) {
@@ -144,30 +145,30 @@ namespace Runtime::Internal {
 
     Mirror::Any Archetype::EmplaceComp(Entity inEntity, CompClass inCompClass, const Mirror::Any& inCompRef) // NOLINT
     {
-        ElemPtr elem = ElemAt(entityMap.at(inEntity));
+        ElemPtr elem = ElemAt(entityMap.At(inEntity));
         return GetCompRtti(inCompClass).MoveConstruct(elem, inCompRef);
     }
 
     void Archetype::EraseElem(Entity inEntity)
     {
-        const auto elemIndex = entityMap.at(inEntity);
+        const auto elemIndex = entityMap.At(inEntity);
         ElemPtr elem = ElemAt(elemIndex);
         const auto lastElemIndex = Size() - 1;
-        const auto entityToLastElem = elemMap.at(lastElemIndex);
+        const auto entityToLastElem = elemMap.At(lastElemIndex);
         ElemPtr lastElem = ElemAt(lastElemIndex);
         for (const auto& rtti : rttiVec) {
             rtti.MoveAssign(elem, rtti.Get(lastElem));
         }
-        entityMap.at(entityToLastElem) = elemIndex;
-        entityMap.erase(inEntity);
-        elemMap.at(elemIndex) = entityToLastElem;
-        elemMap.erase(lastElemIndex);
+        entityMap.At(entityToLastElem) = elemIndex;
+        entityMap.Erase(inEntity);
+        elemMap.At(elemIndex) = entityToLastElem;
+        elemMap.Erase(lastElemIndex);
         size--;
     }
 
     ElemPtr Archetype::GetElem(Entity inEntity) const
     {
-        return ElemAt(entityMap.at(inEntity));
+        return ElemAt(entityMap.At(inEntity));
     }
 
     Mirror::Any Archetype::GetComp(Entity inEntity, CompClass inCompClass)
@@ -187,7 +188,7 @@ namespace Runtime::Internal {
         return size;
     }
 
-    const std::vector<CompRtti>& Archetype::GetRttiVec() const
+    const CompRttiVec& Archetype::GetRttiVec() const
     {
         return rttiVec;
     }
@@ -197,32 +198,32 @@ namespace Runtime::Internal {
         return id;
     }
 
-    std::vector<CompRtti> Archetype::NewRttiVecByAdd(const CompRtti& inRtti) const
+    CompRttiVec Archetype::NewRttiVecByAdd(const CompRtti& inRtti) const
     {
         auto result = rttiVec;
-        result.emplace_back(inRtti);
+        result.EmplaceBack(inRtti);
         return result;
     }
 
-    std::vector<CompRtti> Archetype::NewRttiVecByRemove(const CompRtti& inRtti) const
+    CompRttiVec Archetype::NewRttiVecByRemove(const CompRtti& inRtti) const
     {
         auto result = rttiVec;
         const auto iter = std::ranges::find_if(result, [&](const CompRtti& rtti) -> bool { return rtti.Class() == inRtti.Class(); });
-        Assert(iter != result.end());
-        result.erase(iter);
+        Assert(iter != result.End());
+        result.Erase(iter);
         return result;
     }
 
     const CompRtti* Archetype::FindCompRtti(CompClass clazz) const
     {
-        const auto iter = rttiMap.find(clazz);
-        return iter != rttiMap.end() ? &rttiVec[iter->second] : nullptr;
+        const auto iter = rttiMap.Find(clazz);
+        return iter != rttiMap.End() ? &rttiVec[iter->second] : nullptr;
     }
 
     const CompRtti& Archetype::GetCompRtti(CompClass clazz) const
     {
-        Assert(rttiMap.contains(clazz));
-        return rttiVec[rttiMap.at(clazz)];
+        Assert(rttiMap.Contains(clazz));
+        return rttiVec[rttiMap.At(clazz)];
     }
 
     ElemPtr Archetype::ElemAt(std::vector<uint8_t>& inMemory, size_t inIndex) const // NOLINT
@@ -246,14 +247,15 @@ namespace Runtime::Internal {
         const size_t newCapacity = static_cast<size_t>(std::ceil(static_cast<float>(std::max(Capacity(), static_cast<size_t>(1))) * inRatio));
         std::vector<uint8_t> newMemory(newCapacity * elemSize);
 
-        for (auto i = 0; i < size; i++) {
+        // elements relocate independently, large archetypes are moved in parallel
+        Common::ParallelFor(0, size, [&](size_t inIndex) -> void {
             for (const auto& rtti : rttiVec) {
-                void* dstElem = ElemAt(newMemory, i);
-                void* srcElem = ElemAt(i);
+                void* dstElem = ElemAt(newMemory, inIndex);
+                void* srcElem = ElemAt(inIndex);
                 rtti.MoveConstruct(dstElem, rtti.Get(srcElem));
                 rtti.Destruct(srcElem);
             }
-        }
+        }, 256);
         memory = std::move(newMemory);
     }
 
@@ -610,7 +612,7 @@ namespace Runtime {
 
     ECRegistry::ECRegistry()
     {
-        archetypes.emplace(0, Internal::Archetype({}));
+        archetypes.Emplace(0, Internal::Archetype({}));
     }
 
     ECRegistry::~ECRegistry()
@@ -654,17 +656,48 @@ namespace Runtime {
         globalCompEvents.clear();
     }
 
+    void ECRegistry::FlushEvents()
+    {
+        const auto flush = [this](const CompBatchEvent& inEvent, std::vector<Entity>& inPending) -> void {
+            if (inPending.empty()) {
+                return;
+            }
+            // receivers may notify again while broadcasting, swap out so new entities go to next flush
+            std::vector<Entity> entities;
+            entities.swap(inPending);
+            inEvent.Broadcast(*this, std::span<const Entity>(entities));
+            if (inPending.empty()) {
+                entities.clear();
+                entities.swap(inPending);
+            }
+        };
+
+        // receivers may touch compEvents while broadcasting, collect first, element pointers of unordered_map are stable
+        Common::SmallVector<CompEvents*, 16> dirtyEvents;
+        for (auto& events : compEvents | std::views::values) {
+            if (!events.pendingConstructed.empty() || !events.pendingUpdated.empty() || !events.pendingRemove.empty()) {
+                dirtyEvents.EmplaceBack(&events);
+            }
+        }
+
+        for (auto* events : dirtyEvents) {
+            flush(events->onConstructedBatch, events->pendingConstructed);
+            flush(events->onUpdatedBatch, events->pendingUpdated);
+            flush(events->onRemoveBatch, events->pendingRemove);
+        }
+    }
+
     Entity ECRegistry::Create()
     {
         const Entity result = entities.Allocate();
-        archetypes.at(entities.GetArchetype(result)).EmplaceElem(result);
+        archetypes.At(entities.GetArchetype(result)).EmplaceElem(result);
         return result;
     }
 
     void ECRegistry::Destroy(Entity inEntity)
     {
         Assert(Valid(inEntity));
-        archetypes.at(entities.GetArchetype(inEntity)).EraseElem(inEntity);
+        archetypes.At(entities.GetArchetype(inEntity)).EraseElem(inEntity);
         entities.Free(inEntity);
     }
 
@@ -682,7 +715,7 @@ namespace Runtime {
     {
         entities.Clear();
         globalComps.clear();
-        archetypes.clear();
+        archetypes.Clear();
         ResetTransients();
     }
 
@@ -737,7 +770,11 @@ namespace Runtime {
         if (iter == compEvents.end()) {
             return;
         }
-        iter->second.onUpdated.Broadcast(*this, inEntity);
+        auto& events = iter->second;
+        events.onUpdated.Broadcast(*this, inEntity);
+        if (events.onUpdatedBatch.Count() > 0) {
+            events.pendingUpdated.emplace_back(inEntity);
+        }
     }
 
     void ECRegistry::NotifyConstructedDyn(CompClass inClass, Entity inEntity)
@@ -746,7 +783,11 @@ namespace Runtime {
         if (iter == compEvents.end()) {
             return;
         }
-        iter->second.onConstructed.Broadcast(*this, inEntity);
+        auto& events = iter->second;
+        events.onConstructed.Broadcast(*this, inEntity);
+        if (events.onConstructedBatch.Count() > 0) {
+            events.pendingConstructed.emplace_back(inEntity);
+        }
     }
 
     void ECRegistry::NotifyRemoveDyn(CompClass inClass, Entity inEntity)
@@ -755,7 +796,11 @@ namespace Runtime {
         if (iter == compEvents.end()) {
             return;
         }
-        iter->second.onRemove.Broadcast(*this, inEntity);
+        auto& events = iter->second;
+        events.onRemove.Broadcast(*this, inEntity);
+        if (events.onRemoveBatch.Count() > 0) {
+            events.pendingRemove.emplace_back(inEntity);
+        }
     }
 
     Observer ECRegistry::Observer()
@@ -767,15 +812,15 @@ namespace Runtime {
     {
         Assert(Valid(inEntity));
         const Internal::ArchetypeId archetypeId = entities.GetArchetype(inEntity);
-        Internal::Archetype& archetype = archetypes.at(archetypeId);
-
         const Internal::ArchetypeId newArchetypeId = archetypeId + inClass->GetTypeInfo()->id;
         entities.SetArchetype(inEntity, newArchetypeId);
 
-        if (!archetypes.contains(newArchetypeId)) {
-            archetypes.emplace(newArchetypeId, Internal::Archetype(archetype.NewRttiVecByAdd(Internal::CompRtti(inClass))));
+        // archetypes are stored inline, emplace before taking references
+        if (!archetypes.Contains(newArchetypeId)) {
+            archetypes.Emplace(newArchetypeId, Internal::Archetype(archetypes.At(archetypeId).NewRttiVecByAdd(Internal::CompRtti(inClass))));
         }
-        Internal::Archetype& newArchetype = archetypes.at(newArchetypeId);
+        Internal::Archetype& archetype = archetypes.At(archetypeId);
+        Internal::Archetype& newArchetype = archetypes.At(newArchetypeId);
         newArchetype.EmplaceElem(inEntity, archetype.GetElem(inEntity), archetype.GetRttiVec());
         archetype.EraseElem(inEntity);
 
@@ -789,16 +834,16 @@ namespace Runtime {
     {
         Assert(Valid(inEntity) && HasDyn(inClass, inEntity));
         const Internal::ArchetypeId archetypeId = entities.GetArchetype(inEntity);
-        Internal::Archetype& archetype = archetypes.at(archetypeId);
-
         const Internal::ArchetypeId newArchetypeId = archetypeId - inClass->GetTypeInfo()->id;
         entities.SetArchetype(inEntity, newArchetypeId);
 
-        if (!archetypes.contains(newArchetypeId)) {
-            archetypes.emplace(newArchetypeId, Internal::Archetype(archetype.NewRttiVecByRemove(Internal::CompRtti(inClass))));
+        // archetypes are stored inline, emplace before taking references
+        if (!archetypes.Contains(newArchetypeId)) {
+            archetypes.Emplace(newArchetypeId, Internal::Archetype(archetypes.At(archetypeId).NewRttiVecByRemove(Internal::CompRtti(inClass))));
         }
         NotifyRemoveDyn(inClass, inEntity);
-        Internal::Archetype& newArchetype = archetypes.at(newArchetypeId);
+        Internal::Archetype& archetype = archetypes.At(archetypeId);
+        Internal::Archetype& newArchetype = archetypes.At(newArchetypeId);
         newArchetype.EmplaceElem(inEntity, archetype.GetElem(inEntity), archetype.GetRttiVec());
         archetype.EraseElem(inEntity);
     }
@@ -820,7 +865,7 @@ namespace Runtime {
     {
         Assert(Valid(inEntity));
         return archetypes
-            .at(entities.GetArchetype(inEntity))
+            .At(entities.GetArchetype(inEntity))
             .Contains(inClass);
     }
 
@@ -838,7 +883,7 @@ namespace Runtime {
     {
         Assert(Valid(inEntity) && HasDyn(inClass, inEntity));
         Mirror::Any compRef = archetypes
-            .at(entities.GetArchetype(inEntity))
+            .At(entities.GetArchetype(inEntity))
             .GetComp(inEntity, inClass);
         return compRef;
     }
@@ -847,7 +892,7 @@ namespace Runtime {
     {
         Assert(Valid(inEntity) && HasDyn(inClass, inEntity));
         Mirror::Any compRef = archetypes
-            .at(entities.GetArchetype(inEntity))
+            .At(entities.GetArchetype(inEntity))
             .GetComp(inEntity, inClass);
         return compRef.ConstRef();
     }
@@ -1177,5 +1222,6 @@ namespace Runtime {
         pipeline.ParallelPerformAction([&](const SystemPipeline::SystemContext& context) -> void {
             context.instance->Tick(inDeltaTimeMs);
         });
+        ecRegistry.FlushEvents();
     }
 } // namespace Runtime
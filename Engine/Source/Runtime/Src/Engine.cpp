@@ -4,6 +4,7 @@
 
 #include <Runtime/Engine.h>
 #include <Common/Debug.h>
+#include <Common/Allocator.h>
 #include <Common/Time.h>
 #include <Core/Module.h>
 #include <Core/Paths.h>
@@ -55,6 +56,11 @@ namespace Runtime {
             world->Tick(inTimeSeconds);
         }
 
+        // frame-scoped data is released at the end of each thread's own frame
+        Common::FrameArena::Reset();
+        renderModule->DispatchRenderingCommand([]() -> void { Common::FrameArena::Reset(); });
+        renderModule->EndFrame();
+
         // TODO emplace render thread task, like wait fence, console command copy
     }
 
@@ -2,6 +2,7 @@
 // Created by johnk on 2025/1/21.
 //
 
+#include <Common/Allocator.h>
 #include <Runtime/System/Transform.h>
 
 namespace Runtime {
@@ -19,9 +20,10 @@ namespace Runtime {
     void TransformSystem::Tick(float inDeltaTimeMs)
     {
         // Step0: classify the updated entities
-        std::vector<Entity> pendingUpdateLocalTransforms;
-        std::vector<Entity> pendingUpdateChildrenWorldTransforms;
-        std::vector<Entity> pendingUpdateSelfAndChildrenWorldTransforms;
+        Common::FrameArenaMark scratchMark;
+        std::vector<Entity, Common::FrameAllocator<Entity>> pendingUpdateLocalTransforms;
+        std::vector<Entity, Common::FrameAllocator<Entity>> pendingUpdateChildrenWorldTransforms;
+        std::vector<Entity, Common::FrameAllocator<Entity>> pendingUpdateSelfAndChildrenWorldTransforms;
 
         pendingUpdateLocalTransforms.reserve(worldTransformUpdatedObserver.Size());
         pendingUpdateChildrenWorldTransforms.reserve(worldTransformUpdatedObserver.Size());
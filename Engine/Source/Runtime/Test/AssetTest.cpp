@@ -8,7 +8,7 @@
 
 TEST(AssetTest, AssetRefTest0)
 {
-    AssetRef<TestAsset> a0 = MakeShared<TestAsset>();
+    AssetRef<TestAsset> a0 = MakeIntrusive<TestAsset>();
     ASSERT_EQ(a0.RefCount(), 1);
 
     AssetRef<TestAsset> a1 = a0;
@@ -23,7 +23,7 @@ TEST(AssetTest, AssetRefTest0)
 
 TEST(AssetTest, AssetRefTest1)
 {
-    AssetRef<TestAsset> a0 = MakeShared<TestAsset>();
+    AssetRef<TestAsset> a0 = MakeIntrusive<TestAsset>();
     AssetRef<TestAsset> a1 = std::move(a0);
     ASSERT_EQ(a1.RefCount(), 1);
 
@@ -44,7 +44,7 @@ TEST(AssetTest, SaveLoadTest)
 {
     static Core::Uri uri("asset://Engine/Test/Generated/Runtime/AssetTest.SaveLoadTest");
 
-    AssetRef<TestAsset> asset = MakeShared<TestAsset>(uri, 1, "hello");
+    AssetRef<TestAsset> asset = MakeIntrusive<TestAsset>(uri, 1, "hello");
     AssetManager::Get().Save(asset);
 
     AssetRef<TestAsset> restore = AssetManager::Get().SyncLoad<TestAsset>(uri);
@@ -57,7 +57,7 @@ TEST(AssetTest, AsyncLoadTest)
 {
     static Core::Uri uri("asset://Engine/Test/Generated/Runtime/AssetTest.SaveLoadTest");
 
-    AssetRef<TestAsset> asset = MakeShared<TestAsset>(uri, 1, "hello");
+    AssetRef<TestAsset> asset = MakeIntrusive<TestAsset>(uri, 1, "hello");
     AssetManager::Get().Save(asset);
 
     AssetManager::Get().AsyncLoad<TestAsset>(uri, [&](AssetRef<TestAsset> restore) -> void {
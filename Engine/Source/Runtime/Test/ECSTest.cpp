@@ -301,6 +301,37 @@ TEST(ECSTest, ComponentEventDynamicTest)
     ASSERT_EQ(count, EventCounts(2, 3, 2));
 }
 
+TEST(ECSTest, ComponentBatchEventTest)
+{
+    std::vector<Entity> constructed;
+    std::vector<Entity> updated;
+    std::vector<Entity> removed;
+    ECRegistry registry;
+    registry.Events<CompA>().onConstructedBatch.BindLambda([&](ECRegistry&, std::span<const Entity> inEntities) -> void { constructed.insert(constructed.end(), inEntities.begin(), inEntities.end()); });
+    registry.Events<CompA>().onUpdatedBatch.BindLambda([&](ECRegistry&, std::span<const Entity> inEntities) -> void { updated.insert(updated.end(), inEntities.begin(), inEntities.end()); });
+    registry.Events<CompA>().onRemoveBatch.BindLambda([&](ECRegistry&, std::span<const Entity> inEntities) -> void { removed.insert(removed.end(), inEntities.begin(), inEntities.end()); });
+
+    const auto entity0 = registry.Create();
+    const auto entity1 = registry.Create();
+    registry.Emplace<CompA>(entity0, 1);
+    registry.Emplace<CompA>(entity1, 2);
+    registry.NotifyUpdated<CompA>(entity1);
+    ASSERT_TRUE(constructed.empty());
+    ASSERT_TRUE(updated.empty());
+
+    registry.FlushEvents();
+    ASSERT_EQ(constructed, std::vector<Entity>({ entity0, entity1 }));
+    ASSERT_EQ(updated, std::vector<Entity>({ entity1 }));
+    ASSERT_TRUE(removed.empty());
+
+    registry.Remove<CompA>(entity0);
+    registry.FlushEvents();
+    ASSERT_EQ(removed, std::vector<Entity>({ entity0 }));
+    registry.FlushEvents();
+    ASSERT_EQ(constructed.size(), 2);
+    ASSERT_EQ(removed.size(), 1);
+}
+
 TEST(ECSTest, GlobalComponentEventStaticTest)
 {
     EventCounts count;
@@ -258,15 +258,14 @@ Application::ShaderCompileOutput Application::CompileShader(const std::string& f
     options.withDebugInfo = false;
     auto future = Render::ShaderCompiler::Get().Compile(info, options);
 
-    future.wait();
-    auto compileOutput = future.get();
+    const auto& compileOutput = future.Get();
     if (!compileOutput.success) {
         std::cout << "failed to compiler shader (" << fileName << ", " << info.entryPoint << ")" << '\n' << compileOutput.errorInfo << std::endl;
     }
     Assert(compileOutput.success);
 
     ShaderCompileOutput result;
-    result.byteCode = std::move(compileOutput.byteCode);
-    result.reflectionData = std::move(compileOutput.reflectionData);
+    result.byteCode = compileOutput.byteCode;
+    result.reflectionData = compileOutput.reflectionData;
     return result;
 }
@@ -166,7 +166,7 @@ void TriangleApplication::CompileAllShaders()
     options.byteCodeType = GetRHIType() == RHI::RHIType::directX12 ? ShaderByteCodeType::dxil : ShaderByteCodeType::spirv;
     options.withDebugInfo = false;
     auto result = ShaderTypeCompiler::Get().CompileGlobalShaderTypes(options);
-    const auto& [success, errorInfo] = result.get();
+    const auto& [success, errorInfo] = result.Get();
     Assert(success);
 
     triangleVS = GlobalShaderMap<TriangleVS>::Get().GetShaderInstance(*device, {});